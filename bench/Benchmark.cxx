@@ -0,0 +1,144 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <rexsapi/ModelLoader.hxx>
+
+#include <bench/Benchmark.hxx>
+#include <bench/BenchmarkHelper.hxx>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+
+namespace
+{
+  std::atomic<uint64_t> allocations{0};
+  std::atomic<uint64_t> allocatedBytes{0};
+  std::atomic<int64_t> liveBytes{0};
+  std::atomic<int64_t> baseBytes{0};
+  std::atomic<int64_t> peakBytes{0};
+
+  // the size is stored in front of every allocation, so the unsized delete can update the live bytes
+  constexpr size_t HeaderSize = alignof(std::max_align_t);
+
+  void* allocate(size_t size)
+  {
+    auto* block = static_cast<unsigned char*>(std::malloc(size + HeaderSize));
+    if (block == nullptr) {
+      throw std::bad_alloc{};
+    }
+    *reinterpret_cast<size_t*>(block) = size;
+
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    const auto live = liveBytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed) +
+                      static_cast<int64_t>(size);
+    auto peak = peakBytes.load(std::memory_order_relaxed);
+    while (live > peak && !peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+    return block + HeaderSize;
+  }
+
+  void deallocate(void* ptr) noexcept
+  {
+    if (ptr == nullptr) {
+      return;
+    }
+    auto* block = static_cast<unsigned char*>(ptr) - HeaderSize;
+    liveBytes.fetch_sub(static_cast<int64_t>(*reinterpret_cast<size_t*>(block)), std::memory_order_relaxed);
+    std::free(block);
+  }
+}
+
+void* operator new(size_t size)
+{
+  return allocate(size);
+}
+
+void* operator new[](size_t size)
+{
+  return allocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+  deallocate(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+  deallocate(ptr);
+}
+
+
+namespace rexsapi::bench
+{
+  void resetAllocationStats() noexcept
+  {
+    allocations = 0;
+    allocatedBytes = 0;
+    baseBytes = liveBytes.load();
+    peakBytes = baseBytes.load();
+  }
+
+  TAllocationStats getAllocationStats() noexcept
+  {
+    return TAllocationStats{allocations.load(), allocatedBytes.load(),
+                            static_cast<uint64_t>(std::max<int64_t>(peakBytes.load() - baseBytes.load(), 0))};
+  }
+
+  const database::TModelRegistry& getRegistry()
+  {
+    static const auto registry = rexsapi::createModelRegistry(projectDir() / "models");
+    return registry;
+  }
+}
+
+
+int main(int argc, char** argv)
+{
+  if (argc > 3 || (argc > 1 && (std::string_view{argv[1]} == "-h" || std::string_view{argv[1]} == "--help"))) {
+    fmt::print("usage: {} [filter] [iterations]\n"
+               "  runs all benchmark cases containing the filter, every case is run iterations times (default 5)\n",
+               argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  try {
+    const rexsapi::bench::TBenchmarkRunner runner{argc > 1 ? argv[1] : "",
+                                                  argc > 2 ? std::stoul(argv[2]) : size_t{5}};
+    rexsapi::bench::TBenchmarkRunner::printHeader();
+    rexsapi::bench::runDatabaseBenchmarks(runner);
+    rexsapi::bench::runLoaderBenchmarks(runner);
+    rexsapi::bench::runModelBenchmarks(runner);
+  } catch (const std::exception& ex) {
+    fmt::print(stderr, "exception: {}\n", ex.what());
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
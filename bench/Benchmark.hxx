@@ -0,0 +1,142 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BENCH_BENCHMARK_HXX
+#define BENCH_BENCHMARK_HXX
+
+#include <rexsapi/database/ModelRegistry.hxx>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+
+
+namespace rexsapi::bench
+{
+  /**
+   * @brief Heap statistics of the benchmark process.
+   *
+   * Collected by the replaced global operator new and delete of the benchmark executable.
+   */
+  struct TAllocationStats {
+    uint64_t m_Allocations{0};
+    uint64_t m_Bytes{0};
+    uint64_t m_PeakBytes{0};
+  };
+
+  /**
+   * @brief Resets the allocation counters and the peak to the currently allocated bytes.
+   */
+  void resetAllocationStats() noexcept;
+
+  /**
+   * @brief Returns the allocations since the last reset.
+   *
+   * m_Bytes are all bytes allocated since the last reset, m_PeakBytes the maximum of additionally live bytes.
+   */
+  TAllocationStats getAllocationStats() noexcept;
+
+
+  /**
+   * @brief Runs the benchmark cases and prints their timings.
+   *
+   * Every case is run once for warming up and then the configured number of times. The minimum and median wall clock
+   * time and the heap statistics of the last run are printed.
+   */
+  class TBenchmarkRunner
+  {
+  public:
+    TBenchmarkRunner(std::string filter, size_t iterations)
+    : m_Filter{std::move(filter)}
+    , m_Iterations{std::max<size_t>(iterations, 1)}
+    {
+    }
+
+    /**
+     * @brief Checks if a case matches the filter given on the command line.
+     *
+     * Can be used to skip expensive preparations for cases that will not run.
+     */
+    bool enabled(std::string_view name) const noexcept
+    {
+      return m_Filter.empty() || name.find(m_Filter) != std::string_view::npos;
+    }
+
+    template<typename Func>
+    void run(std::string_view name, Func&& func) const;
+
+    static void printHeader();
+
+  private:
+    std::string m_Filter;
+    size_t m_Iterations;
+  };
+
+
+  /**
+   * @brief Returns the registry with the REXS database models of the project.
+   */
+  const database::TModelRegistry& getRegistry();
+
+  void runDatabaseBenchmarks(const TBenchmarkRunner& runner);
+  void runLoaderBenchmarks(const TBenchmarkRunner& runner);
+  void runModelBenchmarks(const TBenchmarkRunner& runner);
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  template<typename Func>
+  inline void TBenchmarkRunner::run(std::string_view name, Func&& func) const
+  {
+    if (!enabled(name)) {
+      return;
+    }
+
+    func();
+
+    std::vector<double> timings;
+    timings.reserve(m_Iterations);
+    TAllocationStats stats;
+    for (size_t n = 0; n < m_Iterations; ++n) {
+      resetAllocationStats();
+      const auto start = std::chrono::steady_clock::now();
+      func();
+      const auto end = std::chrono::steady_clock::now();
+      stats = getAllocationStats();
+      timings.emplace_back(std::chrono::duration<double, std::milli>(end - start).count());
+    }
+    std::sort(timings.begin(), timings.end());
+
+    fmt::print("{:<48} {:>12.3f} {:>12.3f} {:>12} {:>12.2f}\n", name, timings.front(), timings[timings.size() / 2],
+               stats.m_Allocations, static_cast<double>(stats.m_PeakBytes) / (1024.0 * 1024.0));
+    std::fflush(stdout);
+  }
+
+  inline void TBenchmarkRunner::printHeader()
+  {
+    fmt::print("{:<48} {:>12} {:>12} {:>12} {:>12}\n", "case", "min ms", "median ms", "allocations", "peak MiB");
+  }
+}
+
+#endif
@@ -0,0 +1,74 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <rexsapi/XSDSchemaValidator.hxx>
+#include <rexsapi/database/FileResourceLoader.hxx>
+#include <rexsapi/database/XMLModelLoader.hxx>
+
+#include <bench/Benchmark.hxx>
+#include <bench/BenchmarkHelper.hxx>
+
+
+namespace rexsapi::bench
+{
+  namespace
+  {
+    void checkRegistry(const database::TModelRegistry& registry)
+    {
+      if (registry.getModel(TRexsVersion{"1.6"}, "en").getComponents().empty()) {
+        throw TException{"database model 1.6 has no components"};
+      }
+    }
+  }
+
+  void runDatabaseBenchmarks(const TBenchmarkRunner& runner)
+  {
+    const auto modelsPath = projectDir() / "models";
+    const TFileXsdSchemaLoader schemaLoader{modelsPath / "rexs-schema.xsd"};
+    const database::TFileResourceLoader resourceLoader{modelsPath};
+    const database::TXmlModelLoader modelLoader{resourceLoader, schemaLoader};
+
+    // loads all database models vs. indexing them and loading only the used one
+    runner.run("database/registry/eager", [&modelLoader]() {
+      checkRegistry(database::TModelRegistry::createModelRegistry(modelLoader).first);
+    });
+    runner.run("database/registry/lazy", [&modelLoader]() {
+      checkRegistry(database::TModelRegistry::createLazyModelRegistry(modelLoader).first);
+    });
+
+    if (runner.enabled("database/component/findAttributeById")) {
+      const auto& model = getRegistry().getModel(TRexsVersion{"1.6"}, "en");
+      std::vector<std::pair<const database::TComponent*, std::string>> lookups;
+      for (const auto& [id, component] : model.getComponents()) {
+        for (const database::TAttribute& attribute : component.getAttributes()) {
+          lookups.emplace_back(&component, attribute.getAttributeId());
+        }
+      }
+
+      runner.run("database/component/findAttributeById", [&lookups]() {
+        size_t found = 0;
+        for (size_t n = 0; n < 100; ++n) {
+          for (const auto& [component, attributeId] : lookups) {
+            found += component->findAttributeById(attributeId).getAttributeId().size();
+          }
+        }
+        if (found == 0) {
+          throw TException{"no attributes found"};
+        }
+      });
+    }
+  }
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <rexsapi/ModelLoader.hxx>
+
+#include <bench/Benchmark.hxx>
+#include <bench/BenchmarkHelper.hxx>
+#include <bench/ModelGenerator.hxx>
+
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+
+namespace rexsapi::bench
+{
+  namespace
+  {
+    void checkModel(const std::optional<TModel>& model, const TResult& result, const std::string& name)
+    {
+      if (!model || result.isCritical()) {
+        throw TException{fmt::format("cannot load model '{}': {}", name,
+                                     result.getErrors().empty() ? "" : result.getErrors().front().getMessage())};
+      }
+    }
+
+    bool isEnabled(const TBenchmarkRunner& runner, const std::string& name)
+    {
+      return runner.enabled(fmt::format("{}/buffer", name)) || runner.enabled(fmt::format("{}/stream", name));
+    }
+
+    template<typename TLoader>
+    void runBufferAndStream(const TBenchmarkRunner& runner, const TLoader& loader, const std::string& name,
+                            const std::string& document)
+    {
+      // the buffer loaders parse in place, so every run works on a fresh copy of the document
+      runner.run(fmt::format("{}/buffer", name), [&loader, &name, &document]() {
+        std::vector<uint8_t> buffer{document.begin(), document.end()};
+        TResult result;
+        checkModel(loader.load(result, getRegistry(), TBufferView{buffer}), result, name);
+      });
+      runner.run(fmt::format("{}/stream", name), [&loader, &name, &document]() {
+        std::istringstream stream{document};
+        TResult result;
+        checkModel(loader.load(result, getRegistry(), stream), result, name);
+      });
+    }
+
+    void runExampleModels(const TBenchmarkRunner& runner, const TModelLoader& modelLoader)
+    {
+      for (const auto* file : {"FVA-Industriegetriebe_2_stufig_1-6.rexs", "FVA-Industriegetriebe_2stufig_1-4.rexs",
+                               "FVA-Industriegetriebe_2stufig_1-4.rexsj", "FVA_worm_stage_1-4.rexs",
+                               "FVA_worm_stage_1-4.rexsj"}) {
+        const auto path = projectDir() / "test" / "example_models" / file;
+        runner.run(fmt::format("loader/example/{}", file), [&modelLoader, &path]() {
+          TResult result;
+          checkModel(modelLoader.load(path, result, TMode::RELAXED_MODE), result, path.string());
+        });
+      }
+    }
+
+    void runSyntheticModels(const TBenchmarkRunner& runner, const TXMLModelLoader& xmlLoader,
+                            const TJsonModelLoader& jsonLoader)
+    {
+      const auto& databaseModel = getRegistry().getModel(TRexsVersion{"1.6"}, "en");
+
+      // component and relation heavy models
+      for (size_t components : {1000, 10000, 100000}) {
+        if (!isEnabled(runner, fmt::format("loader/xml/components/{}", components)) &&
+            !isEnabled(runner, fmt::format("loader/json/components/{}", components))) {
+          continue;
+        }
+        const auto model = createSyntheticModel(databaseModel, components);
+        runBufferAndStream(runner, xmlLoader, fmt::format("loader/xml/components/{}", components), toXml(model));
+        runBufferAndStream(runner, jsonLoader, fmt::format("loader/json/components/{}", components), toJson(model));
+      }
+
+      // few components with large array attributes
+      if (isEnabled(runner, "loader/xml/arrays") || isEnabled(runner, "loader/json/arrays")) {
+        const auto model = createSyntheticModel(databaseModel, 100, 100000);
+        runBufferAndStream(runner, xmlLoader, "loader/xml/arrays", toXml(model));
+        runBufferAndStream(runner, jsonLoader, "loader/json/arrays", toJson(model));
+      }
+    }
+
+    void runLoadAll(const TBenchmarkRunner& runner, const TModelLoader& modelLoader)
+    {
+      std::vector<size_t> threadCounts{1, 2, 4, 8};
+      if (const size_t hardware = std::thread::hardware_concurrency(); hardware > threadCounts.back()) {
+        threadCounts.emplace_back(hardware);
+      }
+      if (std::none_of(threadCounts.begin(), threadCounts.end(), [&runner](size_t threads) {
+            return runner.enabled(fmt::format("loader/loadAll/threads/{}", threads));
+          })) {
+        return;
+      }
+
+      const auto directory = std::filesystem::temp_directory_path() / "rexsapi_bench";
+      std::filesystem::create_directories(directory);
+      const auto generated = createSyntheticModel(getRegistry().getModel(TRexsVersion{"1.6"}, "en"), 5000);
+      const auto xml = toXml(generated);
+      const auto json = toJson(generated);
+
+      std::vector<std::filesystem::path> paths;
+      for (size_t n = 0; n < 32; ++n) {
+        auto& path = paths.emplace_back(directory / fmt::format("model_{}.{}", n, n % 2 ? "rexsj" : "rexs"));
+        std::ofstream file{path, std::ios_base::binary};
+        file << (n % 2 ? json : xml);
+      }
+
+      for (size_t threads : threadCounts) {
+        runner.run(fmt::format("loader/loadAll/threads/{}", threads), [&modelLoader, &paths, threads]() {
+          for (const auto& [model, result] : modelLoader.loadAll(paths, TMode::STRICT_MODE, threads)) {
+            checkModel(model, result, "loadAll");
+          }
+        });
+      }
+
+      std::filesystem::remove_all(directory);
+    }
+  }
+
+  void runLoaderBenchmarks(const TBenchmarkRunner& runner)
+  {
+    const auto modelsPath = projectDir() / "models";
+    const TModelLoader modelLoader{modelsPath};
+    const TXSDSchemaValidator xmlValidator{TFileXsdSchemaLoader{modelsPath / "rexs-file.xsd"}};
+    const TJsonSchemaValidator jsonValidator{TFileJsonSchemaLoader{modelsPath / "rexs-file.json"}};
+    const TXMLModelLoader xmlLoader{TMode::STRICT_MODE, xmlValidator};
+    const TJsonModelLoader jsonLoader{TMode::STRICT_MODE, jsonValidator};
+
+    runExampleModels(runner, modelLoader);
+    runSyntheticModels(runner, xmlLoader, jsonLoader);
+    runLoadAll(runner, modelLoader);
+  }
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <bench/Benchmark.hxx>
+#include <bench/ModelGenerator.hxx>
+
+#include <rexsapi/ModelBuilder.hxx>
+
+#include <sstream>
+
+
+namespace rexsapi::bench
+{
+  namespace
+  {
+    constexpr size_t Components = 100000;
+
+    // the builder searches all added components for duplicate ids, so it is benchmarked with a smaller model
+    constexpr size_t BuilderComponents = 10000;
+
+    TModel buildModel(const database::TModel& databaseModel)
+    {
+      TModelBuilder builder{databaseModel};
+      for (size_t n = 0; n < BuilderComponents; ++n) {
+        if (n % 10 == 0) {
+          builder.addComponent("shaft").name(fmt::format("Shaft {}", n));
+          builder.addAttribute("mass_of_component").unit("kg").value(12.5);
+          builder.addAttribute("part_number").value(fmt::format("P-{}", n));
+          builder.addCustomAttribute("custom_balancing_grade", TValueType::FLOATING_POINT).unit("mm").value(6.3);
+          continue;
+        }
+        builder.addComponent("shaft_section");
+        builder.addAttribute("outer_diameter_begin").unit("mm").value(40.0);
+        builder.addAttribute("outer_diameter_end").unit("mm").value(40.0);
+        builder.addAttribute("length").unit("mm").value(25.0);
+        builder.addCustomAttribute("custom_surface_treatment", TValueType::STRING).value("nitrided");
+      }
+      return builder.build("REXSapi Benchmark", "1.0", databaseModel.getLanguage());
+    }
+
+    void checkOutput(const std::string& output)
+    {
+      if (output.empty()) {
+        throw TException{"serializer did not produce any output"};
+      }
+    }
+  }
+
+  void runModelBenchmarks(const TBenchmarkRunner& runner)
+  {
+    const auto builderCase = fmt::format("model/builder/components/{}", BuilderComponents);
+    const std::vector<std::string> serializerCases{"model/serializer/xml/document", "model/serializer/xml/stream",
+                                                   "model/serializer/json/document", "model/serializer/json/stream"};
+    const bool serializerEnabled =
+      std::any_of(serializerCases.begin(), serializerCases.end(), [&runner](const auto& name) {
+        return runner.enabled(name);
+      });
+    if (!runner.enabled(builderCase) && !serializerEnabled) {
+      return;
+    }
+
+    const auto& databaseModel = getRegistry().getModel(TRexsVersion{"1.6"}, "en");
+
+    // component types, custom attribute ids, and units repeat for every component
+    runner.run(builderCase, [&databaseModel]() {
+      if (buildModel(databaseModel).getComponents().size() != BuilderComponents) {
+        throw TException{"builder did not create all components"};
+      }
+    });
+
+    if (!serializerEnabled) {
+      return;
+    }
+    const auto model = createSyntheticModel(databaseModel, Components);
+    runner.run(serializerCases[0], [&model]() {
+      checkOutput(toXml(model));
+    });
+    runner.run(serializerCases[1], [&model]() {
+      std::ostringstream stream;
+      XMLModelSerializer{}.serialize(model, stream);
+      checkOutput(stream.str());
+    });
+    runner.run(serializerCases[2], [&model]() {
+      checkOutput(toJson(model));
+    });
+    runner.run(serializerCases[3], [&model]() {
+      std::ostringstream stream;
+      TJsonModelSerializer{}.serialize(model, stream);
+      checkOutput(stream.str());
+    });
+  }
+}
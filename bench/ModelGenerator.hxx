@@ -0,0 +1,132 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BENCH_MODEL_GENERATOR_HXX
+#define BENCH_MODEL_GENERATOR_HXX
+
+#include <rexsapi/JsonModelSerializer.hxx>
+#include <rexsapi/JsonSerializer.hxx>
+#include <rexsapi/Model.hxx>
+#include <rexsapi/XMLModelSerializer.hxx>
+#include <rexsapi/XMLSerializer.hxx>
+
+
+namespace rexsapi::bench
+{
+  /**
+   * @brief Creates a synthetic REXS model of arbitrary size.
+   *
+   * Every tenth component is a shaft, all others are shaft sections assembled into the preceding shaft. Each shaft
+   * section additionally references its predecessor, so the model has about two relations per component. The shafts
+   * carry a custom attribute and a floating point array with arraySize elements, and the single load case sets the
+   * rotational speed of every shaft.
+   *
+   * The model is created directly instead of with the TModelBuilder, as the builder searches all added components for
+   * duplicate ids and gets too slow for large models.
+   *
+   * @param databaseModel The REXS database model to build the model for. Has to contain the shaft and shaft_section
+   * components.
+   * @param components The number of components to create
+   * @param arraySize The number of elements of the array attribute of every shaft
+   * @return TModel the created model
+   */
+  TModel createSyntheticModel(const database::TModel& databaseModel, size_t components, size_t arraySize = 16);
+
+  std::string toXml(const TModel& model);
+
+  std::string toJson(const TModel& model);
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  inline TModel createSyntheticModel(const database::TModel& databaseModel, size_t components, size_t arraySize)
+  {
+    const auto& shaftType = databaseModel.findComponentById("shaft");
+    const auto& sectionType = databaseModel.findComponentById("shaft_section");
+    const auto attribute = [](const database::TComponent& type, const std::string& id, auto value) {
+      return TAttribute{type.findAttributeById(id), TValue{std::move(value)}};
+    };
+
+    TComponents modelComponents;
+    modelComponents.reserve(components);
+    for (size_t n = 0; n < components; ++n) {
+      TAttributes attributes;
+      if (n % 10 == 0) {
+        attributes.emplace_back(attribute(shaftType, "mass_of_component", 12.5));
+        attributes.emplace_back(attribute(shaftType, "part_number", fmt::format("P-{}", n)));
+        attributes.emplace_back(attribute(shaftType, "force_distribution_u", TFloatArrayType(arraySize, 47.11)));
+        attributes.emplace_back(
+          TAttribute{"custom_balancing_grade", TUnit{"mm"}, TValueType::FLOATING_POINT, TValue{6.3}});
+        modelComponents.emplace_back(n + 1, shaftType, fmt::format("Shaft {}", n), std::move(attributes));
+        continue;
+      }
+      attributes.emplace_back(attribute(sectionType, "inner_diameter_begin", 0.0));
+      attributes.emplace_back(attribute(sectionType, "inner_diameter_end", 0.0));
+      attributes.emplace_back(attribute(sectionType, "outer_diameter_begin", 40.0));
+      attributes.emplace_back(attribute(sectionType, "outer_diameter_end", 40.0));
+      attributes.emplace_back(attribute(sectionType, "length", 25.0));
+      attributes.emplace_back(attribute(sectionType, "u_coordinate_on_shaft", 25.0 * static_cast<double>(n % 10)));
+      modelComponents.emplace_back(n + 1, sectionType, "", std::move(attributes));
+    }
+
+    TRelations relations;
+    TLoadComponents loadComponents;
+    for (size_t n = 0; n < components; ++n) {
+      const auto& component = modelComponents[n];
+      if (n % 10 == 0) {
+        loadComponents.emplace_back(component, TAttributes{attribute(shaftType, "rotational_speed", 1450.0)});
+        continue;
+      }
+      const auto& shaft = modelComponents[n - n % 10];
+      relations.emplace_back(TRelationType::ASSEMBLY, static_cast<uint32_t>(n % 10),
+                             TRelationReferences{TRelationReference{TRelationRole::ASSEMBLY, "", shaft},
+                                                 TRelationReference{TRelationRole::PART, "", component}});
+      if (n % 10 > 1) {
+        const auto& previous = modelComponents[n - 1];
+        relations.emplace_back(TRelationType::REFERENCE, std::nullopt,
+                               TRelationReferences{TRelationReference{TRelationRole::ORIGIN, "", component},
+                                                   TRelationReference{TRelationRole::REFERENCED, "", previous}});
+      }
+    }
+
+    TLoadCases loadCases;
+    loadCases.emplace_back(std::move(loadComponents));
+    TModelInfo info{"REXSapi Benchmark", "1.0", "2024-01-01T00:00:00+01:00", databaseModel.getVersion(),
+                    databaseModel.getLanguage()};
+    return TModel{std::move(info), std::move(modelComponents), std::move(relations),
+                  TLoadSpectrum{std::move(loadCases), std::nullopt}};
+  }
+
+  inline std::string toXml(const TModel& model)
+  {
+    TXMLStringSerializer stringSerializer;
+    XMLModelSerializer modelSerializer;
+    modelSerializer.serialize(model, stringSerializer);
+    return stringSerializer.getModel();
+  }
+
+  inline std::string toJson(const TModel& model)
+  {
+    TJsonStringSerializer stringSerializer;
+    TJsonModelSerializer modelSerializer;
+    modelSerializer.serialize(model, stringSerializer);
+    return stringSerializer.getModel();
+  }
+}
+
+#endif
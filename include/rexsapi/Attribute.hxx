@@ -21,6 +21,8 @@
 #include <rexsapi/Value.hxx>
 #include <rexsapi/database/Attribute.hxx>
 
+#include <memory>
+
 namespace rexsapi
 {
   /**
@@ -64,15 +66,15 @@ namespace rexsapi
      * @param value The value of this attribute. Should match the value type.
      * @throws TException if the attributeId is empty
      */
-    TAttribute(std::string attributeId, TUnit unit, TValueType type, TValue value)
-    : m_CustomAttributeId{std::move(attributeId)}
-    , m_CustomValueType{type}
+    TAttribute(const std::string& attributeId, TUnit unit, TValueType type, TValue value)
+    : m_CustomValueType{type}
     , m_Unit{std::move(unit)}
     , m_Value{std::move(value)}
     {
-      if (m_CustomAttributeId.empty()) {
+      if (attributeId.empty()) {
         throw TException{"a custom value is not allowed to have an empty id"};
       }
+      m_CustomAttributeId = std::make_shared<const std::string>(attributeId);
     }
 
     /**
@@ -109,7 +111,7 @@ namespace rexsapi
       if (m_AttributeWrapper) {
         return m_AttributeWrapper.value().get().getAttributeId();
       }
-      return m_CustomAttributeId;
+      return *m_CustomAttributeId;
     }
 
     [[nodiscard]] const std::string& getName() const& noexcept
@@ -117,7 +119,7 @@ namespace rexsapi
       if (m_AttributeWrapper) {
         return m_AttributeWrapper.value().get().getName();
       }
-      return m_CustomAttributeId;
+      return *m_CustomAttributeId;
     }
 
     [[nodiscard]] const TUnit& getUnit() const& noexcept
@@ -183,7 +185,8 @@ namespace rexsapi
   private:
     std::optional<std::reference_wrapper<const database::TAttribute>> m_AttributeWrapper;
 
-    std::string m_CustomAttributeId{};
+    // shared by all copies, custom ids from model files are not interned to not keep them for the whole process
+    std::shared_ptr<const std::string> m_CustomAttributeId;
     std::optional<TValueType> m_CustomValueType{};
 
     TUnit m_Unit;
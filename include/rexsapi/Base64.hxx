@@ -33,39 +33,45 @@
 
 namespace rexsapi::detail
 {
+  static constexpr const char* base64chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+  /// Both base64 characters for every 12 bit value, so a three byte block is encoded with two table lookups
+  static constexpr std::array<char, 8192> base64CharPairs = []() {
+    std::array<char, 8192> pairs{};
+    for (size_t n = 0; n < 4096; ++n) {
+      pairs[2 * n] = base64chars[n >> 6];
+      pairs[2 * n + 1] = base64chars[n & 63];
+    }
+    return pairs;
+  }();
+
   static inline std::string base64Encode(const uint8_t* data, const size_t len)
   {
-    static constexpr const char* base64chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
     std::string result((len + 2) / 3 * 4, '=');
     char* str = result.data();
-    size_t resultIndex = 0;
-    size_t padCount = len % 3;
-    uint32_t n = 0;
-
-    for (size_t x = 0; x < len; x += 3) {
-      n = ((uint32_t)data[x]) << 16;
-
-      if ((x + 1) < len)
-        n += ((uint32_t)data[x + 1]) << 8;
-
-      if ((x + 2) < len)
-        n += data[x + 2];
-
-      str[resultIndex++] = base64chars[(uint8_t)(n >> 18) & 63];
-      str[resultIndex++] = base64chars[(uint8_t)(n >> 12) & 63];
-
-      if ((x + 1) < len) {
-        str[resultIndex++] = base64chars[(uint8_t)(n >> 6) & 63];
-      }
 
-      if ((x + 2) < len) {
-        str[resultIndex++] = base64chars[(uint8_t)n & 63];
-      }
+    // encode complete three byte blocks without any bounds checks
+    const size_t blocks = len / 3 * 3;
+    for (size_t x = 0; x < blocks; x += 3, str += 4) {
+      const uint32_t n = static_cast<uint32_t>(data[x]) << 16 | static_cast<uint32_t>(data[x + 1]) << 8 | data[x + 2];
+      const char* high = &base64CharPairs[(n >> 12) * 2];
+      const char* low = &base64CharPairs[(n & 4095) * 2];
+      str[0] = high[0];
+      str[1] = high[1];
+      str[2] = low[0];
+      str[3] = low[1];
     }
 
-    if (padCount > 0) {
-      for (; padCount < 3; padCount++) {
-        str[resultIndex++] = '=';
+    // the remaining one or two bytes, the result is already padded
+    if (const size_t rest = len - blocks; rest > 0) {
+      uint32_t n = static_cast<uint32_t>(data[blocks]) << 16;
+      if (rest > 1) {
+        n |= static_cast<uint32_t>(data[blocks + 1]) << 8;
+      }
+      str[0] = base64chars[(n >> 18) & 63];
+      str[1] = base64chars[(n >> 12) & 63];
+      if (rest > 1) {
+        str[2] = base64chars[(n >> 6) & 63];
       }
     }
 
@@ -73,7 +79,34 @@ namespace rexsapi::detail
   }
 
 
-  static inline std::vector<uint8_t> base64Decode(std::string_view data)
+  /**
+   * @brief Calculates the buffer size needed for decoding base64 data.
+   *
+   * @param data The base64 encoded data
+   * @return The upper bound of the decoded size. The actual size may be smaller for data with whitespace or without
+   * padding.
+   */
+  static inline size_t base64DecodedSize(std::string_view data) noexcept
+  {
+    const auto len = data.size();
+    if (len == 0) {
+      return 0;
+    }
+    const size_t pad1 = len % 4 || data[len - 1] == '=';
+    const size_t pad2 = pad1 && (len % 4 > 2 || data[len - 2] != '=');
+    const size_t last = (len - pad1) / 4 << 2;
+    return last / 4 * 3 + pad1 + pad2;
+  }
+
+  /**
+   * @brief Decodes base64 data into a caller provided buffer.
+   *
+   * @param data The base64 encoded data
+   * @param result The buffer to decode into. Has to have at least base64DecodedSize(data) bytes.
+   * @return The number of decoded bytes
+   * @throws TException if the data is not valid base64
+   */
+  static inline size_t base64Decode(std::string_view data, uint8_t* result)
   {
     static constexpr const std::array<uint8_t, 256> d = {
       66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 64, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
@@ -91,23 +124,31 @@ namespace rexsapi::detail
     static constexpr uint8_t EQUALS = 65;
     static constexpr uint8_t INVALID = 66;
 
-    std::vector<uint8_t> result;
     const auto len = data.size();
-    if (len == 0) {
-      return result;
-    }
-
     const auto* p = reinterpret_cast<const uint8_t*>(data.data());
     size_t j = 0;
-    const size_t pad1 = len % 4 || p[len - 1] == '=';
-    const size_t pad2 = pad1 && (len % 4 > 2 || p[len - 2] != '=');
-    const size_t last = (len - pad1) / 4 << 2;
-    result.resize(last / 4 * 3 + pad1 + pad2);
+
+    // decode blocks of four regular characters without branching per character. Whitespace, padding, and invalid
+    // characters all have bit 6 set in the decode table and are handled by the character wise loop below.
+    size_t i = 0;
+    for (; i + 4 <= len; i += 4) {
+      const uint32_t c0 = d[p[i]];
+      const uint32_t c1 = d[p[i + 1]];
+      const uint32_t c2 = d[p[i + 2]];
+      const uint32_t c3 = d[p[i + 3]];
+      if ((c0 | c1 | c2 | c3) & WHITESPACE) {
+        break;
+      }
+      const uint32_t buf = c0 << 18 | c1 << 12 | c2 << 6 | c3;
+      result[j++] = static_cast<uint8_t>(buf >> 16);
+      result[j++] = static_cast<uint8_t>(buf >> 8);
+      result[j++] = static_cast<uint8_t>(buf);
+    }
 
     char iter = 0;
     uint32_t buf = 0;
 
-    for (const auto cc : data) {
+    for (const auto cc : data.substr(i)) {
       uint8_t c = d[static_cast<uint8_t>(cc)];
 
       switch (c) {
@@ -137,6 +178,14 @@ namespace rexsapi::detail
       result[j++] = (buf >> 4) & 255;
     }
 
+    return j;
+  }
+
+  static inline std::vector<uint8_t> base64Decode(std::string_view data)
+  {
+    std::vector<uint8_t> result(base64DecodedSize(data));
+    // the size calculated upfront does not account for whitespace or missing padding
+    result.resize(base64Decode(data, result.data()));
     return result;
   }
 }
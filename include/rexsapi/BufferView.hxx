@@ -0,0 +1,87 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_BUFFER_VIEW_HXX
+#define REXSAPI_BUFFER_VIEW_HXX
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace rexsapi
+{
+  /**
+   * @brief Non-owning view of a modifiable byte buffer.
+   *
+   * Used by the model loaders to process documents regardless of where the bytes are stored, e.g. in a vector or in a
+   * memory-mapped file. The buffer has to outlive the view. The loaders may modify the buffer while processing it.
+   */
+  class TBufferView
+  {
+  public:
+    TBufferView() noexcept = default;
+
+    TBufferView(uint8_t* data, size_t size) noexcept
+    : m_Data{data}
+    , m_Size{size}
+    {
+    }
+
+    /**
+     * @brief Constructs a new TBufferView object viewing the elements of a vector.
+     *
+     * Allows to pass vectors to all functions expecting a view.
+     *
+     * @param buffer The vector to view
+     */
+    TBufferView(std::vector<uint8_t>& buffer) noexcept
+    : m_Data{buffer.data()}
+    , m_Size{buffer.size()}
+    {
+    }
+
+    uint8_t* data() const noexcept
+    {
+      return m_Data;
+    }
+
+    size_t size() const noexcept
+    {
+      return m_Size;
+    }
+
+    bool empty() const noexcept
+    {
+      return m_Size == 0;
+    }
+
+    uint8_t* begin() const noexcept
+    {
+      return m_Data;
+    }
+
+    uint8_t* end() const noexcept
+    {
+      return m_Data + m_Size;
+    }
+
+  private:
+    uint8_t* m_Data{nullptr};
+    size_t m_Size{0};
+  };
+}
+
+#endif
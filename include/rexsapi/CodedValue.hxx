@@ -20,6 +20,8 @@
 #include <rexsapi/Base64.hxx>
 #include <rexsapi/Value.hxx>
 
+#include <cstring>
+
 
 /**
  * @brief Classes and functions in the detail namespace shall not be used by client code.
@@ -33,6 +35,38 @@ namespace rexsapi::detail
   static std::string toCodedValueString(TCodedValueType type);
 
 
+  /**
+   * @brief Decodes base64 encoded elements directly into the storage of the resulting vector.
+   *
+   * Elements are widened in place to the result type, so no intermediate buffers are needed.
+   *
+   * @tparam T The type of the encoded elements
+   * @tparam R The type of the resulting elements. Has to be at least as large as T.
+   * @param value The base64 encoded elements
+   * @return std::vector<R> containing all complete elements
+   */
+  template<typename T, typename R = T>
+  static inline std::vector<R> decodeCodedElements(std::string_view value)
+  {
+    static_assert(sizeof(R) >= sizeof(T), "coded elements can only be widened");
+
+    std::vector<R> elements((base64DecodedSize(value) + sizeof(T) - 1) / sizeof(T));
+    auto* bytes = reinterpret_cast<uint8_t*>(elements.data());
+    const auto count = base64Decode(value, bytes) / sizeof(T);
+    if constexpr (!std::is_same_v<T, R>) {
+      // back to front, so no element is overwritten before it has been read
+      for (size_t n = count; n-- > 0;) {
+        T element;
+        std::memcpy(&element, bytes + n * sizeof(T), sizeof(T));
+        elements[n] = static_cast<R>(element);
+      }
+    }
+    elements.resize(count);
+
+    return elements;
+  }
+
+
   template<typename T, std::enable_if_t<std::is_integral_v<T> || std::is_floating_point_v<T>>* = nullptr>
   class TCodedValueArray
   {
@@ -44,18 +78,10 @@ namespace rexsapi::detail
       return base64Encode(data, len);
     }
 
-    static std::vector<T> decode(std::string_view value)
+    template<typename R = T>
+    static std::vector<R> decode(std::string_view value)
     {
-      std::vector<T> array;
-      const auto data = base64Decode(value);
-      const auto count = data.size() / sizeof(T);
-      array.reserve(count);
-      const auto values = reinterpret_cast<const T*>(data.data());
-      for (size_t n = 0; n < count; ++n) {
-        array.emplace_back(values[n]);
-      }
-
-      return array;
+      return decodeCodedElements<T, R>(value);
     }
   };
 
@@ -65,26 +91,24 @@ namespace rexsapi::detail
   public:
     static std::string encode(const TMatrix<T>& matrix)
     {
-      const auto count = matrix.m_Values.size() * matrix.m_Values[0].size();
+      // coded matrices are stored in column-major order
       std::vector<T> array;
-      array.reserve(count);
+      array.reserve(matrix.size());
 
-      for (size_t c = 0; c < matrix.m_Values[0].size(); ++c) {
-        for (size_t r = 0; r < matrix.m_Values.size(); ++r) {
-          array.emplace_back(matrix.m_Values[r][c]);
-        }
+      for (size_t c = 0; c < matrix.getColumnCount(); ++c) {
+        const auto column = matrix.getColumn(c);
+        array.insert(array.end(), column.begin(), column.end());
       }
       const auto* data = reinterpret_cast<const uint8_t*>(array.data());
       const auto len = array.size() * sizeof(T);
       return base64Encode(data, len);
     }
 
-    static TMatrix<T> decode(std::string_view value, size_t columns, size_t rows)
+    template<typename R = T>
+    static TMatrix<R> decode(std::string_view value, size_t columns, size_t rows)
     {
-      TMatrix<T> matrix;
-      const auto data = base64Decode(value);
-      const auto count = data.size() / sizeof(T);
-      const auto values = reinterpret_cast<const T*>(data.data());
+      const auto values = decodeCodedElements<T>(value);
+      const auto count = values.size();
       if (count != columns * rows) {
         throw TException{
           fmt::format("matrix does not have the correct element count: {} rows: {} columns: {}", count, rows, columns)};
@@ -92,17 +116,15 @@ namespace rexsapi::detail
       if (count == 0) {
         throw TException{"matrix does not have any elements"};
       }
-      matrix.m_Values.reserve(rows);
-      for (size_t row = 0; row < rows; ++row) {
-        std::vector<T> col;
-        col.reserve(columns);
-        for (size_t column = 0; column < columns; ++column) {
-          col.emplace_back(values[row + (rows * column)]);
+      // coded matrices are stored in column-major order, transpose and widen in one pass
+      std::vector<R> elements(count);
+      for (size_t column = 0; column < columns; ++column) {
+        for (size_t row = 0; row < rows; ++row) {
+          elements[row * columns + column] = static_cast<R>(values[row + (rows * column)]);
         }
-        matrix.m_Values.emplace_back(std::move(col));
       }
 
-      return matrix;
+      return TMatrix<R>{rows, columns, std::move(elements)};
     }
   };
 
@@ -215,13 +237,7 @@ namespace rexsapi::detail
       if (!std::is_same_v<T1, typename ValueTypeForCodedValueType<T2>::Type>) {
         throw TException{"coded value type does not correspond to attribute value type"};
       }
-      auto result = TCodedValueArray<typename TypeForCodedValueType<T2>::Type>::decode(value);
-      std::vector<T1> tmp;
-      tmp.resize(result.size());
-      std::transform(result.begin(), result.end(), tmp.begin(), [](auto x) {
-        return static_cast<T1>(x);
-      });
-      TValue val{std::move(tmp)};
+      TValue val{TCodedValueArray<typename TypeForCodedValueType<T2>::Type>::template decode<T1>(value)};
       val.coded(getCodedType(TCodedValueType{T2::value}));
       return val;
     }
@@ -234,8 +250,8 @@ namespace rexsapi::detail
       if (!std::is_same_v<T1, typename ValueTypeForCodedValueType<T2>::Type>) {
         throw TException{"coded value type does not correspond to attribute value type"};
       }
-      auto result = TCodedValueMatrix<typename TypeForCodedValueType<T2>::Type>::decode(value, columns, rows);
-      TValue val{TMatrix<T1>{result}};
+      TValue val{
+        TCodedValueMatrix<typename TypeForCodedValueType<T2>::Type>::template decode<T1>(value, columns, rows)};
       val.coded(getCodedType(TCodedValueType{T2::value}));
       return val;
     }
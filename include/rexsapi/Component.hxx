@@ -46,7 +46,7 @@ namespace rexsapi
      */
     TComponent(uint64_t internalId, const database::TComponent& componentType, std::string name, TAttributes attributes)
     : m_InternalId{internalId}
-    , m_Type{componentType.getComponentId()}
+    , m_Type{&componentType.getComponentId()}
     , m_Name{std::move(name)}
     , m_Attributes{std::move(attributes)}
     {
@@ -70,7 +70,7 @@ namespace rexsapi
                TAttributes attributes)
     : m_ExternalId{externalId}
     , m_InternalId{internalId}
-    , m_Type{componentType.getComponentId()}
+    , m_Type{&componentType.getComponentId()}
     , m_Name{std::move(name)}
     , m_Attributes{std::move(attributes)}
     {
@@ -89,7 +89,7 @@ namespace rexsapi
     TComponent(const TComponent& component, TAttributes attributes)
     : m_ExternalId{component.getExternalId()}
     , m_InternalId{component.getInternalId()}
-    , m_Type{component.getType()}
+    , m_Type{component.m_Type}
     , m_Name{component.getName()}
     , m_Attributes{std::move(attributes)}
     {
@@ -133,7 +133,7 @@ namespace rexsapi
 
     const std::string& getType() const& noexcept
     {
-      return m_Type;
+      return *m_Type;
     }
 
     const std::string& getName() const& noexcept
@@ -149,7 +149,7 @@ namespace rexsapi
   private:
     uint64_t m_ExternalId{std::numeric_limits<uint64_t>::max()};
     uint64_t m_InternalId;
-    std::string m_Type;
+    const std::string* m_Type;
     std::string m_Name;
     TAttributes m_Attributes;
   };
@@ -20,13 +20,159 @@
 #include <rexsapi/Exception.hxx>
 #include <rexsapi/Format.hxx>
 
+#include <charconv>
 #include <chrono>
+#include <cmath>
 #include <ctime>
 #include <iomanip>
+#include <limits>
+#include <locale>
 #include <sstream>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
 
 namespace rexsapi
 {
+  namespace detail
+  {
+    static inline std::string_view skipNumberPrefix(std::string_view s)
+    {
+      const auto pos = s.find_first_not_of(" \t\n\v\f\r");
+      if (pos == std::string_view::npos) {
+        return {};
+      }
+      s.remove_prefix(pos);
+      /// std::from_chars does not accept a plus sign, but the std::sto* functions do
+      if (s.size() > 1 && s[0] == '+' && s[1] != '-' && s[1] != '+') {
+        s.remove_prefix(1);
+      }
+      return s;
+    }
+
+    /**
+     * @brief Parses a number from the beginning of a string.
+     *
+     * Works like std::from_chars, but additionally skips leading whitespace and accepts a leading plus sign, like the
+     * std::sto* functions do. The parsing is always locale independent.
+     *
+     * @tparam T The number type to parse
+     * @param s The string to parse
+     * @param value Receives the parsed number. Is not modified if the string does not start with a number.
+     * @return std::from_chars_result with the position of the first unparsed character and the error code
+     */
+    template<typename T>
+    static inline std::from_chars_result fromChars(std::string_view s, T& value)
+    {
+      s = skipNumberPrefix(s);
+      const char* last = s.data() + s.size();
+      if constexpr (std::is_floating_point_v<T>) {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        return std::from_chars(s.data(), last, value);
+#else
+        /// Fallback for standard libraries without floating point std::from_chars. Slower, but just as independent of
+        /// the global locale.
+        std::istringstream stream{std::string{s}};
+        stream.imbue(std::locale::classic());
+        T parsed{};
+        stream >> std::noskipws >> parsed;
+        if (stream.fail()) {
+          if (!(std::abs(parsed) < std::numeric_limits<T>::max())) {
+            return std::from_chars_result{last, std::errc::result_out_of_range};
+          }
+          return std::from_chars_result{s.data(), std::errc::invalid_argument};
+        }
+        value = parsed;
+        const auto pos = stream.eof() ? s.size() : static_cast<size_t>(stream.tellg());
+        return std::from_chars_result{s.data() + pos, std::errc{}};
+#endif
+      } else {
+        return std::from_chars(s.data(), last, value);
+      }
+    }
+
+    template<typename T>
+    static inline std::errc tryConvert(std::string_view s, T& value)
+    {
+      T parsed{};
+      const auto [ptr, ec] = fromChars(s, parsed);
+      if (ec != std::errc{}) {
+        return ec;
+      }
+      if (ptr != s.data() + s.size()) {
+        return std::errc::invalid_argument;
+      }
+      value = parsed;
+      return std::errc{};
+    }
+
+    template<typename T>
+    static inline T convert(std::string_view s, const char* type)
+    {
+      T value{};
+      const auto [ptr, ec] = fromChars(s, value);
+      if (ec == std::errc::invalid_argument) {
+        throw TException{fmt::format("cannot convert string '{}' to {}: invalid argument", s, type)};
+      }
+      if (ec == std::errc::result_out_of_range) {
+        throw TException{fmt::format("cannot convert string '{}' to {}: out of range", s, type)};
+      }
+      if (ptr != s.data() + s.size()) {
+        throw TException{fmt::format("cannot convert string to {}: {}", type, s)};
+      }
+      return value;
+    }
+  }
+
+  /**
+   * @brief Converts a string into an unsigned 64 bit integer without throwing.
+   *
+   * The conversion will only be successful, if the string actually contains an unsigned 64 bit integer and is in range.
+   *
+   * @param s The string to convert.
+   * @param value Receives the converted integer on success.
+   * @return std::errc{} on success, std::errc::invalid_argument if the string is not an unsigned integer or contains
+   * other characters after the integer, std::errc::result_out_of_range if the integer is out of range.
+   */
+  static inline std::errc tryConvertToUint64(std::string_view s, uint64_t& value)
+  {
+    if (s.find('-') != std::string_view::npos) {
+      return std::errc::invalid_argument;
+    }
+    return detail::tryConvert(s, value);
+  }
+
+  /**
+   * @brief Converts a string into a signed 64 bit integer without throwing.
+   *
+   * The conversion will only be successful, if the string actually contains a signed 64 bit integer and is in range.
+   *
+   * @param s The string to convert.
+   * @param value Receives the converted integer on success.
+   * @return std::errc{} on success, std::errc::invalid_argument if the string is not an integer or contains other
+   * characters after the integer, std::errc::result_out_of_range if the integer is out of range.
+   */
+  static inline std::errc tryConvertToInt64(std::string_view s, int64_t& value)
+  {
+    return detail::tryConvert(s, value);
+  }
+
+  /**
+   * @brief Converts a string into a double without throwing.
+   *
+   * The conversion will only be successful, if the string actually contains a double and is in range. The conversion
+   * does not depend on the current locale, the decimal separator is always a point.
+   *
+   * @param s The string to convert.
+   * @param value Receives the converted double on success.
+   * @return std::errc{} on success, std::errc::invalid_argument if the string is not a double or contains other
+   * characters after the double, std::errc::result_out_of_range if the double is out of range.
+   */
+  static inline std::errc tryConvertToDouble(std::string_view s, double& value)
+  {
+    return detail::tryConvert(s, value);
+  }
+
   /**
    * @brief Converts a string into an unsigned 64 bit integer.
    *
@@ -37,26 +183,14 @@ namespace rexsapi
    * @throws TException if the string is not an integer or out of range. Will also throw if the string contains other
    * characters after the integer.
    */
-  static inline uint64_t convertToUint64(const std::string& s)
+  static inline uint64_t convertToUint64(std::string_view s)
   {
-    if (s.find_first_of('-') == std::string::npos) {
-      try {
-        size_t pos = 0;
-        auto val = std::stoull(s, &pos);
-        if (pos == s.length()) {
-          return val;
-        }
-      } catch (const std::invalid_argument&) {
-        throw TException{fmt::format("cannot convert string '{}' to unsigned integer: invalid argument", s)};
-      } catch (const std::out_of_range&) {
-        throw TException{fmt::format("cannot convert string '{}' to unsigned integer: out of range", s)};
-      }
+    if (s.find('-') != std::string_view::npos) {
+      throw TException{fmt::format("cannot convert string to unsigned integer: {}", s)};
     }
-
-    throw TException{fmt::format("cannot convert string to unsigned integer: {}", s)};
+    return detail::convert<uint64_t>(s, "unsigned integer");
   }
 
-
   /**
    * @brief Converts a string into a signed 64 bit integer.
    *
@@ -67,49 +201,25 @@ namespace rexsapi
    * @throws TException if the string is not an integer or out of range. Will also throw if the string contains other
    * characters after the integer.
    */
-  static inline int64_t convertToInt64(const std::string& s)
+  static inline int64_t convertToInt64(std::string_view s)
   {
-    try {
-      size_t pos = 0;
-      auto val = std::stoll(s, &pos);
-      if (pos == s.length()) {
-        return val;
-      }
-    } catch (const std::invalid_argument&) {
-      throw TException{fmt::format("cannot convert string '{}' to integer: invalid argument", s)};
-    } catch (const std::out_of_range&) {
-      throw TException{fmt::format("cannot convert string '{}' to integer: out of range", s)};
-    }
-
-    throw TException{fmt::format("cannot convert string to integer: {}", s)};
+    return detail::convert<int64_t>(s, "integer");
   }
 
-
   /**
    * @brief Converts a string into a double.
    *
-   * The conversion will only be successful, if the string actually contains a double and is in range.
+   * The conversion will only be successful, if the string actually contains a double and is in range. The conversion
+   * does not depend on the current locale, the decimal separator is always a point.
    *
    * @param s The string to convert.
    * @return double converted from the string
    * @throws TException if the string is not a double or out of range. Will also throw if the string contains other
    * characters after the integer.
    */
-  static inline double convertToDouble(const std::string& s)
+  static inline double convertToDouble(std::string_view s)
   {
-    try {
-      std::size_t pos = 0;
-      auto val = std::stod(s, &pos);
-      if (pos == s.length()) {
-        return val;
-      }
-    } catch (const std::invalid_argument&) {
-      throw TException{fmt::format("cannot convert string '{}' to double: invalid argument", s)};
-    } catch (const std::out_of_range&) {
-      throw TException{fmt::format("cannot convert string '{}' to double: out of range", s)};
-    }
-
-    throw TException{fmt::format("cannot convert string to double: {}", s)};
+    return detail::convert<double>(s, "double");
   }
 
   /**
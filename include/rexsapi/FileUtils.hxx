@@ -17,38 +17,229 @@
 #ifndef REXSAPI_FILE_UTILS_HXX
 #define REXSAPI_FILE_UTILS_HXX
 
+#include <rexsapi/Exception.hxx>
 #include <rexsapi/Result.hxx>
 
 #include <filesystem>
 #include <fstream>
-#include <sstream>
+#include <limits>
+#include <memory>
+#include <system_error>
+#include <vector>
+
+#if defined(WIN32)
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+  #endif
+  #include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
 
 namespace rexsapi::detail
 {
-  static inline std::vector<uint8_t> loadFile(TResult& result, const std::filesystem::path& path)
+  /**
+   * @brief Private view of the content of a file.
+   *
+   * The file is mapped copy-on-write into memory if the platform supports it. Mapped pages are loaded on first access
+   * and are backed by the file, so the content is not copied. Pages are only copied once they are modified, e.g. by
+   * in-place parsing. Modifications are never written back to the file. If the file cannot be mapped, e.g. because it
+   * is empty or the file system does not support mapping, it is read into a buffer instead.
+   */
+  class TMappedFile
+  {
+  public:
+    /**
+     * @brief Constructs a new TMappedFile object.
+     *
+     * @param path The file to map
+     * @throws TException if the file cannot be opened or read
+     */
+    explicit TMappedFile(const std::filesystem::path& path);
+
+    TMappedFile(const TMappedFile&) = delete;
+    TMappedFile(TMappedFile&&) = delete;
+    TMappedFile& operator=(const TMappedFile&) = delete;
+    TMappedFile& operator=(TMappedFile&&) = delete;
+
+    ~TMappedFile();
+
+    uint8_t* data() noexcept
+    {
+      return m_Data;
+    }
+
+    const uint8_t* data() const noexcept
+    {
+      return m_Data;
+    }
+
+    size_t size() const noexcept
+    {
+      return m_Size;
+    }
+
+    /**
+     * @brief Checks if the file is mapped into memory or has been read into a buffer.
+     *
+     */
+    bool isMapped() const noexcept
+    {
+      return m_Mapped;
+    }
+
+  private:
+    uint8_t* m_Data{nullptr};
+    size_t m_Size{0};
+    bool m_Mapped{false};
+    std::vector<uint8_t> m_Buffer;
+  };
+
+
+  static inline bool checkFile(TResult& result, const std::filesystem::path& path)
   {
     if (!std::filesystem::exists(path)) {
       result.addError(TError{TErrorLevel::CRIT, fmt::format("'{}' does not exist", path.string())});
-      return {};
+      return false;
     }
     if (!std::filesystem::is_regular_file(path)) {
       result.addError(TError{TErrorLevel::CRIT, fmt::format("'{}' is not a regular file", path.string())});
+      return false;
+    }
+    return true;
+  }
+
+  static inline bool readFile(const std::filesystem::path& path, std::vector<uint8_t>& buffer)
+  {
+    std::ifstream file{path, std::ios_base::binary};
+    std::error_code ec;
+    const auto size = std::filesystem::file_size(path, ec);
+    if (!file.good() || ec) {
+      return false;
+    }
+    buffer.resize(static_cast<size_t>(size));
+    file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    return static_cast<size_t>(file.gcount()) == buffer.size();
+  }
+
+  /**
+   * @brief Reads a file into a buffer.
+   *
+   * @param result Will contain an error if the file does not exist, cannot be read, or is empty
+   * @param path The file to read
+   * @return std::vector<uint8_t> The content of the file. Empty on error.
+   */
+  static inline std::vector<uint8_t> loadFile(TResult& result, const std::filesystem::path& path)
+  {
+    if (!checkFile(result, path)) {
       return {};
     }
-    std::ifstream file{path};
-    if (!file.good()) {
+    std::vector<uint8_t> buffer;
+    if (!readFile(path, buffer) || buffer.empty()) {
       result.addError(TError{TErrorLevel::CRIT, fmt::format("'{}' cannot be loaded", path.string())});
       return {};
     }
+    return buffer;
+  }
 
-    std::stringstream stream;
-    stream << file.rdbuf();
-    auto buffer = stream.str();
-    if (!file.good() || buffer.empty()) {
-      result.addError(TError{TErrorLevel::CRIT, fmt::format("'{}' cannot be loaded", path.string())});
+  /**
+   * @brief Maps a file into memory.
+   *
+   * In contrast to loadFile, the content of the file is not copied into a buffer if the file can be mapped.
+   *
+   * @param result Will contain an error if the file does not exist, cannot be read, or is empty
+   * @param path The file to map
+   * @return std::unique_ptr<TMappedFile> The mapped file. Empty on error.
+   */
+  static inline std::unique_ptr<TMappedFile> mapFile(TResult& result, const std::filesystem::path& path)
+  {
+    if (!checkFile(result, path)) {
       return {};
     }
-    return std::vector<uint8_t>{buffer.begin(), buffer.end()};
+    try {
+      auto file = std::make_unique<TMappedFile>(path);
+      if (file->size() != 0) {
+        return file;
+      }
+    } catch (const std::exception&) {
+      // reported below
+    }
+    result.addError(TError{TErrorLevel::CRIT, fmt::format("'{}' cannot be loaded", path.string())});
+    return {};
+  }
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  inline TMappedFile::TMappedFile(const std::filesystem::path& path)
+  {
+#if defined(WIN32)
+    HANDLE handle = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle != INVALID_HANDLE_VALUE) {
+      LARGE_INTEGER size{};
+      if (::GetFileSizeEx(handle, &size) && size.QuadPart > 0 &&
+          static_cast<uint64_t>(size.QuadPart) <= std::numeric_limits<size_t>::max()) {
+        // the view keeps the mapping alive, both handles can be closed right away
+        HANDLE mapping = ::CreateFileMappingW(handle, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (mapping != nullptr) {
+          void* view = ::MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+          if (view != nullptr) {
+            m_Data = static_cast<uint8_t*>(view);
+            m_Size = static_cast<size_t>(size.QuadPart);
+            m_Mapped = true;
+          }
+          ::CloseHandle(mapping);
+        }
+      }
+      ::CloseHandle(handle);
+    }
+#elif defined(__unix__) || defined(__APPLE__)
+    const int handle = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (handle >= 0) {
+      struct stat info{};
+      if (::fstat(handle, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0 &&
+          static_cast<uint64_t>(info.st_size) <= std::numeric_limits<size_t>::max()) {
+        // the mapping stays valid after the file has been closed
+        void* view = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, handle, 0);
+        if (view != MAP_FAILED) {
+          m_Data = static_cast<uint8_t*>(view);
+          m_Size = static_cast<size_t>(info.st_size);
+          m_Mapped = true;
+        }
+      }
+      ::close(handle);
+    }
+#endif
+    if (m_Mapped) {
+      return;
+    }
+
+    if (!readFile(path, m_Buffer)) {
+      throw TException{fmt::format("Cannot read file '{}'", path.string())};
+    }
+    m_Data = m_Buffer.data();
+    m_Size = m_Buffer.size();
+  }
+
+  inline TMappedFile::~TMappedFile()
+  {
+    if (!m_Mapped) {
+      return;
+    }
+#if defined(WIN32)
+    ::UnmapViewOfFile(m_Data);
+#elif defined(__unix__) || defined(__APPLE__)
+    ::munmap(m_Data, m_Size);
+#endif
   }
 }
 
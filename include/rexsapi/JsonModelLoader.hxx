@@ -17,15 +17,19 @@
 #ifndef REXSAPI_JSON_MODEL_LOADER_HXX
 #define REXSAPI_JSON_MODEL_LOADER_HXX
 
+#include <rexsapi/BufferView.hxx>
 #include <rexsapi/DataSourceResolver.hxx>
 #include <rexsapi/Json.hxx>
 #include <rexsapi/JsonSchemaValidator.hxx>
+#include <rexsapi/JsonStreamReader.hxx>
 #include <rexsapi/JsonValueDecoder.hxx>
 #include <rexsapi/ModelHelper.hxx>
 #include <rexsapi/ModelMerger.hxx>
 #include <rexsapi/RelationTypeChecker.hxx>
 #include <rexsapi/database/ModelRegistry.hxx>
 
+#include <algorithm>
+#include <istream>
 #include <set>
 
 namespace rexsapi
@@ -67,31 +71,82 @@ namespace rexsapi
      * @param result Describes the outcome of the operation. Will contain messages upon issues encountered.
      * @param registry Will load the REXS database version and language corresponding to the version information in the
      * buffer
-     * @param buffer The actual REXS model in json format
+     * @param buffer The actual REXS model in json format, e.g. a vector or a memory-mapped file
      * @return std::optional<TModel> Will contain a TModel instance if one could be created. Can be empty if critical
      * errors are encountered while processing the buffer. Buffer not validating against the schema are one source of
      * critical errors.
      */
-    std::optional<TModel> load(TResult& result, const database::TModelRegistry& registry,
-                               std::vector<uint8_t>& buffer) const;
+    std::optional<TModel> load(TResult& result, const database::TModelRegistry& registry, TBufferView buffer) const;
+
+    /**
+     * @brief Processes a stream and creates a TModel instance upon success.
+     *
+     * In contrast to loading a buffer, the document is never kept in memory as a whole. Components, relations, load
+     * cases, and accumulation components are read one after another and validated against the json schema on the fly.
+     * Memory consumption is therefore bound by the size of the resulting model instead of the size of the document.
+     * Processing stops with a critical error as soon as an element does not validate against the schema.
+     *
+     * The model version and language should precede the relations and components in the stream. Otherwise all
+     * elements have to be kept until the complete document has been read. This is also the case for documents without
+     * an application language.
+     *
+     * @param result Describes the outcome of the operation. Will contain messages upon issues encountered.
+     * @param registry Will load the REXS database version and language corresponding to the version information in the
+     * stream
+     * @param stream The actual REXS model in json format
+     * @return std::optional<TModel> Will contain a TModel instance if one could be created. Can be empty if critical
+     * errors are encountered while processing the stream. Malformed documents or documents not validating against the
+     * schema are sources of critical errors.
+     */
+    std::optional<TModel> load(TResult& result, const database::TModelRegistry& registry, std::istream& stream) const;
 
   private:
+    static TModelInfo getModelInfo(const json& model);
+
+    const database::TModel& getDatabaseModel(TResult& result, const database::TModelRegistry& registry,
+                                             const TRexsVersion& version,
+                                             const std::optional<std::string>& language) const;
+
+    bool validateRecord(TResult& result, std::string_view container, json& record) const;
+
     TComponents getComponents(TResult& result, detail::ComponentMapping& componentMapping,
                               const database::TModel& dbModel, const json& j) const;
 
+    void addComponent(TResult& result, detail::ComponentMapping& componentMapping, const database::TModel& dbModel,
+                      TComponents& components, const json& component, detail::TJsonRecord* record = nullptr) const;
+
     TAttributes getAttributes(std::string_view context, TResult& result, uint64_t componentId,
-                              const database::TComponent& componentType, const json& component) const;
+                              const database::TComponent& componentType, const json& component,
+                              detail::TJsonRecord* record = nullptr, std::string_view recordPath = {}) const;
 
     TRelations getRelations(TResult& result, const detail::ComponentMapping& componentMapping,
                             const TComponents& components, const json& j) const;
 
+    void addRelation(TResult& result, const detail::ComponentMapping& componentMapping, const TComponents& components,
+                     std::set<uint64_t>& usedComponents, TRelations& relations, const json& relation) const;
+
+    static void checkUsedComponents(TResult& result, const TComponents& components,
+                                    const std::set<uint64_t>& usedComponents);
+
     TLoadCases getLoadCases(TResult& result, const detail::ComponentMapping& componentMapping,
                             const TComponents& components, const database::TModel& dbModel, const json& j) const;
 
+    TLoadCase getLoadCase(TResult& result, const detail::ComponentMapping& componentMapping,
+                          const TComponents& components, const database::TModel& dbModel, const json& loadCase,
+                          detail::TJsonRecord* record = nullptr) const;
+
     std::optional<TAccumulation> getAccumulation(TResult& result, const detail::ComponentMapping& componentMapping,
                                                  const TComponents& components, const database::TModel& dbModel,
                                                  const json& j) const;
 
+    void addAccumulationComponent(TResult& result, const detail::ComponentMapping& componentMapping,
+                                  const TComponents& components, const database::TModel& dbModel,
+                                  TLoadComponents& loadComponents, const json& componentRef,
+                                  detail::TJsonRecord* record = nullptr) const;
+
+    std::optional<TModel> createModel(TResult& result, const database::TModelRegistry& registry,
+                                      std::optional<TModel> model) const;
+
     static bool checkDuplicate(const TAttributes& attributes, const TAttribute& attribute);
 
     static TValueType getValueType(const json& attribute);
@@ -108,10 +163,10 @@ namespace rexsapi
   /////////////////////////////////////////////////////////////////////////////
 
   inline std::optional<TModel> TJsonModelLoader::load(TResult& result, const database::TModelRegistry& registry,
-                                                      std::vector<uint8_t>& buffer) const
+                                                      TBufferView buffer) const
   {
     try {
-      const json j = json::parse(buffer);
+      const json j = json::parse(buffer.begin(), buffer.end());
       if (std::vector<std::string> errors; !m_Validator.validate(j, errors)) {
         for (const auto& error : errors) {
           result.addError(TError{TErrorLevel::CRIT, error});
@@ -119,24 +174,8 @@ namespace rexsapi
         return {};
       }
 
-      std::optional<std::string> language;
-      if (j.contains("/model/applicationLanguage"_json_pointer)) {
-        language = j["/model/applicationLanguage"_json_pointer].get<std::string>();
-      }
-
-      TModelInfo info{j["/model/applicationId"_json_pointer].get<std::string>(),
-                      j["/model/applicationVersion"_json_pointer].get<std::string>(),
-                      j["/model/date"_json_pointer].get<std::string>(),
-                      TRexsVersion{j["/model/version"_json_pointer].get<std::string>()}, language};
-
-      const auto& dbModel =
-        registry.getModel(info.getVersion(), language.value_or("en"), m_Mode.getMode() == TMode::STRICT_MODE);
-
-      if (dbModel.getVersion() != info.getVersion()) {
-        result.addError(
-          TError{TErrorLevel::WARN, fmt::format("exact database model for version not available, using {}",
-                                                dbModel.getVersion().asString())});
-      }
+      TModelInfo info = getModelInfo(j["model"]);
+      const auto& dbModel = getDatabaseModel(result, registry, info.getVersion(), info.getApplicationLanguage());
 
       detail::ComponentMapping componentMapping;
       TComponents components = getComponents(result, componentMapping, dbModel, j);
@@ -144,80 +183,326 @@ namespace rexsapi
       TLoadCases loadCases = getLoadCases(result, componentMapping, components, dbModel, j);
       std::optional<TAccumulation> accumulation = getAccumulation(result, componentMapping, components, dbModel, j);
 
-      std::optional<TModel> model = TModel{std::move(info), std::move(components), std::move(relations),
-                                           TLoadSpectrum{std::move(loadCases), std::move(accumulation)}};
-      const TRelationTypeChecker checker{m_Mode.getMode()};
-      checker.check(result, *model);
+      return createModel(result, registry,
+                         TModel{std::move(info), std::move(components), std::move(relations),
+                                TLoadSpectrum{std::move(loadCases), std::move(accumulation)}});
+    } catch (const json::exception& ex) {
+      result.addError(TError{TErrorLevel::CRIT, fmt::format("cannot parse json document: {}", ex.what())});
+    }
+    return {};
+  }
 
-      const rexsapi::TModelMerger merger{m_Mode.getMode(), registry};
-      std::set<std::string, std::less<>> referencedDataSources;
-      const detail::TComponentFinder finder{model->getComponents()};
-      for (const auto& attribute : finder.findAllAttributesByAttributeId("data_source")) {
-        referencedDataSources.emplace(attribute.getValueAsString());
-      }
-      if (m_DataSourceResolver != nullptr) {
-        for (const auto& dataSource : referencedDataSources) {
-          TResult subResult;
-          auto referencedModel = m_DataSourceResolver->load(dataSource, subResult, m_Mode.getMode());
-          if (subResult.hasIssues()) {
-            for (const auto& error : subResult.getErrors()) {
-              result.addError(TError{error.getLevel(), fmt::format("{}: {}", dataSource, error.getMessage())});
-            }
+  inline std::optional<TModel> TJsonModelLoader::load(TResult& result, const database::TModelRegistry& registry,
+                                                      std::istream& stream) const
+  {
+    enum TContainer : size_t { COMPONENTS, RELATIONS, LOAD_CASES, ACCUMULATION };
+    const std::vector<std::string> containers{"/model/components", "/model/relations",
+                                              "/model/load_spectrum/load_cases",
+                                              "/model/load_spectrum/accumulation/components"};
+
+    // set while the database model for the document version is loaded
+    bool loadingDatabaseModel{false};
+
+    try {
+      const database::TModel* dbModel{nullptr};
+      // set if the model version or language do not precede the records, all records have to be kept until the end
+      bool deferAll{false};
+      std::vector<std::pair<size_t, detail::TJsonRecord>> pendingRecords;
+
+      detail::ComponentMapping componentMapping;
+      TComponents components;
+      bool componentsProcessed{false};
+      bool relationsClosed{false};
+      bool relationsChecked{false};
+      TRelations relations;
+      std::set<uint64_t> usedComponents;
+      TLoadCases loadCases;
+      bool hasAccumulation{false};
+      TLoadComponents accumulationComponents;
+
+      const auto initDatabaseModel = [&](const detail::TJsonStreamReader& streamReader) {
+        if (dbModel == nullptr && !deferAll) {
+          const auto* model = streamReader.findOpenValue("/model");
+          if (model == nullptr || !model->contains("version") || !model->contains("applicationLanguage")) {
+            deferAll = true;
+            return;
           }
-          if (!referencedModel) {
-            result.addError(
-              TError{TErrorLevel::CRIT, fmt::format("{}: could not load external referenced model", dataSource)});
-            return {};
+          const TRexsVersion version{(*model)["version"].get<std::string>()};
+          const auto language = (*model)["applicationLanguage"].get<std::string>();
+          loadingDatabaseModel = true;
+          dbModel = &getDatabaseModel(result, registry, version, language);
+          loadingDatabaseModel = false;
+        }
+      };
+
+      const auto processRecord = [&](size_t container, detail::TJsonRecord& record) {
+        // array and matrix elements have already been checked against the schema item types while reading
+        for (const auto& error : record.m_Errors) {
+          result.addError(TError{TErrorLevel::CRIT, fmt::format("{}: {}", containers[container], error)});
+        }
+        if (!record.m_Errors.empty() || !validateRecord(result, containers[container], record.m_Value)) {
+          return false;
+        }
+        switch (container) {
+          case COMPONENTS:
+            addComponent(result, componentMapping, *dbModel, components, record.m_Value, &record);
+            break;
+          case RELATIONS:
+            addRelation(result, componentMapping, components, usedComponents, relations, record.m_Value);
+            break;
+          case LOAD_CASES:
+            loadCases.emplace_back(
+              getLoadCase(result, componentMapping, components, *dbModel, record.m_Value, &record));
+            break;
+          default:
+            addAccumulationComponent(result, componentMapping, components, *dbModel, accumulationComponents,
+                                     record.m_Value, &record);
+            break;
+        }
+        return true;
+      };
+
+      // the unused components can only be determined once all components and relations have been processed
+      const auto checkRelations = [&]() {
+        if (componentsProcessed && relationsClosed && !relationsChecked) {
+          relationsChecked = true;
+          checkUsedComponents(result, components, usedComponents);
+        }
+      };
+
+      const auto processComponents = [&]() {
+        if (componentsProcessed) {
+          return true;
+        }
+        componentsProcessed = true;
+
+        // process pending records in the same order as the buffer loader: components, relations, load spectrum
+        std::stable_sort(pendingRecords.begin(), pendingRecords.end(), [](const auto& lhs, const auto& rhs) {
+          return lhs.first < rhs.first;
+        });
+        auto it = pendingRecords.begin();
+        for (; it != pendingRecords.end() && it->first == COMPONENTS; ++it) {
+          if (!processRecord(it->first, it->second)) {
+            return false;
+          }
+        }
+        detail::ComponentPostProcessor postProcessor{result, m_Mode, components, componentMapping};
+        components = postProcessor.release();
+        for (; it != pendingRecords.end() && it->first == RELATIONS; ++it) {
+          if (!processRecord(it->first, it->second)) {
+            return false;
           }
-          model = merger.merge(result, *model, dataSource, *referencedModel);
-          if (!model) {
-            result.addError(TError{TErrorLevel::CRIT,
-                                   fmt::format("could not merge external referenced model from '{}'", dataSource)});
-            return {};
+        }
+        checkRelations();
+        for (; it != pendingRecords.end(); ++it) {
+          if (!processRecord(it->first, it->second)) {
+            return false;
+          }
+        }
+        pendingRecords.clear();
+        return true;
+      };
+
+      detail::TJsonStreamReader reader{
+        containers,
+        [&](const detail::TJsonStreamReader& streamReader, size_t container, detail::TJsonRecord& record) {
+          initDatabaseModel(streamReader);
+          if (deferAll || (container != COMPONENTS && !componentsProcessed)) {
+            pendingRecords.emplace_back(container, std::move(record));
+            return true;
           }
+          return processRecord(container, record);
+        },
+        [&](const detail::TJsonStreamReader& streamReader, size_t container) {
+          switch (container) {
+            case COMPONENTS:
+              initDatabaseModel(streamReader);
+              return dbModel == nullptr || processComponents();
+            case RELATIONS:
+              relationsClosed = true;
+              checkRelations();
+              break;
+            case ACCUMULATION:
+              hasAccumulation = true;
+              break;
+            default:
+              break;
+          }
+          return true;
+        }};
+
+      const auto doc = reader.read(stream);
+      if (!doc) {
+        return {};
+      }
+      if (std::vector<std::string> errors; !m_Validator.validate(*doc, errors)) {
+        for (const auto& error : errors) {
+          result.addError(TError{TErrorLevel::CRIT, error});
         }
-      } else if (!referencedDataSources.empty()) {
-        result.addError(
-          TError{m_Mode.adapt(TErrorLevel::ERR),
-                 fmt::format("model contains external referenced components but no data source resolver was given")});
+        return {};
       }
 
-      if (!finder.findAllAttributesByAttributeId("referenced_component_id").empty()) {
-        result.addError(
-          TError{m_Mode.adapt(TErrorLevel::ERR), fmt::format("could not resolve all external referenced components")});
+      TModelInfo info = getModelInfo((*doc)["model"]);
+      if (dbModel == nullptr) {
+        loadingDatabaseModel = true;
+        dbModel = &getDatabaseModel(result, registry, info.getVersion(), info.getApplicationLanguage());
+        loadingDatabaseModel = false;
       }
+      if (!processComponents()) {
+        return {};
+      }
+      relationsClosed = true;
+      checkRelations();
 
-      return model;
-    } catch (const json::exception& ex) {
+      std::optional<TAccumulation> accumulation;
+      if (hasAccumulation) {
+        accumulation = TAccumulation{std::move(accumulationComponents)};
+      }
+      return createModel(result, registry,
+                         TModel{std::move(info), std::move(components), std::move(relations),
+                                TLoadSpectrum{std::move(loadCases), std::move(accumulation)}});
+    } catch (const std::exception& ex) {
+      if (loadingDatabaseModel) {
+        // the database model could not be loaded, which is not a parse error. Let the exception escape just like
+        // loading from a buffer does.
+        throw;
+      }
       result.addError(TError{TErrorLevel::CRIT, fmt::format("cannot parse json document: {}", ex.what())});
     }
     return {};
   }
 
+  inline TModelInfo TJsonModelLoader::getModelInfo(const json& model)
+  {
+    std::optional<std::string> language;
+    if (model.contains("applicationLanguage")) {
+      language = model["applicationLanguage"].get<std::string>();
+    }
+
+    return TModelInfo{model["applicationId"].get<std::string>(), model["applicationVersion"].get<std::string>(),
+                      model["date"].get<std::string>(), TRexsVersion{model["version"].get<std::string>()}, language};
+  }
+
+  inline const database::TModel& TJsonModelLoader::getDatabaseModel(TResult& result,
+                                                                    const database::TModelRegistry& registry,
+                                                                    const TRexsVersion& version,
+                                                                    const std::optional<std::string>& language) const
+  {
+    const auto& dbModel =
+      registry.getModel(result, version, language.value_or("en"), m_Mode.getMode() == TMode::STRICT_MODE);
+
+    if (dbModel.getVersion() != version) {
+      result.addError(TError{TErrorLevel::WARN, fmt::format("exact database model for version not available, using {}",
+                                                            dbModel.getVersion().asString())});
+    }
+    return dbModel;
+  }
+
+  inline bool TJsonModelLoader::validateRecord(TResult& result, std::string_view container, json& record) const
+  {
+    // embed the record into a minimal valid document
+    json doc{{"model",
+              {{"version", "1.0"},
+               {"applicationId", ""},
+               {"applicationVersion", ""},
+               {"date", "2022-05-05T10:35:00+02:00"},
+               {"relations", json::array()},
+               {"components", json::array()},
+               {"load_spectrum", {{"id", 0}, {"load_cases", json::array()}}}}}};
+    const json::json_pointer pointer{std::string{container}};
+    if (!doc.contains(pointer.parent_pointer())) {
+      doc[pointer.parent_pointer()] = json::object();
+    }
+    doc[pointer] = json::array();
+    doc[pointer].push_back(std::move(record));
+
+    std::vector<std::string> errors;
+    const bool valid = m_Validator.validate(doc, errors);
+    record = std::move(doc[pointer][0]);
+    for (const auto& error : errors) {
+      result.addError(TError{TErrorLevel::CRIT, error});
+    }
+    return valid;
+  }
+
+  inline std::optional<TModel> TJsonModelLoader::createModel(TResult& result, const database::TModelRegistry& registry,
+                                                             std::optional<TModel> model) const
+  {
+    const TRelationTypeChecker checker{m_Mode.getMode()};
+    checker.check(result, *model);
+
+    const rexsapi::TModelMerger merger{m_Mode.getMode(), registry};
+    std::set<std::string, std::less<>> referencedDataSources;
+    const detail::TComponentFinder finder{model->getComponents()};
+    for (const auto& attribute : finder.findAllAttributesByAttributeId("data_source")) {
+      referencedDataSources.emplace(attribute.get().getValueAsString());
+    }
+    if (m_DataSourceResolver != nullptr) {
+      for (const auto& dataSource : referencedDataSources) {
+        TResult subResult;
+        auto referencedModel = m_DataSourceResolver->load(dataSource, subResult, m_Mode.getMode());
+        if (subResult.hasIssues()) {
+          for (const auto& error : subResult.getErrors()) {
+            result.addError(TError{error.getLevel(), fmt::format("{}: {}", dataSource, error.getMessage())});
+          }
+        }
+        if (!referencedModel) {
+          result.addError(
+            TError{TErrorLevel::CRIT, fmt::format("{}: could not load external referenced model", dataSource)});
+          return {};
+        }
+        model = merger.merge(result, *model, dataSource, *referencedModel);
+        if (!model) {
+          result.addError(TError{TErrorLevel::CRIT,
+                                 fmt::format("could not merge external referenced model from '{}'", dataSource)});
+          return {};
+        }
+      }
+    } else if (!referencedDataSources.empty()) {
+      result.addError(
+        TError{m_Mode.adapt(TErrorLevel::ERR),
+               fmt::format("model contains external referenced components but no data source resolver was given")});
+    }
+
+    if (!finder.findAllAttributesByAttributeId("referenced_component_id").empty()) {
+      result.addError(
+        TError{m_Mode.adapt(TErrorLevel::ERR), fmt::format("could not resolve all external referenced components")});
+    }
+
+    return model;
+  }
+
   inline TComponents TJsonModelLoader::getComponents(TResult& result, detail::ComponentMapping& componentMapping,
                                                      const database::TModel& dbModel, const json& j) const
   {
     TComponents components;
 
     for (const auto& component : j["/model/components"_json_pointer]) {
-      auto componentId = component["id"].get<uint64_t>();
-      std::string componentName = component.value("name", "");
-      try {
-        const auto& componentType = dbModel.findComponentById(component["type"].get<std::string>());
-        std::string context = componentName.empty() ? componentType.getName() : componentName;
-        TAttributes attributes = getAttributes(context, result, componentId, componentType, component);
-
-        components.emplace_back(TComponent{componentId, componentMapping.addComponent(componentId), componentType,
-                                           componentName, std::move(attributes)});
-      } catch (const std::exception& ex) {
-        result.addError(
-          TError{m_Mode.adapt(TErrorLevel::ERR), fmt::format("component id={}: {}", componentId, ex.what())});
-      }
+      addComponent(result, componentMapping, dbModel, components, component);
     }
     detail::ComponentPostProcessor postProcessor{result, m_Mode, components, componentMapping};
     return postProcessor.release();
   }
 
+  inline void TJsonModelLoader::addComponent(TResult& result, detail::ComponentMapping& componentMapping,
+                                             const database::TModel& dbModel, TComponents& components,
+                                             const json& component, detail::TJsonRecord* record) const
+  {
+    auto componentId = component["id"].get<uint64_t>();
+    std::string componentName = component.value("name", "");
+    try {
+      const auto& componentType = dbModel.findComponentById(component["type"].get<std::string>());
+      std::string context = componentName.empty() ? componentType.getName() : componentName;
+      TAttributes attributes = getAttributes(context, result, componentId, componentType, component, record);
+
+      components.emplace_back(TComponent{componentId, componentMapping.addComponent(componentId), componentType,
+                                         componentName, std::move(attributes)});
+    } catch (const std::exception& ex) {
+      result.addError(
+        TError{m_Mode.adapt(TErrorLevel::ERR), fmt::format("component id={}: {}", componentId, ex.what())});
+    }
+  }
+
   inline bool TJsonModelLoader::checkDuplicate(const TAttributes& attributes, const TAttribute& attribute)
   {
     auto it = std::find_if(attributes.begin(), attributes.end(), [&attribute](const auto& att) {
@@ -228,11 +513,18 @@ namespace rexsapi
 
   inline TAttributes TJsonModelLoader::getAttributes(std::string_view context, TResult& result, uint64_t componentId,
                                                      const database::TComponent& componentType,
-                                                     const json& component) const
+                                                     const json& component, detail::TJsonRecord* record,
+                                                     std::string_view recordPath) const
   {
     TAttributes attributes;
 
-    for (const auto& attribute : component["/attributes"_json_pointer]) {
+    const auto& componentAttributes = component["/attributes"_json_pointer];
+    for (size_t n = 0; n < componentAttributes.size(); ++n) {
+      const auto& attribute = componentAttributes[n];
+      // streamed records keep uncoded array and matrix values outside of the json value
+      detail::TJsonArrayValue* array = record != nullptr && !record->m_Arrays.empty()
+                                         ? record->findArray(fmt::format("{}/attributes/{}", recordPath, n))
+                                         : nullptr;
       auto id = attribute["id"].get<std::string>();
       auto unit = attribute.value("unit", "");
 
@@ -252,7 +544,8 @@ namespace rexsapi
                                  fmt::format("{}: specified incorrect type ({}) for attribute id={} of component id={}",
                                              context, toTypeString(type), id, componentId)});
         } else {
-          value = m_LoaderHelper.getValue(result, context, id, componentId, att, attribute);
+          value = array != nullptr ? m_LoaderHelper.getValue(result, context, id, componentId, att, *array)
+                                   : m_LoaderHelper.getValue(result, context, id, componentId, att, attribute);
         }
         TAttribute newAttribute{att, std::move(value)};
         if (checkDuplicate(attributes, newAttribute)) {
@@ -262,7 +555,8 @@ namespace rexsapi
         }
         attributes.emplace_back(std::move(newAttribute));
       } else {
-        auto value = m_LoaderHelper.getValue(result, type, context, id, componentId, attribute);
+        auto value = array != nullptr ? m_LoaderHelper.getValue(result, type, context, id, componentId, *array)
+                                      : m_LoaderHelper.getValue(result, type, context, id, componentId, attribute);
         attributes.emplace_back(TAttribute{id, TUnit{unit}, type, value});
       }
     }
@@ -276,49 +570,61 @@ namespace rexsapi
     TRelations relations;
     std::set<uint64_t> usedComponents;
     for (const auto& relation : j["/model/relations"_json_pointer]) {
-      auto relationId = relation["id"].get<uint64_t>();
-      try {
-        auto relationType = relationTypeFromString(relation["type"].get<std::string>());
-        std::optional<uint32_t> order;
-        if (relation.contains("order")) {
-          order = relation["order"].get<uint32_t>();
-        }
+      addRelation(result, componentMapping, components, usedComponents, relations, relation);
+    }
+    checkUsedComponents(result, components, usedComponents);
+
+    return relations;
+  }
+
+  inline void TJsonModelLoader::addRelation(TResult& result, const detail::ComponentMapping& componentMapping,
+                                            const TComponents& components, std::set<uint64_t>& usedComponents,
+                                            TRelations& relations, const json& relation) const
+  {
+    auto relationId = relation["id"].get<uint64_t>();
+    try {
+      auto relationType = relationTypeFromString(relation["type"].get<std::string>());
+      std::optional<uint32_t> order;
+      if (relation.contains("order")) {
+        order = relation["order"].get<uint32_t>();
+      }
+
+      TRelationReferences references;
+      for (const auto& reference : relation["/refs"_json_pointer]) {
+        auto referenceId = reference["id"].get<uint64_t>();
+        try {
+          auto hint = reference.value("hint", "");
+          auto role = relationRoleFromString(reference["role"]);
 
-        TRelationReferences references;
-        for (const auto& reference : relation["/refs"_json_pointer]) {
-          auto referenceId = reference["id"].get<uint64_t>();
-          try {
-            auto hint = reference.value("hint", "");
-            auto role = relationRoleFromString(reference["role"]);
-
-            const auto* component = componentMapping.getComponent(referenceId, components);
-            if (component == nullptr) {
-              result.addError(TError{
-                m_Mode.adapt(TErrorLevel::ERR),
-                fmt::format("relation id={} referenced component id={} does not exist", relationId, referenceId)});
-            } else {
-              usedComponents.emplace(component->getInternalId());
-              references.emplace_back(TRelationReference{role, hint, *component});
-            }
-          } catch (const std::exception& ex) {
-            result.addError(
-              TError{m_Mode.adapt(TErrorLevel::ERR), fmt::format("relation id={} cannot process reference id={}: {}",
-                                                                 relationId, referenceId, ex.what())});
+          const auto* component = componentMapping.getComponent(referenceId, components);
+          if (component == nullptr) {
+            result.addError(TError{
+              m_Mode.adapt(TErrorLevel::ERR),
+              fmt::format("relation id={} referenced component id={} does not exist", relationId, referenceId)});
+          } else {
+            usedComponents.emplace(component->getInternalId());
+            references.emplace_back(TRelationReference{role, hint, *component});
           }
+        } catch (const std::exception& ex) {
+          result.addError(
+            TError{m_Mode.adapt(TErrorLevel::ERR), fmt::format("relation id={} cannot process reference id={}: {}",
+                                                               relationId, referenceId, ex.what())});
         }
-
-        relations.emplace_back(TRelation{relationType, order, std::move(references)});
-      } catch (const std::exception& ex) {
-        result.addError(
-          TError{m_Mode.adapt(TErrorLevel::ERR), fmt::format("realtion id={}: {}", relationId, ex.what())});
       }
+
+      relations.emplace_back(TRelation{relationType, order, std::move(references)});
+    } catch (const std::exception& ex) {
+      result.addError(TError{m_Mode.adapt(TErrorLevel::ERR), fmt::format("realtion id={}: {}", relationId, ex.what())});
     }
+  }
+
+  inline void TJsonModelLoader::checkUsedComponents(TResult& result, const TComponents& components,
+                                                    const std::set<uint64_t>& usedComponents)
+  {
     if (usedComponents.size() != components.size()) {
       result.addError(TError{TErrorLevel::WARN, fmt::format("{} components are not used in a relation",
                                                             components.size() - usedComponents.size())});
     }
-
-    return relations;
   }
 
   inline TLoadCases TJsonModelLoader::getLoadCases(TResult& result, const detail::ComponentMapping& componentMapping,
@@ -331,32 +637,43 @@ namespace rexsapi
     }
 
     for (const auto& loadCase : j["/model/load_spectrum/load_cases"_json_pointer]) {
-      auto loadCaseId = loadCase["id"].get<uint64_t>();
-      TLoadComponents loadComponents;
+      loadCases.emplace_back(getLoadCase(result, componentMapping, components, dbModel, loadCase));
+    }
 
-      for (const auto& componentRef : loadCase["/components"_json_pointer]) {
-        auto componentId = componentRef["id"].get<uint64_t>();
-        try {
-          const auto* component = componentMapping.getComponent(componentId, components);
-          if (component == nullptr) {
-            result.addError(
-              TError{m_Mode.adapt(TErrorLevel::ERR),
-                     fmt::format("load_case id={} component id={} does not exist", loadCaseId, componentId)});
-            continue;
-          }
-          const auto context = fmt::format("load_case id={}", loadCaseId);
-          TAttributes attributes =
-            getAttributes(context, result, componentId, dbModel.findComponentById(component->getType()), componentRef);
-          loadComponents.emplace_back(TLoadComponent(*component, std::move(attributes)));
-        } catch (const std::exception& ex) {
-          result.addError(TError{m_Mode.adapt(TErrorLevel::ERR), fmt::format("load_case id={} component id={}: {}",
-                                                                             loadCaseId, componentId, ex.what())});
+    return loadCases;
+  }
+
+  inline TLoadCase TJsonModelLoader::getLoadCase(TResult& result, const detail::ComponentMapping& componentMapping,
+                                                 const TComponents& components, const database::TModel& dbModel,
+                                                 const json& loadCase, detail::TJsonRecord* record) const
+  {
+    auto loadCaseId = loadCase["id"].get<uint64_t>();
+    TLoadComponents loadComponents;
+
+    const auto& componentRefs = loadCase["/components"_json_pointer];
+    for (size_t n = 0; n < componentRefs.size(); ++n) {
+      const auto& componentRef = componentRefs[n];
+      auto componentId = componentRef["id"].get<uint64_t>();
+      try {
+        const auto* component = componentMapping.getComponent(componentId, components);
+        if (component == nullptr) {
+          result.addError(
+            TError{m_Mode.adapt(TErrorLevel::ERR),
+                   fmt::format("load_case id={} component id={} does not exist", loadCaseId, componentId)});
+          continue;
         }
+        const auto context = fmt::format("load_case id={}", loadCaseId);
+        TAttributes attributes =
+          getAttributes(context, result, componentId, dbModel.findComponentById(component->getType()), componentRef,
+                        record, record != nullptr ? fmt::format("/components/{}", n) : std::string{});
+        loadComponents.emplace_back(TLoadComponent(*component, std::move(attributes)));
+      } catch (const std::exception& ex) {
+        result.addError(TError{m_Mode.adapt(TErrorLevel::ERR), fmt::format("load_case id={} component id={}: {}",
+                                                                           loadCaseId, componentId, ex.what())});
       }
-      loadCases.emplace_back(std::move(loadComponents));
     }
 
-    return loadCases;
+    return TLoadCase{std::move(loadComponents)};
   }
 
   inline std::optional<TAccumulation>
@@ -369,26 +686,37 @@ namespace rexsapi
 
     TLoadComponents loadComponents;
     for (const auto& componentRef : j["/model/load_spectrum/accumulation/components"_json_pointer]) {
-      auto componentId = componentRef["id"].get<uint64_t>();
-      try {
-        const auto* component = componentMapping.getComponent(componentId, components);
-        if (component == nullptr) {
-          result.addError(TError{m_Mode.adapt(TErrorLevel::ERR),
-                                 fmt::format("accumulation component id={} does not exist", componentId)});
-          continue;
-        }
-        TAttributes attributes = getAttributes("accumulation", result, componentId,
-                                               dbModel.findComponentById(component->getType()), componentRef);
-        loadComponents.emplace_back(TLoadComponent(*component, std::move(attributes)));
-      } catch (const std::exception& ex) {
-        result.addError(TError{m_Mode.adapt(TErrorLevel::ERR),
-                               fmt::format("accumulation component id={}: {}", componentId, ex.what())});
-      }
+      addAccumulationComponent(result, componentMapping, components, dbModel, loadComponents, componentRef);
     }
 
     return TAccumulation{std::move(loadComponents)};
   }
 
+  inline void TJsonModelLoader::addAccumulationComponent(TResult& result,
+                                                         const detail::ComponentMapping& componentMapping,
+                                                         const TComponents& components,
+                                                         const database::TModel& dbModel,
+                                                         TLoadComponents& loadComponents,
+                                                         const json& componentRef,
+                                                         detail::TJsonRecord* record) const
+  {
+    auto componentId = componentRef["id"].get<uint64_t>();
+    try {
+      const auto* component = componentMapping.getComponent(componentId, components);
+      if (component == nullptr) {
+        result.addError(TError{m_Mode.adapt(TErrorLevel::ERR),
+                               fmt::format("accumulation component id={} does not exist", componentId)});
+        return;
+      }
+      TAttributes attributes = getAttributes("accumulation", result, componentId,
+                                             dbModel.findComponentById(component->getType()), componentRef, record);
+      loadComponents.emplace_back(TLoadComponent(*component, std::move(attributes)));
+    } catch (const std::exception& ex) {
+      result.addError(TError{m_Mode.adapt(TErrorLevel::ERR),
+                             fmt::format("accumulation component id={}: {}", componentId, ex.what())});
+    }
+  }
+
   inline TValueType TJsonModelLoader::getValueType(const json& attribute)
   {
     for (const auto& [key, _] : attribute.items()) {
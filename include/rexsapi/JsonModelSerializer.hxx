@@ -19,9 +19,11 @@
 
 #include <rexsapi/CodedValue.hxx>
 #include <rexsapi/Json.hxx>
+#include <rexsapi/JsonStreamWriter.hxx>
 #include <rexsapi/Model.hxx>
 
 #include <iostream>
+#include <type_traits>
 
 namespace rexsapi
 {
@@ -43,17 +45,49 @@ namespace rexsapi
      * @param model The model to serialize
      * @param serializer The serializer to output the serialized model with
      */
-    template<typename TSerializer>
+    template<typename TSerializer, typename = std::enable_if_t<!std::is_base_of_v<std::ostream, TSerializer>>>
     void serialize(const TModel& model, TSerializer& serializer);
 
+    /**
+     * @brief Serializes a TModel in REXS json format directly to a stream.
+     *
+     * Does not create a json object, the model is written piece by piece to the stream using a bounded buffer. The
+     * layout is the same as the one of the TJsonStringSerializer, no UTF-8 BOM will be written.
+     *
+     * @param model The model to serialize
+     * @param stream The stream to write the model to
+     * @param indent The amount of indentation for nested structures. Set to -1 for the most compact format.
+     * @throws TException if the model cannot be serialized or the stream cannot be written
+     */
+    void serialize(const TModel& model, std::ostream& stream, int indent = 2);
+
   private:
-    void serialize(ordered_json& model, const TModelInfo& info) const;
-    void serialize(ordered_json& model, const TComponents& components);
-    void serialize(ordered_json& componentNode, const TComponent& component);
-    void serialize(ordered_json& component, const TAttributes& attributes);
-    void serialize(ordered_json& attributeNode, const TAttribute& attribute);
-    void serialize(ordered_json& model, const TRelations& relations);
-    void serialize(ordered_json& model, const TLoadSpectrum& spectrum);
+    template<typename TWriter>
+    void serializeModel(TWriter& writer, const TModel& model);
+
+    template<typename TWriter>
+    void serialize(TWriter& writer, const TModelInfo& info) const;
+
+    template<typename TWriter>
+    void serialize(TWriter& writer, const TComponents& components);
+
+    template<typename TWriter>
+    void serialize(TWriter& writer, const TComponent& component);
+
+    template<typename TWriter>
+    void serialize(TWriter& writer, const TAttributes& attributes);
+
+    template<typename TWriter>
+    void serialize(TWriter& writer, const TAttribute& attribute);
+
+    template<typename TWriter>
+    void serialize(TWriter& writer, const TRelations& relations);
+
+    template<typename TWriter>
+    void serialize(TWriter& writer, const TLoadSpectrum& spectrum);
+
+    template<typename TWriter>
+    void serialize(TWriter& writer, const TLoadComponents& components);
 
     uint64_t getNextComponentId() noexcept
     {
@@ -67,292 +101,437 @@ namespace rexsapi
 
     uint64_t getComponentId(uint64_t internalId) const;
 
-    ordered_json m_Doc;
     uint64_t m_ComponentId{0};
     uint64_t m_RelationId{0};
     std::unordered_map<uint64_t, uint64_t> m_ComponentMapping;
   };
 
 
+  namespace detail
+  {
+    /**
+     * @brief Event based json writer creating an ordered_json object.
+     *
+     * Offers the same interface as the TJsonStreamWriter.
+     */
+    class TJsonDocumentWriter
+    {
+    public:
+      explicit TJsonDocumentWriter(ordered_json& doc)
+      : m_Doc{doc}
+      {
+      }
+
+      void startObject()
+      {
+        auto& node = next();
+        node = ordered_json::object();
+        m_Nodes.emplace_back(&node);
+      }
+
+      void endObject()
+      {
+        m_Nodes.pop_back();
+      }
+
+      void startArray()
+      {
+        auto& node = next();
+        node = ordered_json::array();
+        m_Nodes.emplace_back(&node);
+      }
+
+      void endArray()
+      {
+        m_Nodes.pop_back();
+      }
+
+      void key(std::string_view name)
+      {
+        m_Key = name;
+      }
+
+      void string(std::string_view value)
+      {
+        next() = value;
+      }
+
+      template<typename T>
+      void number(T value)
+      {
+        next() = value;
+      }
+
+      void boolean(bool value)
+      {
+        next() = value;
+      }
+
+      void null()
+      {
+        next() = nullptr;
+      }
+
+      void endDocument() const noexcept
+      {
+      }
+
+    private:
+      ordered_json& next();
+
+      ordered_json& m_Doc;
+      std::vector<ordered_json*> m_Nodes;
+      std::string m_Key;
+    };
+  }
+
+
   /////////////////////////////////////////////////////////////////////////////
   // Implementation
   /////////////////////////////////////////////////////////////////////////////
 
-  template<typename TSerializer>
-  inline void TJsonModelSerializer::serialize(const TModel& model, TSerializer& serializer)
+  inline ordered_json& detail::TJsonDocumentWriter::next()
   {
-    m_Doc.clear();
-
-    ordered_json models;
-    serialize(models, model.getInfo());
-    models["relations"] = json::array();
-    models["components"] = json::array();
-    serialize(models, model.getComponents());
-    serialize(models, model.getRelations());
-    if (model.getLoadSpectrum().hasLoadCases()) {
-      serialize(models, model.getLoadSpectrum());
+    if (m_Nodes.empty()) {
+      return m_Doc;
     }
-    m_Doc["model"] = std::move(models);
-
-    serializer.serialize(m_Doc);
+    // only the last node of every open container is ever written, so the pointers stay valid
+    auto& node = *m_Nodes.back();
+    if (node.is_array()) {
+      return node.emplace_back(nullptr);
+    }
+    return node[m_Key];
   }
 
-  inline void TJsonModelSerializer::serialize(ordered_json& model, const TModelInfo& info) const
+  template<typename TSerializer, typename>
+  inline void TJsonModelSerializer::serialize(const TModel& model, TSerializer& serializer)
   {
-    model["applicationId"] = info.getApplicationId();
-    model["applicationVersion"] = info.getApplicationVersion();
-    model["date"] = info.getDate();
-    model["version"] = info.getVersion().asString();
-    if (info.getApplicationLanguage().has_value()) {
-      model["applicationLanguage"] = *info.getApplicationLanguage();
-    }
+    ordered_json doc;
+    detail::TJsonDocumentWriter writer{doc};
+    serializeModel(writer, model);
+    serializer.serialize(doc);
   }
 
-  inline void TJsonModelSerializer::serialize(ordered_json& model, const TComponents& components)
+  inline void TJsonModelSerializer::serialize(const TModel& model, std::ostream& stream, int indent)
   {
-    auto& componentsNode = model["components"];
+    detail::TJsonStreamWriter writer{stream, indent};
+    serializeModel(writer, model);
+  }
 
-    for (const auto& component : components) {
-      auto id = getNextComponentId();
-      m_ComponentMapping.emplace(component.getInternalId(), id);
+  template<typename TWriter>
+  inline void TJsonModelSerializer::serializeModel(TWriter& writer, const TModel& model)
+  {
+    m_ComponentId = 0;
+    m_RelationId = 0;
+    m_ComponentMapping.clear();
+    for (const auto& component : model.getComponents()) {
+      m_ComponentMapping.emplace(component.getInternalId(), getNextComponentId());
     }
 
-    for (const auto& component : components) {
-      ordered_json componentNode;
-      serialize(componentNode, component);
-      serialize(componentNode, component.getAttributes());
+    writer.startObject();
+    writer.key("model");
+    writer.startObject();
+    serialize(writer, model.getInfo());
+    serialize(writer, model.getRelations());
+    serialize(writer, model.getComponents());
+    if (model.getLoadSpectrum().hasLoadCases()) {
+      serialize(writer, model.getLoadSpectrum());
+    }
+    writer.endObject();
+    writer.endObject();
+    writer.endDocument();
+  }
 
-      componentsNode.emplace_back(std::move(componentNode));
+  template<typename TWriter>
+  inline void TJsonModelSerializer::serialize(TWriter& writer, const TModelInfo& info) const
+  {
+    writer.key("applicationId");
+    writer.string(info.getApplicationId());
+    writer.key("applicationVersion");
+    writer.string(info.getApplicationVersion());
+    writer.key("date");
+    writer.string(info.getDate());
+    writer.key("version");
+    writer.string(info.getVersion().asString());
+    if (info.getApplicationLanguage().has_value()) {
+      writer.key("applicationLanguage");
+      writer.string(*info.getApplicationLanguage());
     }
   }
 
-  inline void TJsonModelSerializer::serialize(ordered_json& componentNode, const TComponent& component)
+  template<typename TWriter>
+  inline void TJsonModelSerializer::serialize(TWriter& writer, const TComponents& components)
   {
-    componentNode["id"] = getComponentId(component.getInternalId());
-    componentNode["type"] = component.getType();
-    componentNode["name"] = component.getName();
+    writer.key("components");
+    writer.startArray();
+    for (const auto& component : components) {
+      writer.startObject();
+      serialize(writer, component);
+      serialize(writer, component.getAttributes());
+      writer.endObject();
+    }
+    writer.endArray();
   }
 
-  inline void TJsonModelSerializer::serialize(ordered_json& componentNode, const TAttributes& attributes)
+  template<typename TWriter>
+  inline void TJsonModelSerializer::serialize(TWriter& writer, const TComponent& component)
   {
-    componentNode["attributes"] = json::array();
-    auto& attributesNode = componentNode["attributes"];
+    writer.key("id");
+    writer.number(getComponentId(component.getInternalId()));
+    writer.key("type");
+    writer.string(component.getType());
+    writer.key("name");
+    writer.string(component.getName());
+  }
 
+  template<typename TWriter>
+  inline void TJsonModelSerializer::serialize(TWriter& writer, const TAttributes& attributes)
+  {
+    writer.key("attributes");
+    writer.startArray();
     for (const auto& attribute : attributes) {
-      ordered_json attributeNode;
-      attributeNode["id"] = attribute.getAttributeId();
-      attributeNode["unit"] = attribute.getUnit().getName();
-      serialize(attributeNode, attribute);
-
-      attributesNode.emplace_back(std::move(attributeNode));
+      writer.startObject();
+      writer.key("id");
+      writer.string(attribute.getAttributeId());
+      writer.key("unit");
+      writer.string(attribute.getUnit().getName());
+      serialize(writer, attribute);
+      writer.endObject();
     }
+    writer.endArray();
   }
 
-  template<typename T>
-  inline void encodeCodedArray(ordered_json& j, TCodeType type, const std::vector<T>& array)
+  template<typename TWriter, typename T>
+  inline void encodeCodedArray(TWriter& writer, TCodeType type, const std::vector<T>& array)
   {
     if (type != TCodeType::None) {
-      j = json::object();
       auto [val, code] = detail::encodeArray(array, type);
-      j["code"] = detail::toCodedValueString(code);
-      j["value"] = std::move(val);
+      writer.startObject();
+      writer.key("code");
+      writer.string(detail::toCodedValueString(code));
+      writer.key("value");
+      writer.string(val);
+      writer.endObject();
     } else {
-      j = json::array();
+      writer.startArray();
       for (const auto& element : array) {
-        j.emplace_back(element);
+        writer.number(element);
       }
+      writer.endArray();
     }
   }
 
-  template<typename T>
-  inline void encodeCodedMatrix(ordered_json& j, TCodeType type, const TMatrix<T>& matrix)
+  template<typename TWriter, typename T>
+  inline void encodeCodedMatrix(TWriter& writer, TCodeType type, const TMatrix<T>& matrix)
   {
     if (type != TCodeType::None) {
-      j = json::object();
       auto [val, code] = detail::encodeMatrix(matrix, type);
-      j["code"] = detail::toCodedValueString(code);
-      j["rows"] = matrix.m_Values.size();
-      j["columns"] = matrix.m_Values.size();
-      j["value"] = std::move(val);
+      writer.startObject();
+      writer.key("code");
+      writer.string(detail::toCodedValueString(code));
+      writer.key("rows");
+      writer.number(matrix.getRowCount());
+      writer.key("columns");
+      writer.number(matrix.getColumnCount());
+      writer.key("value");
+      writer.string(val);
+      writer.endObject();
     } else {
-      j = json::array();
-      for (const auto& row : matrix.m_Values) {
-        auto columns = json::array();
-        for (const auto& column : row) {
-          columns.emplace_back(column);
+      writer.startArray();
+      for (size_t row = 0; row < matrix.getRowCount(); ++row) {
+        writer.startArray();
+        for (const auto& column : matrix.getRow(row)) {
+          writer.number(column);
         }
-        j.emplace_back(std::move(columns));
+        writer.endArray();
       }
+      writer.endArray();
     }
   }
 
-  inline void TJsonModelSerializer::serialize(ordered_json& attributeNode, const TAttribute& attribute)
+  template<typename TWriter>
+  inline void TJsonModelSerializer::serialize(TWriter& writer, const TAttribute& attribute)
   {
     auto typeName = toTypeString(attribute.getValueType());
     if (attribute.getValue().coded() != TCodeType::None) {
       typeName += "_coded";
     }
-    attributeNode[typeName] = nullptr;
-    auto& j = attributeNode[typeName];
+    writer.key(typeName);
     if (attribute.getValue().isEmpty()) {
+      writer.null();
       return;
     }
 
-    rexsapi::dispatch<void>(attribute.getValueType(), attribute.getValue(),
-                            {[&j](rexsapi::TFloatTag, const auto& d) -> void {
-                               j = d;
-                             },
-                             [&j](rexsapi::TBoolTag, const auto& b) -> void {
-                               j = b;
-                             },
-                             [&j](rexsapi::TIntTag, const auto& i) -> void {
-                               j = i;
-                             },
-                             [&j](rexsapi::TEnumTag, const auto& s) -> void {
-                               j = s;
-                             },
-                             [&j](rexsapi::TStringTag, const auto& s) -> void {
-                               j = s;
-                             },
-                             [&j](rexsapi::TFileReferenceTag, const auto& s) -> void {
-                               j = s;
-                             },
-                             [&j](rexsapi::TDatetimeTag, const auto& d) -> void {
-                               j = d.asUTCString();
-                             },
-                             [&j, &attribute](rexsapi::TFloatArrayTag, const auto& a) -> void {
-                               encodeCodedArray(j, attribute.getValue().coded(), a);
-                             },
-                             [&j](rexsapi::TBoolArrayTag, const auto& a) -> void {
-                               j = json::array();
-                               for (const auto& element : a) {
-                                 j.emplace_back(*element);
-                               }
-                             },
-                             [&j, &attribute](rexsapi::TIntArrayTag, const auto& a) -> void {
-                               encodeCodedArray(j, attribute.getValue().coded(), a);
-                             },
-                             [&j](rexsapi::TEnumArrayTag, const auto& a) -> void {
-                               j = json::array();
-                               for (const auto& element : a) {
-                                 j.emplace_back(element);
-                               }
-                             },
-                             [&j](rexsapi::TStringArrayTag, const auto& a) -> void {
-                               j = json::array();
-                               for (const auto& element : a) {
-                                 j.emplace_back(element);
-                               }
-                             },
-                             [&j, &attribute, this](rexsapi::TReferenceComponentTag, const auto& n) -> void {
-                               if (attribute.getAttributeId() == "referenced_component_id") {
-                                 j = n;
-                               } else {
-                                 j = getComponentId(static_cast<uint64_t>(n));
-                               }
-                             },
-                             [&j, &attribute](rexsapi::TFloatMatrixTag, const auto& m) -> void {
-                               encodeCodedMatrix(j, attribute.getValue().coded(), m);
-                             },
-                             [&j, &attribute](rexsapi::TIntMatrixTag, const auto& m) -> void {
-                               encodeCodedMatrix(j, attribute.getValue().coded(), m);
-                             },
-                             [&j](rexsapi::TBoolMatrixTag, const auto& m) -> void {
-                               j = json::array();
-                               for (const auto& row : m.m_Values) {
-                                 auto columns = json::array();
-                                 for (const auto& column : row) {
-                                   columns.emplace_back(*column);
-                                 }
-                                 j.emplace_back(std::move(columns));
-                               }
-                             },
-                             [&j](rexsapi::TStringMatrixTag, const auto& m) -> void {
-                               j = json::array();
-                               for (const auto& row : m.m_Values) {
-                                 auto columns = json::array();
-                                 for (const auto& column : row) {
-                                   columns.emplace_back(column);
-                                 }
-                                 j.emplace_back(std::move(columns));
-                               }
-                             },
-                             [&j](rexsapi::TArrayOfIntArraysTag, const auto& a) -> void {
-                               j = json::array();
-                               for (const auto& array : a) {
-                                 auto columns = json::array();
-                                 for (const auto& column : array) {
-                                   columns.emplace_back(column);
-                                 }
-                                 j.emplace_back(std::move(columns));
-                               }
-                             }});
+    auto writeStrings = [&writer](const auto& elements) {
+      writer.startArray();
+      for (const auto& element : elements) {
+        writer.string(element);
+      }
+      writer.endArray();
+    };
+
+    rexsapi::visitValue(
+      attribute.getValueType(), attribute.getValue(),
+      detail::overload{[&writer](rexsapi::TFloatTag, const auto& d) -> void {
+                         writer.number(d);
+                       },
+                       [&writer](rexsapi::TBoolTag, const auto& b) -> void {
+                         writer.boolean(b);
+                       },
+                       [&writer](rexsapi::TIntTag, const auto& i) -> void {
+                         writer.number(i);
+                       },
+                       [&writer](rexsapi::TEnumTag, const auto& s) -> void {
+                         writer.string(s);
+                       },
+                       [&writer](rexsapi::TStringTag, const auto& s) -> void {
+                         writer.string(s);
+                       },
+                       [&writer](rexsapi::TFileReferenceTag, const auto& s) -> void {
+                         writer.string(s);
+                       },
+                       [&writer](rexsapi::TDatetimeTag, const auto& d) -> void {
+                         writer.string(d.asUTCString());
+                       },
+                       [&writer, &attribute](rexsapi::TFloatArrayTag, const auto& a) -> void {
+                         encodeCodedArray(writer, attribute.getValue().coded(), a);
+                       },
+                       [&writer](rexsapi::TBoolArrayTag, const auto& a) -> void {
+                         writer.startArray();
+                         for (const auto& element : a) {
+                           writer.boolean(*element);
+                         }
+                         writer.endArray();
+                       },
+                       [&writer, &attribute](rexsapi::TIntArrayTag, const auto& a) -> void {
+                         encodeCodedArray(writer, attribute.getValue().coded(), a);
+                       },
+                       [&writeStrings](rexsapi::TEnumArrayTag, const auto& a) -> void {
+                         writeStrings(a);
+                       },
+                       [&writeStrings](rexsapi::TStringArrayTag, const auto& a) -> void {
+                         writeStrings(a);
+                       },
+                       [&writer, &attribute, this](rexsapi::TReferenceComponentTag, const auto& n) -> void {
+                         if (attribute.getAttributeId() == "referenced_component_id") {
+                           writer.number(n);
+                         } else {
+                           writer.number(getComponentId(static_cast<uint64_t>(n)));
+                         }
+                       },
+                       [&writer, &attribute](rexsapi::TFloatMatrixTag, const auto& m) -> void {
+                         encodeCodedMatrix(writer, attribute.getValue().coded(), m);
+                       },
+                       [&writer, &attribute](rexsapi::TIntMatrixTag, const auto& m) -> void {
+                         encodeCodedMatrix(writer, attribute.getValue().coded(), m);
+                       },
+                       [&writer](rexsapi::TBoolMatrixTag, const auto& m) -> void {
+                         writer.startArray();
+                         for (size_t row = 0; row < m.getRowCount(); ++row) {
+                           writer.startArray();
+                           for (const auto& column : m.getRow(row)) {
+                             writer.boolean(*column);
+                           }
+                           writer.endArray();
+                         }
+                         writer.endArray();
+                       },
+                       [&writer, &writeStrings](rexsapi::TStringMatrixTag, const auto& m) -> void {
+                         writer.startArray();
+                         for (size_t row = 0; row < m.getRowCount(); ++row) {
+                           writeStrings(m.getRow(row));
+                         }
+                         writer.endArray();
+                       },
+                       [&writer](rexsapi::TArrayOfIntArraysTag, const auto& a) -> void {
+                         writer.startArray();
+                         for (const auto& array : a) {
+                           writer.startArray();
+                           for (const auto& column : array) {
+                             writer.number(column);
+                           }
+                           writer.endArray();
+                         }
+                         writer.endArray();
+                       }});
   }
 
-  inline void TJsonModelSerializer::serialize(ordered_json& model, const TRelations& relations)
+  template<typename TWriter>
+  inline void TJsonModelSerializer::serialize(TWriter& writer, const TRelations& relations)
   {
-    auto& relationsNode = model["relations"];
-
+    writer.key("relations");
+    writer.startArray();
     for (const auto& relation : relations) {
-      ordered_json relationNode;
-      relationNode["id"] = getNextRelationId();
-      relationNode["type"] = toRelationTypeString(relation.getType());
+      writer.startObject();
+      writer.key("id");
+      writer.number(getNextRelationId());
+      writer.key("type");
+      writer.string(toRelationTypeString(relation.getType()));
       if (relation.getOrder().has_value()) {
-        relationNode["order"] = *relation.getOrder();
+        writer.key("order");
+        writer.number(*relation.getOrder());
       }
 
-      relationNode["refs"] = json::array();
-      auto& referencesNode = relationNode["refs"];
+      writer.key("refs");
+      writer.startArray();
       for (const auto& reference : relation.getReferences()) {
-        ordered_json referenceNode;
-        auto id = getComponentId(reference.getComponent().getInternalId());
-        referenceNode["id"] = id;
-        referenceNode["role"] = toRelationRoleString(reference.getRole());
+        writer.startObject();
+        writer.key("id");
+        writer.number(getComponentId(reference.getComponent().getInternalId()));
+        writer.key("role");
+        writer.string(toRelationRoleString(reference.getRole()));
         if (!reference.getHint().empty()) {
-          referenceNode["hint"] = reference.getHint();
+          writer.key("hint");
+          writer.string(reference.getHint());
         }
-
-        referencesNode.emplace_back(std::move(referenceNode));
+        writer.endObject();
       }
-
-      relationsNode.emplace_back(std::move(relationNode));
+      writer.endArray();
+      writer.endObject();
     }
+    writer.endArray();
   }
 
-  inline void TJsonModelSerializer::serialize(ordered_json& model, const TLoadSpectrum& spectrum)
+  template<typename TWriter>
+  inline void TJsonModelSerializer::serialize(TWriter& writer, const TLoadSpectrum& spectrum)
   {
-    model["load_spectrum"] = ordered_json{};
-    auto& spectrumNode = model["load_spectrum"];
-    spectrumNode["id"] = 1;
+    writer.key("load_spectrum");
+    writer.startObject();
+    writer.key("id");
+    writer.number(1);
+    writer.key("load_cases");
+    writer.startArray();
     uint64_t loadCaseId{0};
-    spectrumNode["load_cases"] = json::array();
-    auto& loadCases = spectrumNode["load_cases"];
     for (const auto& loadCase : spectrum.getLoadCases()) {
-      ordered_json loadCaseNode;
-      loadCaseNode["id"] = ++loadCaseId;
-      loadCaseNode["components"] = json::array();
-      auto& components = loadCaseNode["components"];
-      for (const auto& component : loadCase.getLoadComponents()) {
-        ordered_json componentNode;
-        serialize(componentNode, component.getComponent());
-        serialize(componentNode, component.getLoadAttributes());
-        components.emplace_back(std::move(componentNode));
-      }
-      loadCases.emplace_back(std::move(loadCaseNode));
+      writer.startObject();
+      writer.key("id");
+      writer.number(++loadCaseId);
+      serialize(writer, loadCase.getLoadComponents());
+      writer.endObject();
     }
+    writer.endArray();
 
     if (spectrum.hasAccumulation()) {
-      spectrumNode["accumulation"] = ordered_json{};
-      auto& accumulationNode = spectrumNode["accumulation"];
-      accumulationNode["components"] = json::array();
-      auto& components = accumulationNode["components"];
-      for (const auto& component : spectrum.getAccumulation().getLoadComponents()) {
-        ordered_json componentNode;
-        serialize(componentNode, component.getComponent());
-        serialize(componentNode, component.getLoadAttributes());
-        components.emplace_back(std::move(componentNode));
-      }
+      writer.key("accumulation");
+      writer.startObject();
+      serialize(writer, spectrum.getAccumulation().getLoadComponents());
+      writer.endObject();
+    }
+    writer.endObject();
+  }
+
+  template<typename TWriter>
+  inline void TJsonModelSerializer::serialize(TWriter& writer, const TLoadComponents& components)
+  {
+    writer.key("components");
+    writer.startArray();
+    for (const auto& component : components) {
+      writer.startObject();
+      serialize(writer, component.getComponent());
+      serialize(writer, component.getLoadAttributes());
+      writer.endObject();
     }
+    writer.endArray();
   }
 
   inline uint64_t TJsonModelSerializer::getComponentId(uint64_t internalId) const
@@ -0,0 +1,366 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_JSON_STREAM_READER_HXX
+#define REXSAPI_JSON_STREAM_READER_HXX
+
+#include <rexsapi/Exception.hxx>
+#include <rexsapi/Json.hxx>
+#include <rexsapi/JsonValueDecoder.hxx>
+
+#include <algorithm>
+#include <functional>
+#include <istream>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace rexsapi::detail
+{
+  /**
+   * @brief A single record read by the TJsonStreamReader.
+   *
+   * Uncoded array and matrix attribute values are not part of the json value of the record. Their elements are
+   * collected into TJsonArrayValue objects while reading and the value in the record is set to null.
+   */
+  struct TJsonRecord {
+    /**
+     * @brief Returns the array value of an attribute object.
+     *
+     * @param path The json pointer path of the attribute object relative to the record, e.g. "/attributes/3"
+     * @return TJsonArrayValue* The array value or nullptr if the attribute has no array value
+     */
+    TJsonArrayValue* findArray(std::string_view path) noexcept
+    {
+      const auto it = std::find_if(m_Arrays.begin(), m_Arrays.end(), [&path](const auto& array) {
+        return array.first == path;
+      });
+      return it == m_Arrays.end() ? nullptr : &it->second;
+    }
+
+    rexsapi::json m_Value;
+    std::vector<std::pair<std::string, TJsonArrayValue>> m_Arrays{};
+    std::vector<std::string> m_Errors{};
+  };
+
+  /**
+   * @brief Reads a json document from a stream and hands out the elements of selected arrays one by one.
+   *
+   * The reader uses the nlohmann sax interface. Elements of the configured record arrays are reported to a callback as
+   * soon as they have been read and will not be kept in the document. All other values are collected into the
+   * resulting document, so only the document skeleton and a single record are in memory at any time. Elements of
+   * uncoded array and matrix attribute values in records are not stored as json values, see TJsonRecord.
+   */
+  class TJsonStreamReader
+  {
+  public:
+    using json = rexsapi::json;
+
+    /**
+     * @brief Callback for a completely read record.
+     *
+     * Gets the reader, the index of the record array in the configured paths, and the record itself. Returning false
+     * stops reading.
+     */
+    using TRecordCallback = std::function<bool(const TJsonStreamReader& reader, size_t container, TJsonRecord& record)>;
+
+    /**
+     * @brief Callback for the end of a record array.
+     *
+     * Gets the reader and the index of the record array in the configured paths. Returning false stops reading.
+     */
+    using TContainerCallback = std::function<bool(const TJsonStreamReader& reader, size_t container)>;
+
+    /**
+     * @brief Constructs a new TJsonStreamReader object.
+     *
+     * @param containers The json pointer paths of the record arrays, e.g. "/model/components"
+     * @param onRecord Will be called for every element of a record array
+     * @param onEnd Will be called once a record array has been read completely
+     */
+    TJsonStreamReader(std::vector<std::string> containers, TRecordCallback onRecord, TContainerCallback onEnd)
+    : m_Containers{std::move(containers)}
+    , m_OnRecord{std::move(onRecord)}
+    , m_OnEnd{std::move(onEnd)}
+    {
+    }
+
+    /**
+     * @brief Reads the json document from the stream.
+     *
+     * @param stream The stream to read from
+     * @return std::optional<json> The document without the records. Empty, if a callback stopped reading.
+     * @throws TException if the document cannot be parsed
+     */
+    std::optional<json> read(std::istream& stream);
+
+    /**
+     * @brief Returns a value of the document while it is being read.
+     *
+     * Can be used from within the callbacks to access values of enclosing objects that have already been read.
+     *
+     * @param path The json pointer path of the enclosing object
+     * @return const json* The object read so far, nullptr if the object at the path is not currently being read
+     */
+    [[nodiscard]] const json* findOpenValue(std::string_view path) const;
+
+    // sax interface for nlohmann::json::sax_parse
+    bool null();
+    bool boolean(bool val);
+    bool number_integer(json::number_integer_t val);
+    bool number_unsigned(json::number_unsigned_t val);
+    bool number_float(json::number_float_t val, const json::string_t& s);
+    bool string(json::string_t& val);
+    bool binary(json::binary_t& val);
+    bool start_object(std::size_t elements);
+    bool key(json::string_t& val);
+    bool end_object();
+    bool start_array(std::size_t elements);
+    bool end_array();
+    [[noreturn]] bool parse_error(std::size_t position, const std::string& lastToken, const json::exception& ex);
+
+  private:
+    static constexpr size_t NoContainer = std::numeric_limits<size_t>::max();
+
+    struct TFrame {
+      json m_Value;
+      std::string m_Path;
+      std::string m_Key{};
+      size_t m_Container{NoContainer};
+    };
+
+    bool addValue(json value);
+    bool startContainer(json value);
+    bool endContainer();
+    bool endArrayValue();
+    std::string getRecordPath() const;
+
+    std::vector<std::string> m_Containers;
+    TRecordCallback m_OnRecord;
+    TContainerCallback m_OnEnd;
+    std::vector<TFrame> m_Stack;
+    json m_Root;
+    size_t m_RecordFrame{NoContainer};
+    std::optional<TJsonArrayValue> m_Array{};
+    std::vector<std::pair<std::string, TJsonArrayValue>> m_RecordArrays{};
+    std::vector<std::string> m_RecordErrors{};
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  inline std::optional<rexsapi::json> TJsonStreamReader::read(std::istream& stream)
+  {
+    m_Stack.clear();
+    m_Root = json{};
+    m_RecordFrame = NoContainer;
+    m_Array.reset();
+    m_RecordArrays.clear();
+    m_RecordErrors.clear();
+    if (!json::sax_parse(stream, this)) {
+      return {};
+    }
+    return std::move(m_Root);
+  }
+
+  inline const rexsapi::json* TJsonStreamReader::findOpenValue(std::string_view path) const
+  {
+    const auto it = std::find_if(m_Stack.begin(), m_Stack.end(), [&path](const auto& frame) {
+      return frame.m_Path == path;
+    });
+    return it == m_Stack.end() ? nullptr : &it->m_Value;
+  }
+
+  inline bool TJsonStreamReader::null()
+  {
+    return addValue(json{});
+  }
+
+  inline bool TJsonStreamReader::boolean(bool val)
+  {
+    return addValue(json(val));
+  }
+
+  inline bool TJsonStreamReader::number_integer(json::number_integer_t val)
+  {
+    return addValue(json(val));
+  }
+
+  inline bool TJsonStreamReader::number_unsigned(json::number_unsigned_t val)
+  {
+    return addValue(json(val));
+  }
+
+  inline bool TJsonStreamReader::number_float(json::number_float_t val, const json::string_t&)
+  {
+    return addValue(json(val));
+  }
+
+  inline bool TJsonStreamReader::string(json::string_t& val)
+  {
+    return addValue(json(std::move(val)));
+  }
+
+  inline bool TJsonStreamReader::binary(json::binary_t& val)
+  {
+    return addValue(json::binary(std::move(val)));
+  }
+
+  inline bool TJsonStreamReader::start_object(std::size_t)
+  {
+    if (m_Array) {
+      m_Array->startObject();
+      return true;
+    }
+    return startContainer(json::object());
+  }
+
+  inline bool TJsonStreamReader::key(json::string_t& val)
+  {
+    if (!m_Array) {
+      m_Stack.back().m_Key = std::move(val);
+    }
+    return true;
+  }
+
+  inline bool TJsonStreamReader::end_object()
+  {
+    if (m_Array) {
+      m_Array->end();
+      return true;
+    }
+    return endContainer();
+  }
+
+  inline bool TJsonStreamReader::start_array(std::size_t)
+  {
+    if (m_Array) {
+      m_Array->startArray();
+      return true;
+    }
+    if (m_RecordFrame != NoContainer && m_Stack.back().m_Value.is_object()) {
+      if (const auto type = TJsonArrayValue::typeFromKey(m_Stack.back().m_Key); type) {
+        m_Array.emplace(*type);
+        m_Array->startArray();
+        return true;
+      }
+    }
+    return startContainer(json::array());
+  }
+
+  inline bool TJsonStreamReader::end_array()
+  {
+    if (m_Array) {
+      m_Array->end();
+      return m_Array->isComplete() ? endArrayValue() : true;
+    }
+    return endContainer();
+  }
+
+  inline bool TJsonStreamReader::parse_error(std::size_t, const std::string&, const json::exception& ex)
+  {
+    throw TException{ex.what()};
+  }
+
+  inline bool TJsonStreamReader::addValue(json value)
+  {
+    if (m_Array) {
+      m_Array->add(std::move(value));
+      return true;
+    }
+    if (m_Stack.empty()) {
+      m_Root = std::move(value);
+      return true;
+    }
+
+    auto& parent = m_Stack.back();
+    if (parent.m_Value.is_object()) {
+      parent.m_Value[parent.m_Key] = std::move(value);
+    } else if (parent.m_Container != NoContainer) {
+      TJsonRecord record{std::move(value)};
+      return m_OnRecord(*this, parent.m_Container, record);
+    } else {
+      parent.m_Value.push_back(std::move(value));
+    }
+    return true;
+  }
+
+  inline bool TJsonStreamReader::startContainer(json value)
+  {
+    std::string path;
+    if (!m_Stack.empty()) {
+      const auto& parent = m_Stack.back();
+      path = parent.m_Path + "/" + (parent.m_Value.is_object() ? parent.m_Key : "-");
+      if (parent.m_Container != NoContainer) {
+        m_RecordFrame = m_Stack.size();
+      }
+    }
+    size_t container = NoContainer;
+    if (value.is_array()) {
+      if (const auto it = std::find(m_Containers.begin(), m_Containers.end(), path); it != m_Containers.end()) {
+        container = static_cast<size_t>(std::distance(m_Containers.begin(), it));
+      }
+    }
+    m_Stack.emplace_back(TFrame{std::move(value), std::move(path), {}, container});
+    return true;
+  }
+
+  inline bool TJsonStreamReader::endContainer()
+  {
+    auto frame = std::move(m_Stack.back());
+    m_Stack.pop_back();
+    if (frame.m_Container != NoContainer && !m_OnEnd(*this, frame.m_Container)) {
+      return false;
+    }
+    if (m_RecordFrame == m_Stack.size()) {
+      m_RecordFrame = NoContainer;
+      TJsonRecord record{std::move(frame.m_Value), std::move(m_RecordArrays), std::move(m_RecordErrors)};
+      m_RecordArrays.clear();
+      m_RecordErrors.clear();
+      return m_OnRecord(*this, m_Stack.back().m_Container, record);
+    }
+    return addValue(std::move(frame.m_Value));
+  }
+
+  inline bool TJsonStreamReader::endArrayValue()
+  {
+    if (const auto& error = m_Array->getError(); error) {
+      m_RecordErrors.emplace_back(fmt::format("{}/{}: {}", getRecordPath(), m_Stack.back().m_Key, *error));
+    } else {
+      m_RecordArrays.emplace_back(getRecordPath(), std::move(*m_Array));
+    }
+    m_Array.reset();
+    // all uncoded array and matrix values may be null in the schema, so the record stays valid
+    return addValue(json{});
+  }
+
+  inline std::string TJsonStreamReader::getRecordPath() const
+  {
+    // only built for diverted array values, open containers are not yet part of the value of their parent
+    std::string path;
+    for (size_t n = m_RecordFrame + 1; n < m_Stack.size(); ++n) {
+      const auto& parent = m_Stack[n - 1];
+      path += "/";
+      path += parent.m_Value.is_object() ? parent.m_Key : std::to_string(parent.m_Value.size());
+    }
+    return path;
+  }
+}
+
+#endif
@@ -0,0 +1,389 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_JSON_STREAM_WRITER_HXX
+#define REXSAPI_JSON_STREAM_WRITER_HXX
+
+#include <rexsapi/Exception.hxx>
+#include <rexsapi/Format.hxx>
+
+#include <cmath>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace rexsapi::detail
+{
+  /**
+   * @brief Event based json writer working on a stream.
+   *
+   * Writes a json document value by value to a stream without creating a json object. The layout corresponds to
+   * `nlohmann::json::dump` with the same indent. Numbers are formatted with fmt in their shortest round-trip
+   * representation, floating point numbers always contain a decimal point or an exponent. Non-finite floating point
+   * numbers are written as null. Some floating point numbers are written differently than by nlohmann, e.g. without
+   * exponent below 1e16, but will be read back to the same value. Like with nlohmann, strings that are not valid
+   * UTF-8 are rejected with an exception.
+   *
+   * The output is collected in a buffer of bounded size and written to the stream whenever the buffer is full. Apart
+   * from the buffer, only the nesting of the currently open objects and arrays is kept in memory.
+   */
+  class TJsonStreamWriter
+  {
+  public:
+    /**
+     * @brief Constructs a new TJsonStreamWriter object.
+     *
+     * @param stream The stream to write the json document to. Has to outlive the writer.
+     * @param indent The amount of indentation for nested structures. Set to -1 for the most compact format.
+     * @param bufferSize The size of the output buffer in bytes
+     */
+    explicit TJsonStreamWriter(std::ostream& stream, int indent = 2, size_t bufferSize = 64 * 1024);
+
+    void startObject();
+    void endObject();
+    void startArray();
+    void endArray();
+
+    /**
+     * @brief Writes the key of the next object member.
+     *
+     * @param name The key in UTF-8 encoding. Will be escaped.
+     * @throws TException if not inside an object or the key is not valid UTF-8
+     */
+    void key(std::string_view name);
+
+    /**
+     * @brief Writes a string value.
+     *
+     * @param value The string in UTF-8 encoding. Will be escaped.
+     * @throws TException if the string is not valid UTF-8
+     */
+    void string(std::string_view value);
+
+    /**
+     * @brief Writes a number value.
+     *
+     * @tparam T An integral or floating point type
+     * @param value The number to write
+     */
+    template<typename T>
+    void number(T value);
+
+    void boolean(bool value);
+
+    void null();
+
+    /**
+     * @brief Writes the remaining buffer to the stream.
+     *
+     * @throws TException if objects or arrays are still open or the stream could not be written
+     */
+    void endDocument();
+
+  private:
+    struct TLevel {
+      bool m_Object;
+      bool m_Empty;
+    };
+
+    void startValue();
+    void start(char c, bool object);
+    void end(char c, bool object);
+    void newLine(size_t depth);
+    void writeEscaped(std::string_view s);
+    static size_t skipUtf8Sequence(std::string_view s, size_t n);
+    void write(std::string_view s);
+    void write(char c);
+    void flush();
+
+    std::ostream& m_Stream;
+    int m_Indent;
+    size_t m_BufferSize;
+    std::string m_Buffer;
+    std::vector<TLevel> m_Levels;
+    bool m_KeyWritten{false};
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  inline TJsonStreamWriter::TJsonStreamWriter(std::ostream& stream, int indent, size_t bufferSize)
+  : m_Stream{stream}
+  , m_Indent{indent}
+  , m_BufferSize{bufferSize}
+  {
+    m_Buffer.reserve(m_BufferSize);
+  }
+
+  inline void TJsonStreamWriter::startObject()
+  {
+    start('{', true);
+  }
+
+  inline void TJsonStreamWriter::endObject()
+  {
+    end('}', true);
+  }
+
+  inline void TJsonStreamWriter::startArray()
+  {
+    start('[', false);
+  }
+
+  inline void TJsonStreamWriter::endArray()
+  {
+    end(']', false);
+  }
+
+  inline void TJsonStreamWriter::key(std::string_view name)
+  {
+    if (m_Levels.empty() || !m_Levels.back().m_Object || m_KeyWritten) {
+      throw TException{fmt::format("cannot write key '{}' outside of an object", name)};
+    }
+    auto& level = m_Levels.back();
+    if (!level.m_Empty) {
+      write(',');
+    }
+    level.m_Empty = false;
+    newLine(m_Levels.size());
+    write('"');
+    writeEscaped(name);
+    write(m_Indent >= 0 ? "\": " : "\":");
+    m_KeyWritten = true;
+  }
+
+  inline void TJsonStreamWriter::string(std::string_view value)
+  {
+    startValue();
+    write('"');
+    writeEscaped(value);
+    write('"');
+  }
+
+  template<typename T>
+  inline void TJsonStreamWriter::number(T value)
+  {
+    static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "only numbers can be written");
+    startValue();
+    char buffer[64];
+    if constexpr (std::is_floating_point_v<T>) {
+      if (!std::isfinite(value)) {
+        write("null");
+        return;
+      }
+      const auto end = fmt::format_to_n(buffer, sizeof(buffer), "{}", value).out;
+      std::string_view number{buffer, static_cast<size_t>(end - buffer)};
+      write(number);
+      if (number.find_first_of(".e") == std::string_view::npos) {
+        write(".0");
+      }
+    } else {
+      const auto end = fmt::format_to_n(buffer, sizeof(buffer), "{}", value).out;
+      write(std::string_view{buffer, static_cast<size_t>(end - buffer)});
+    }
+  }
+
+  inline void TJsonStreamWriter::boolean(bool value)
+  {
+    startValue();
+    write(value ? "true" : "false");
+  }
+
+  inline void TJsonStreamWriter::null()
+  {
+    startValue();
+    write("null");
+  }
+
+  inline void TJsonStreamWriter::endDocument()
+  {
+    if (!m_Levels.empty()) {
+      throw TException{"cannot end document with open object or array"};
+    }
+    flush();
+    m_Stream.flush();
+    if (!m_Stream) {
+      throw TException{"cannot write json document to stream"};
+    }
+  }
+
+  inline void TJsonStreamWriter::startValue()
+  {
+    if (m_Levels.empty()) {
+      return;
+    }
+    auto& level = m_Levels.back();
+    if (level.m_Object) {
+      if (!m_KeyWritten) {
+        throw TException{"cannot write object member without key"};
+      }
+      m_KeyWritten = false;
+      return;
+    }
+    if (!level.m_Empty) {
+      write(',');
+    }
+    level.m_Empty = false;
+    newLine(m_Levels.size());
+  }
+
+  inline void TJsonStreamWriter::start(char c, bool object)
+  {
+    startValue();
+    write(c);
+    m_Levels.emplace_back(TLevel{object, true});
+  }
+
+  inline void TJsonStreamWriter::end(char c, bool object)
+  {
+    if (m_Levels.empty() || m_Levels.back().m_Object != object || m_KeyWritten) {
+      throw TException{fmt::format("cannot close '{}' without matching open", c)};
+    }
+    const bool empty = m_Levels.back().m_Empty;
+    m_Levels.pop_back();
+    if (!empty) {
+      newLine(m_Levels.size());
+    }
+    write(c);
+  }
+
+  inline void TJsonStreamWriter::newLine(size_t depth)
+  {
+    if (m_Indent < 0) {
+      return;
+    }
+    write('\n');
+    for (size_t n = 0; n < depth * static_cast<size_t>(m_Indent); ++n) {
+      write(' ');
+    }
+  }
+
+  inline void TJsonStreamWriter::writeEscaped(std::string_view s)
+  {
+    size_t start = 0;
+    for (size_t n = 0; n < s.size(); ++n) {
+      const auto c = static_cast<unsigned char>(s[n]);
+      if (c >= 0x80) {
+        n = skipUtf8Sequence(s, n);
+        continue;
+      }
+      if (c >= 0x20 && c != '"' && c != '\\') {
+        continue;
+      }
+
+      write(s.substr(start, n - start));
+      start = n + 1;
+      switch (c) {
+        case '"':
+          write("\\\"");
+          break;
+        case '\\':
+          write("\\\\");
+          break;
+        case '\b':
+          write("\\b");
+          break;
+        case '\f':
+          write("\\f");
+          break;
+        case '\n':
+          write("\\n");
+          break;
+        case '\r':
+          write("\\r");
+          break;
+        case '\t':
+          write("\\t");
+          break;
+        default: {
+          constexpr static char hex[] = "0123456789abcdef";
+          const char escaped[] = {'\\', 'u', '0', '0', hex[c >> 4], hex[c & 0x0f]};
+          write(std::string_view{escaped, sizeof(escaped)});
+          break;
+        }
+      }
+    }
+    write(s.substr(start));
+  }
+
+  inline size_t TJsonStreamWriter::skipUtf8Sequence(std::string_view s, size_t n)
+  {
+    // well-formed byte sequences according to the unicode standard, table 3-7
+    const auto lead = static_cast<unsigned char>(s[n]);
+    size_t length = 0;
+    unsigned char lower = 0x80;
+    unsigned char upper = 0xbf;
+    if (lead >= 0xc2 && lead <= 0xdf) {
+      length = 2;
+    } else if (lead >= 0xe0 && lead <= 0xef) {
+      length = 3;
+      lower = lead == 0xe0 ? 0xa0 : lower;
+      upper = lead == 0xed ? 0x9f : upper;
+    } else if (lead >= 0xf0 && lead <= 0xf4) {
+      length = 4;
+      lower = lead == 0xf0 ? 0x90 : lower;
+      upper = lead == 0xf4 ? 0x8f : upper;
+    } else {
+      throw TException{fmt::format("invalid UTF-8 byte at index {}: 0x{:02X}", n, lead)};
+    }
+
+    for (size_t i = n + 1; i < n + length; ++i) {
+      if (i >= s.size()) {
+        throw TException{
+          fmt::format("incomplete UTF-8 string; last byte: 0x{:02X}", static_cast<unsigned char>(s.back()))};
+      }
+      const auto c = static_cast<unsigned char>(s[i]);
+      if (c < lower || c > upper) {
+        throw TException{fmt::format("invalid UTF-8 byte at index {}: 0x{:02X}", i, c)};
+      }
+      lower = 0x80;
+      upper = 0xbf;
+    }
+    return n + length - 1;
+  }
+
+  inline void TJsonStreamWriter::write(std::string_view s)
+  {
+    if (m_Buffer.size() + s.size() > m_BufferSize) {
+      flush();
+      if (s.size() > m_BufferSize) {
+        m_Stream.write(s.data(), static_cast<std::streamsize>(s.size()));
+        return;
+      }
+    }
+    m_Buffer.append(s);
+  }
+
+  inline void TJsonStreamWriter::write(char c)
+  {
+    if (m_Buffer.size() >= m_BufferSize) {
+      flush();
+    }
+    m_Buffer.push_back(c);
+  }
+
+  inline void TJsonStreamWriter::flush()
+  {
+    m_Stream.write(m_Buffer.data(), static_cast<std::streamsize>(m_Buffer.size()));
+    m_Buffer.clear();
+  }
+}
+
+#endif
@@ -24,9 +24,13 @@
 #include <rexsapi/Value.hxx>
 #include <rexsapi/database/EnumValues.hxx>
 
+#include <algorithm>
 #include <memory>
 #include <optional>
+#include <string_view>
 #include <unordered_map>
+#include <variant>
+#include <vector>
 
 namespace rexsapi::detail
 {
@@ -35,6 +39,87 @@ namespace rexsapi::detail
     class TJsonDecoder;
   }
 
+  /**
+   * @brief Collects the elements of an uncoded array or matrix attribute value from json sax events.
+   *
+   * Used by the json stream reader to store the elements of array and matrix values in their final representation
+   * while reading, instead of creating a json node for every element. The elements are checked against the item types
+   * the json schema defines for the value.
+   */
+  class TJsonArrayValue
+  {
+  public:
+    /**
+     * @brief Returns the value type belonging to an uncoded array or matrix value key.
+     *
+     * @param key The key of the value in the json attribute object, e.g. floating_point_array
+     * @return std::optional<TValueType> The value type or nothing if the key does not denote an uncoded array or
+     *         matrix value
+     */
+    static std::optional<TValueType> typeFromKey(std::string_view key);
+
+    explicit TJsonArrayValue(TValueType type);
+
+    void startArray();
+
+    void startObject();
+
+    void end();
+
+    void add(rexsapi::json&& element);
+
+    /**
+     * @brief Checks if the outermost array of the value has been closed.
+     */
+    bool isComplete() const noexcept
+    {
+      return m_Started && m_Depth == 0;
+    }
+
+    TValueType getType() const noexcept
+    {
+      return m_Type;
+    }
+
+    /**
+     * @brief Returns the first error found while collecting the elements.
+     */
+    const std::optional<std::string>& getError() const noexcept
+    {
+      return m_Error;
+    }
+
+    /**
+     * @brief Creates the value from the collected elements.
+     *
+     * The elements are moved into the value, so decode can only be called once.
+     *
+     * @param enumValue The enum values to check the elements of enum arrays against
+     * @return std::pair<TValue, TDecoderResult> The value and the result of the decoding
+     */
+    std::pair<TValue, TDecoderResult> decode(const std::optional<const database::TEnumValues>& enumValue);
+
+  private:
+    void setError(std::string_view message);
+
+    template<typename Type>
+    std::vector<Type>& elements()
+    {
+      return std::get<std::vector<Type>>(m_Elements);
+    }
+
+    template<typename Type>
+    std::pair<TValue, TDecoderResult> decodeMatrix();
+
+    TValueType m_Type;
+    bool m_Nested;
+    bool m_Started{false};
+    size_t m_Depth{0};
+    std::optional<std::string> m_Error{};
+    std::variant<std::vector<double>, std::vector<int64_t>, std::vector<Bool>, std::vector<std::string>> m_Elements;
+    std::vector<size_t> m_RowSizes{};
+  };
+
   class TJsonValueDecoder
   {
   public:
@@ -44,6 +129,10 @@ namespace rexsapi::detail
                                                            const std::optional<const database::TEnumValues>& enumValue,
                                                            const rexsapi::json& node) const;
 
+    [[nodiscard]] std::pair<TValue, TDecoderResult> decode(TValueType type,
+                                                           const std::optional<const database::TEnumValues>& enumValue,
+                                                           TJsonArrayValue& array) const;
+
   private:
     std::unordered_map<TValueType, std::unique_ptr<json::TJsonDecoder>> m_Decoder;
   };
@@ -371,16 +460,20 @@ namespace rexsapi::detail
       std::pair<TValue, TDecoderResult> onDecode(const std::optional<const database::TEnumValues>&,
                                                  const rexsapi::json& node) const override
       {
-        TMatrix<type2> matrix;
-        for (const auto& row : node.at(m_Name)) {
-          std::vector<type2> r;
+        const auto& rows = node.at(m_Name);
+        const size_t columns = rows.empty() ? 0 : rows.begin()->size();
+        std::vector<type2> values;
+        values.reserve(rows.size() * columns);
+        for (const auto& row : rows) {
+          if (row.size() != columns) {
+            return std::make_pair(TValue{TMatrix<type2>{}}, TDecoderResult::FAILURE);
+          }
           for (const auto& column : row) {
-            r.emplace_back(column.template get<type>());
+            values.emplace_back(column.template get<type>());
           }
-          matrix.m_Values.emplace_back(std::move(r));
         }
-        const bool result = matrix.validate();
-        return std::make_pair(TValue{std::move(matrix)}, result ? TDecoderResult::SUCCESS : TDecoderResult::FAILURE);
+        return std::make_pair(TValue{TMatrix<type2>{rows.size(), columns, std::move(values)}},
+                              TDecoderResult::SUCCESS);
       }
       std::string m_Name;
     };
@@ -437,8 +530,8 @@ namespace rexsapi::detail
               break;
             }
           }
-          if (value.getValue<TMatrix<Type>>().m_Values.size() != rows ||
-              value.getValue<TMatrix<Type>>().m_Values[0].size() != columns) {
+          const auto& matrix = value.getValue<TMatrix<Type>>();
+          if (matrix.getRowCount() != rows || matrix.getColumnCount() != columns) {
             throw TException{"decoded matrix size does not correspond to configured size"};
           }
           return std::make_pair(std::move(value), TDecoderResult::SUCCESS);
@@ -488,6 +581,193 @@ namespace rexsapi::detail
   // Implementation
   /////////////////////////////////////////////////////////////////////////////
 
+  inline std::optional<TValueType> TJsonArrayValue::typeFromKey(std::string_view key)
+  {
+    // called for every array inside of a record, so the type strings are only created once
+    static const auto types = [] {
+      std::vector<std::pair<std::string, TValueType>> keys;
+      for (auto type : {TValueType::FLOATING_POINT_ARRAY, TValueType::INTEGER_ARRAY, TValueType::BOOLEAN_ARRAY,
+                        TValueType::STRING_ARRAY, TValueType::ENUM_ARRAY, TValueType::FLOATING_POINT_MATRIX,
+                        TValueType::INTEGER_MATRIX, TValueType::BOOLEAN_MATRIX, TValueType::STRING_MATRIX,
+                        TValueType::ARRAY_OF_INTEGER_ARRAYS}) {
+        keys.emplace_back(toTypeString(type), type);
+      }
+      return keys;
+    }();
+
+    const auto it = std::find_if(types.begin(), types.end(), [&key](const auto& entry) {
+      return entry.first == key;
+    });
+    if (it == types.end()) {
+      return {};
+    }
+    return it->second;
+  }
+
+  inline TJsonArrayValue::TJsonArrayValue(TValueType type)
+  : m_Type{type}
+  {
+    switch (m_Type) {
+      case TValueType::FLOATING_POINT_ARRAY:
+      case TValueType::FLOATING_POINT_MATRIX:
+        m_Elements = std::vector<double>{};
+        break;
+      case TValueType::INTEGER_ARRAY:
+      case TValueType::INTEGER_MATRIX:
+      case TValueType::ARRAY_OF_INTEGER_ARRAYS:
+        m_Elements = std::vector<int64_t>{};
+        break;
+      case TValueType::BOOLEAN_ARRAY:
+      case TValueType::BOOLEAN_MATRIX:
+        m_Elements = std::vector<Bool>{};
+        break;
+      case TValueType::STRING_ARRAY:
+      case TValueType::ENUM_ARRAY:
+      case TValueType::STRING_MATRIX:
+        m_Elements = std::vector<std::string>{};
+        break;
+      default:
+        throw TException{fmt::format("{} is not an array or matrix type", toTypeString(m_Type))};
+    }
+    m_Nested = m_Type == TValueType::FLOATING_POINT_MATRIX || m_Type == TValueType::INTEGER_MATRIX ||
+               m_Type == TValueType::BOOLEAN_MATRIX || m_Type == TValueType::STRING_MATRIX ||
+               m_Type == TValueType::ARRAY_OF_INTEGER_ARRAYS;
+  }
+
+  inline void TJsonArrayValue::startArray()
+  {
+    if (m_Depth == (m_Nested ? 2 : 1)) {
+      setError("unexpected array element");
+    } else if (m_Depth == 1) {
+      m_RowSizes.emplace_back(0);
+    }
+    m_Started = true;
+    ++m_Depth;
+  }
+
+  inline void TJsonArrayValue::startObject()
+  {
+    setError("unexpected object element");
+    ++m_Depth;
+  }
+
+  inline void TJsonArrayValue::end()
+  {
+    --m_Depth;
+  }
+
+  inline void TJsonArrayValue::add(rexsapi::json&& element)
+  {
+    if (m_Depth != (m_Nested ? 2 : 1)) {
+      setError("expected array element");
+      return;
+    }
+    if (m_Error) {
+      return;
+    }
+
+    switch (m_Elements.index()) {
+      case 0:
+        if (!element.is_number()) {
+          setError("expected number element");
+          return;
+        }
+        elements<double>().emplace_back(element.get<double>());
+        break;
+      case 1:
+        if (!element.is_number_integer()) {
+          setError("expected integer element");
+          return;
+        }
+        elements<int64_t>().emplace_back(element.get<int64_t>());
+        break;
+      case 2:
+        if (!element.is_boolean()) {
+          setError("expected boolean element");
+          return;
+        }
+        elements<Bool>().emplace_back(element.get<bool>());
+        break;
+      default:
+        if (!element.is_string()) {
+          setError("expected string element");
+          return;
+        }
+        elements<std::string>().emplace_back(std::move(element.get_ref<std::string&>()));
+        break;
+    }
+    if (m_Nested) {
+      ++m_RowSizes.back();
+    }
+  }
+
+  inline void TJsonArrayValue::setError(std::string_view message)
+  {
+    if (!m_Error) {
+      m_Error = message;
+    }
+  }
+
+  template<typename Type>
+  inline std::pair<TValue, TDecoderResult> TJsonArrayValue::decodeMatrix()
+  {
+    const size_t columns = m_RowSizes.empty() ? 0 : m_RowSizes.front();
+    for (const auto size : m_RowSizes) {
+      if (size != columns) {
+        return std::make_pair(TValue{TMatrix<Type>{}}, TDecoderResult::FAILURE);
+      }
+    }
+    return std::make_pair(TValue{TMatrix<Type>{m_RowSizes.size(), columns, std::move(elements<Type>())}},
+                          TDecoderResult::SUCCESS);
+  }
+
+  inline std::pair<TValue, TDecoderResult>
+  TJsonArrayValue::decode(const std::optional<const database::TEnumValues>& enumValue)
+  {
+    if (m_Error || !isComplete()) {
+      return std::make_pair(TValue{}, TDecoderResult::FAILURE);
+    }
+
+    switch (m_Type) {
+      case TValueType::FLOATING_POINT_ARRAY:
+        return std::make_pair(TValue{std::move(elements<double>())}, TDecoderResult::SUCCESS);
+      case TValueType::INTEGER_ARRAY:
+        return std::make_pair(TValue{std::move(elements<int64_t>())}, TDecoderResult::SUCCESS);
+      case TValueType::BOOLEAN_ARRAY:
+        return std::make_pair(TValue{std::move(elements<Bool>())}, TDecoderResult::SUCCESS);
+      case TValueType::STRING_ARRAY:
+        return std::make_pair(TValue{std::move(elements<std::string>())}, TDecoderResult::SUCCESS);
+      case TValueType::ENUM_ARRAY: {
+        if (!enumValue.has_value()) {
+          return std::make_pair(TValue{}, TDecoderResult::FAILURE);
+        }
+        auto& array = elements<std::string>();
+        const bool result =
+          std::all_of(array.begin(), array.end(), [&enumValue](const auto& value) { return enumValue->check(value); });
+        return std::make_pair(TValue{std::move(array)}, result ? TDecoderResult::SUCCESS : TDecoderResult::FAILURE);
+      }
+      case TValueType::FLOATING_POINT_MATRIX:
+        return decodeMatrix<double>();
+      case TValueType::INTEGER_MATRIX:
+        return decodeMatrix<int64_t>();
+      case TValueType::BOOLEAN_MATRIX:
+        return decodeMatrix<Bool>();
+      case TValueType::STRING_MATRIX:
+        return decodeMatrix<std::string>();
+      default: {
+        const auto& values = elements<int64_t>();
+        std::vector<std::vector<int64_t>> arrays;
+        arrays.reserve(m_RowSizes.size());
+        auto it = values.begin();
+        for (const auto size : m_RowSizes) {
+          arrays.emplace_back(it, it + static_cast<std::ptrdiff_t>(size));
+          it += static_cast<std::ptrdiff_t>(size);
+        }
+        return std::make_pair(TValue{std::move(arrays)}, TDecoderResult::SUCCESS);
+      }
+    }
+  }
+
   inline TJsonValueDecoder::TJsonValueDecoder()
   {
     m_Decoder[TValueType::BOOLEAN] = std::make_unique<json::TBooleanDecoder>();
@@ -563,6 +843,20 @@ namespace rexsapi::detail
       return std::make_pair(TValue{}, TDecoderResult::FAILURE);
     }
   }
+
+  inline std::pair<TValue, TDecoderResult>
+  TJsonValueDecoder::decode(TValueType type, const std::optional<const database::TEnumValues>& enumValue,
+                            TJsonArrayValue& array) const
+  {
+    if (array.getType() != type) {
+      return std::pair(TValue{}, TDecoderResult::WRONG_TYPE);
+    }
+    try {
+      return array.decode(enumValue);
+    } catch (const std::exception&) {
+      return std::make_pair(TValue{}, TDecoderResult::FAILURE);
+    }
+  }
 }
 
 #endif
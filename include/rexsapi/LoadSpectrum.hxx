@@ -19,12 +19,115 @@
 
 #include <rexsapi/Component.hxx>
 
+#include <iterator>
+
 namespace rexsapi
 {
+  /**
+   * @brief Non-owning view of the attributes of a load component.
+   *
+   * Presents the load attributes followed by the attributes of the referenced component as one sequence without
+   * copying them. The view is only valid as long as the load component and the referenced component exist.
+   */
+  class TLoadAttributesView
+  {
+  public:
+    class const_iterator
+    {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = TAttribute;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const TAttribute*;
+      using reference = const TAttribute&;
+
+      const_iterator(const TLoadAttributesView& view, size_t index) noexcept
+      : m_View{&view}
+      , m_Index{index}
+      {
+      }
+
+      reference operator*() const noexcept
+      {
+        return (*m_View)[m_Index];
+      }
+
+      pointer operator->() const noexcept
+      {
+        return &(*m_View)[m_Index];
+      }
+
+      const_iterator& operator++() noexcept
+      {
+        ++m_Index;
+        return *this;
+      }
+
+      const_iterator operator++(int) noexcept
+      {
+        auto tmp = *this;
+        ++(*this);
+        return tmp;
+      }
+
+      friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) noexcept
+      {
+        return lhs.m_Index == rhs.m_Index;
+      }
+
+      friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs) noexcept
+      {
+        return lhs.m_Index != rhs.m_Index;
+      }
+
+    private:
+      const TLoadAttributesView* m_View;
+      size_t m_Index;
+    };
+
+    TLoadAttributesView(const TAttributes& loadAttributes, const TAttributes& componentAttributes) noexcept
+    : m_LoadAttributes{loadAttributes}
+    , m_ComponentAttributes{componentAttributes}
+    {
+    }
+
+    [[nodiscard]] size_t size() const noexcept
+    {
+      return m_LoadAttributes.size() + m_ComponentAttributes.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+      return size() == 0;
+    }
+
+    [[nodiscard]] const TAttribute& operator[](size_t n) const noexcept
+    {
+      return n < m_LoadAttributes.size() ? m_LoadAttributes[n] : m_ComponentAttributes[n - m_LoadAttributes.size()];
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept
+    {
+      return const_iterator{*this, 0};
+    }
+
+    [[nodiscard]] const_iterator end() const noexcept
+    {
+      return const_iterator{*this, size()};
+    }
+
+  private:
+    const TAttributes& m_LoadAttributes;
+    const TAttributes& m_ComponentAttributes;
+  };
+
+
   /**
    * @brief Represents a component in a load case or accumulation.
    *
-   * References an existing component and adds additional load attributes to it.
+   * References an existing component and adds additional load attributes to it. Only the load attributes are stored,
+   * the attributes of the referenced component are shared with the component and all other load components
+   * referencing it.
    *
    * Load components should not be created manually but by using the TModelBuilder.
    */
@@ -36,19 +139,14 @@ namespace rexsapi
      *
      * Load components are immutable objects, once created they cannot be changed.
      *
-     * @param component The referenced component
+     * @param component The referenced component. Has to outlive the load component.
      * @param attributes Additonal attributes for the load case. Can be left empty. Should not contain the same
      * attributes as the referenced component.
      */
     TLoadComponent(const TComponent& component, TAttributes attributes)
     : m_Component{component}
-    , m_Attributes{attributes}
     , m_LoadAttributes{std::move(attributes)}
     {
-      std::for_each(m_Component.getAttributes().begin(), m_Component.getAttributes().end(),
-                    [this](const auto& attribute) {
-                      m_Attributes.emplace_back(attribute);
-                    });
     }
 
     const TComponent& getComponent() const& noexcept
@@ -59,13 +157,14 @@ namespace rexsapi
     /**
      * @brief Returns the complete set of attributes including the referenced components.
      *
-     * Will combine the referenced components attributes with the additional load case attributes.
+     * Will combine the additional load case attributes with the referenced components attributes without copying
+     * them.
      *
-     * @return const TAttributes& to the complete attributes
+     * @return TLoadAttributesView over the load attributes followed by the referenced components attributes
      */
-    const TAttributes& getAttributes() const& noexcept
+    TLoadAttributesView getAttributes() const& noexcept
     {
-      return m_Attributes;
+      return TLoadAttributesView{m_LoadAttributes, m_Component.getAttributes()};
     }
 
     /**
@@ -82,7 +181,6 @@ namespace rexsapi
 
   private:
     const TComponent& m_Component;
-    TAttributes m_Attributes;
     TAttributes m_LoadAttributes;
   };
 
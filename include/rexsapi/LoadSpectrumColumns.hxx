@@ -0,0 +1,271 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_LOAD_SPECTRUM_COLUMNS_HXX
+#define REXSAPI_LOAD_SPECTRUM_COLUMNS_HXX
+
+#include <rexsapi/LoadSpectrum.hxx>
+
+#include <limits>
+#include <unordered_map>
+#include <variant>
+
+namespace rexsapi
+{
+  /**
+   * @brief Contains the values of one load attribute of one component over all load cases.
+   *
+   * The values are stored contiguously with one entry per load case, in the order of the load cases of the load
+   * spectrum. Load cases that do not contain the attribute for the component have no value. Their entry is NaN for
+   * floating point columns and 0 for integer columns and can be identified with TLoadSpectrumColumn::hasValue.
+   *
+   * Columns should not be created manually but by using TLoadSpectrumColumns.
+   */
+  class TLoadSpectrumColumn
+  {
+  public:
+    /**
+     * @brief Constructs a new empty TLoadSpectrumColumn object.
+     *
+     * @param type The value type of the column. Has to be either TValueType::FLOATING_POINT or TValueType::INTEGER.
+     * @param loadCases The number of load cases
+     * @throws TException if the value type is not supported
+     */
+    TLoadSpectrumColumn(TValueType type, size_t loadCases);
+
+    [[nodiscard]] TValueType getValueType() const noexcept
+    {
+      return m_Type;
+    }
+
+    /**
+     * @brief Returns the number of entries of this column.
+     *
+     * @return size_t the number of load cases of the load spectrum
+     */
+    [[nodiscard]] size_t size() const noexcept
+    {
+      return m_Present.size();
+    }
+
+    /**
+     * @brief Checks if the load case contains the attribute for the component.
+     *
+     * @param loadCase The index of the load case
+     * @return true if the load case has a value
+     * @return false if the load case has no value
+     */
+    [[nodiscard]] bool hasValue(size_t loadCase) const
+    {
+      return m_Present.at(loadCase);
+    }
+
+    /**
+     * @brief Returns all values of this column.
+     *
+     * @tparam T The C++ type of the columns value type. Either TFloatType or TIntType.
+     * @return const std::vector<T>& with one entry per load case
+     * @throws TException if the type does not correspond to the columns value type
+     */
+    template<typename T>
+    [[nodiscard]] const std::vector<T>& getValues() const&;
+
+    /**
+     * @brief Sets the value of a load case.
+     *
+     * @param loadCase The index of the load case
+     * @param value The value to set. Has to be of the columns value type.
+     * @throws TException if the value does not correspond to the columns value type
+     */
+    void setValue(size_t loadCase, const TValue& value);
+
+  private:
+    TValueType m_Type;
+    std::variant<std::vector<TFloatType>, std::vector<TIntType>> m_Values;
+    std::vector<bool> m_Present;
+  };
+
+
+  /**
+   * @brief Columnar representation of the load cases of a load spectrum.
+   *
+   * Stores the floating point and integer load attributes of all load cases with one contiguous column per component
+   * and attribute. This allows to iterate over the values of one attribute for all load cases without visiting every
+   * load case, load component, and attribute. All other load attributes, as well as the accumulation, are only
+   * available from the TLoadSpectrum.
+   *
+   * Columns are identified by the internal id of the component and the attribute id.
+   *
+   * Load spectrum columns are immutable objects, once created they cannot be changed.
+   */
+  class TLoadSpectrumColumns
+  {
+  public:
+    /**
+     * @brief Constructs a new TLoadSpectrumColumns object from a load spectrum.
+     *
+     * @param loadSpectrum The load spectrum to convert. Is not referenced after construction.
+     * @throws TException if the same attribute of a component has different value types in different load cases
+     */
+    explicit TLoadSpectrumColumns(const TLoadSpectrum& loadSpectrum);
+
+    /**
+     * @brief Returns the number of load cases.
+     *
+     * @return size_t the number of load cases. All columns have this size.
+     */
+    [[nodiscard]] size_t getLoadCaseCount() const noexcept
+    {
+      return m_LoadCaseCount;
+    }
+
+    /**
+     * @brief Returns the number of columns.
+     *
+     * @return size_t the number of distinct component and attribute combinations
+     */
+    [[nodiscard]] size_t getColumnCount() const noexcept
+    {
+      return m_ColumnCount;
+    }
+
+    /**
+     * @brief Checks if a column exists for the component and attribute.
+     *
+     * @param componentId The internal id of the component
+     * @param attributeId The attribute id
+     * @return true if at least one load case contains the attribute for the component
+     * @return false if no load case contains the attribute for the component
+     */
+    [[nodiscard]] bool hasColumn(uint64_t componentId, const std::string& attributeId) const noexcept
+    {
+      return findColumn(componentId, attributeId) != nullptr;
+    }
+
+    /**
+     * @brief Returns the column of a component and attribute.
+     *
+     * @param componentId The internal id of the component
+     * @param attributeId The attribute id
+     * @return const TLoadSpectrumColumn& to the column
+     * @throws TException if no column exists for the component and attribute
+     */
+    [[nodiscard]] const TLoadSpectrumColumn& getColumn(uint64_t componentId, const std::string& attributeId) const&;
+
+  private:
+    const TLoadSpectrumColumn* findColumn(uint64_t componentId, const std::string& attributeId) const noexcept;
+
+    size_t m_LoadCaseCount;
+    size_t m_ColumnCount{0};
+    std::unordered_map<uint64_t, std::unordered_map<std::string, TLoadSpectrumColumn>> m_Columns;
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  inline TLoadSpectrumColumn::TLoadSpectrumColumn(TValueType type, size_t loadCases)
+  : m_Type{type}
+  , m_Present(loadCases, false)
+  {
+    switch (m_Type) {
+      case TValueType::FLOATING_POINT:
+        m_Values = std::vector<TFloatType>(loadCases, std::numeric_limits<TFloatType>::quiet_NaN());
+        break;
+      case TValueType::INTEGER:
+        m_Values = std::vector<TIntType>(loadCases, 0);
+        break;
+      default:
+        throw TException{fmt::format("value type {} not supported for load spectrum columns", toTypeString(m_Type))};
+    }
+  }
+
+  template<typename T>
+  inline const std::vector<T>& TLoadSpectrumColumn::getValues() const&
+  {
+    const auto* values = std::get_if<std::vector<T>>(&m_Values);
+    if (values == nullptr) {
+      throw TException{fmt::format("wrong value type requested for column of type {}", toTypeString(m_Type))};
+    }
+    return *values;
+  }
+
+  inline void TLoadSpectrumColumn::setValue(size_t loadCase, const TValue& value)
+  {
+    try {
+      if (m_Type == TValueType::FLOATING_POINT) {
+        std::get<std::vector<TFloatType>>(m_Values).at(loadCase) = value.getValue<TFloatType>();
+      } else {
+        std::get<std::vector<TIntType>>(m_Values).at(loadCase) = value.getValue<TIntType>();
+      }
+    } catch (const std::bad_variant_access&) {
+      throw TException{fmt::format("wrong value {} for column of type {}", value.asString(), toTypeString(m_Type))};
+    }
+    m_Present[loadCase] = true;
+  }
+
+  inline TLoadSpectrumColumns::TLoadSpectrumColumns(const TLoadSpectrum& loadSpectrum)
+  : m_LoadCaseCount{loadSpectrum.getLoadCases().size()}
+  {
+    for (size_t loadCase = 0; loadCase < m_LoadCaseCount; ++loadCase) {
+      for (const auto& loadComponent : loadSpectrum.getLoadCases()[loadCase].getLoadComponents()) {
+        const auto componentId = loadComponent.getComponent().getInternalId();
+        for (const auto& attribute : loadComponent.getLoadAttributes()) {
+          const auto type = attribute.getValueType();
+          if ((type != TValueType::FLOATING_POINT && type != TValueType::INTEGER) || attribute.getValue().isEmpty()) {
+            continue;
+          }
+
+          auto& columns = m_Columns[componentId];
+          auto it = columns.find(attribute.getAttributeId());
+          if (it == columns.end()) {
+            it = columns.emplace(attribute.getAttributeId(), TLoadSpectrumColumn{type, m_LoadCaseCount}).first;
+            ++m_ColumnCount;
+          } else if (it->second.getValueType() != type) {
+            throw TException{fmt::format("component id={} attribute id={} has differing value types in load cases",
+                                         componentId, attribute.getAttributeId())};
+          }
+          it->second.setValue(loadCase, attribute.getValue());
+        }
+      }
+    }
+  }
+
+  inline const TLoadSpectrumColumn& TLoadSpectrumColumns::getColumn(uint64_t componentId,
+                                                                   const std::string& attributeId) const&
+  {
+    const auto* column = findColumn(componentId, attributeId);
+    if (column == nullptr) {
+      throw TException{
+        fmt::format("no load spectrum column for component id={} attribute id={}", componentId, attributeId)};
+    }
+    return *column;
+  }
+
+  inline const TLoadSpectrumColumn* TLoadSpectrumColumns::findColumn(uint64_t componentId,
+                                                                    const std::string& attributeId) const noexcept
+  {
+    const auto columns = m_Columns.find(componentId);
+    if (columns == m_Columns.end()) {
+      return nullptr;
+    }
+    const auto it = columns->second.find(attributeId);
+    return it != columns->second.end() ? &it->second : nullptr;
+  }
+}
+
+#endif
@@ -23,6 +23,7 @@
 #include <rexsapi/database/Component.hxx>
 
 #include <algorithm>
+#include <atomic>
 #include <unordered_map>
 
 namespace rexsapi::detail
@@ -55,9 +56,10 @@ namespace rexsapi::detail
 
     template<typename NodeType>
     TValue getValue(TResult& result, std::string_view context, std::string_view attributeId, uint64_t componentId,
-                    const database::TAttribute& dbAttribute, const NodeType& attribute) const noexcept
+                    const database::TAttribute& dbAttribute, NodeType&& attribute) const noexcept
     {
-      auto [value, res] = m_Decoder.decode(dbAttribute.getValueType(), dbAttribute.getEnums(), attribute);
+      auto [value, res] =
+        m_Decoder.decode(dbAttribute.getValueType(), dbAttribute.getEnums(), std::forward<NodeType>(attribute));
       auto decodedValue = checkResult(result, std::move(value), res, context, attributeId, componentId);
       if (!decodedValue.isEmpty() && !TValidityChecker::check(dbAttribute, decodedValue)) {
         result.addError(TError{m_Mode.adapt(TErrorLevel::ERR),
@@ -69,9 +71,9 @@ namespace rexsapi::detail
 
     template<typename NodeType>
     TValue getValue(TResult& result, TValueType valueType, std::string_view context, std::string_view attributeId,
-                    uint64_t componentId, const NodeType& attribute) const noexcept
+                    uint64_t componentId, NodeType&& attribute) const noexcept
     {
-      auto [value, res] = m_Decoder.decode(valueType, {}, attribute);
+      auto [value, res] = m_Decoder.decode(valueType, {}, std::forward<NodeType>(attribute));
       return checkResult(result, std::move(value), res, context, attributeId, componentId);
     }
 
@@ -116,8 +118,10 @@ namespace rexsapi::detail
   public:
     uint64_t addComponent(uint64_t componentId)
     {
-      auto res = ++m_InternalComponentId;
-      const auto [_, success] = m_ComponentsMapping.emplace(componentId, res);
+      // internal ids have to be unique across all models, even when loading concurrently
+      auto res = m_InternalComponentId.fetch_add(1, std::memory_order_relaxed) + 1;
+      // components are expected to be added to the components in the same order as to the mapping
+      const auto [_, success] = m_ComponentsMapping.emplace(componentId, TEntry{res, m_ComponentsMapping.size()});
       if (!success) {
         throw TException{fmt::format("component id={} already added", componentId)};
       }
@@ -130,15 +134,25 @@ namespace rexsapi::detail
       if (it == m_ComponentsMapping.end()) {
         return nullptr;
       }
-      const auto it_comp = std::find_if(components.begin(), components.end(), [&it](const auto& comp) {
-        return comp.getInternalId() == it->second;
+      const auto& entry = it->second;
+      if (entry.m_Index < components.size() && components[entry.m_Index].getInternalId() == entry.m_InternalId) {
+        return &components[entry.m_Index];
+      }
+      // the components have not been added in mapping order, fall back to searching
+      const auto it_comp = std::find_if(components.begin(), components.end(), [&entry](const auto& comp) {
+        return comp.getInternalId() == entry.m_InternalId;
       });
-      return it_comp.operator->();
+      return it_comp == components.end() ? nullptr : &*it_comp;
     }
 
   private:
-    inline static uint64_t m_InternalComponentId{0};
-    std::unordered_map<uint64_t, uint64_t> m_ComponentsMapping;
+    struct TEntry {
+      uint64_t m_InternalId;
+      size_t m_Index;
+    };
+
+    inline static std::atomic<uint64_t> m_InternalComponentId{0};
+    std::unordered_map<uint64_t, TEntry> m_ComponentsMapping;
   };
 
 
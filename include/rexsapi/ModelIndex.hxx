@@ -0,0 +1,222 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_MODEL_INDEX_HXX
+#define REXSAPI_MODEL_INDEX_HXX
+
+#include <rexsapi/Model.hxx>
+
+#include <functional>
+#include <limits>
+#include <string_view>
+#include <unordered_map>
+
+namespace rexsapi
+{
+  /**
+   * @brief Hash indices for querying the components, attributes, and relations of a model.
+   *
+   * The index is built once for a model and answers all queries without searching the model. Results are returned as
+   * views on the model elements, nothing is copied. Query results are returned in the order the elements appear in
+   * the model.
+   *
+   * @attention The index references the model, the model has to outlive the index.
+   */
+  class TModelIndex
+  {
+  public:
+    /**
+     * @brief An attribute together with the component it belongs to.
+     *
+     */
+    struct TComponentAttribute {
+      std::reference_wrapper<const TComponent> m_Component;
+      std::reference_wrapper<const TAttribute> m_Attribute;
+    };
+
+    using TComponentRefs = std::vector<std::reference_wrapper<const TComponent>>;
+    using TAttributeRefs = std::vector<TComponentAttribute>;
+    using TRelationRefs = std::vector<std::reference_wrapper<const TRelation>>;
+
+    /**
+     * @brief Constructs a new TModelIndex object.
+     *
+     * @param model The model to index
+     */
+    explicit TModelIndex(const TModel& model);
+
+    TModelIndex(const TModelIndex&) = delete;
+    TModelIndex& operator=(const TModelIndex&) = delete;
+    TModelIndex(TModelIndex&&) noexcept = default;
+    TModelIndex& operator=(TModelIndex&&) = delete;
+
+    /**
+     * @brief Looks up a component by its internal id.
+     *
+     * @param id The internal id of the component
+     * @return const TComponent* to the component or nullptr if no component has this id
+     */
+    [[nodiscard]] const TComponent* findComponentByInternalId(uint64_t id) const noexcept;
+
+    /**
+     * @brief Looks up a component by its external id.
+     *
+     * @param id The external id of the component as specified in the model file
+     * @return const TComponent* to the component or nullptr if no component has this id. Components without an
+     * external id cannot be found.
+     */
+    [[nodiscard]] const TComponent* findComponentByExternalId(uint64_t id) const noexcept;
+
+    /**
+     * @brief Returns all components of a type.
+     *
+     * @param type The component type, e.g. "gear_unit"
+     * @return const TComponentRefs& to the components. Empty if no component has this type.
+     */
+    [[nodiscard]] const TComponentRefs& findComponentsByType(std::string_view type) const& noexcept;
+
+    /**
+     * @brief Returns all attributes with an attribute id across all components.
+     *
+     * Only the attributes of the model components are indexed, load attributes of the load spectrum are not.
+     *
+     * @param attributeId The attribute id, e.g. "mass_of_component"
+     * @return const TAttributeRefs& to the attributes together with their components. Empty if no component has
+     * this attribute.
+     */
+    [[nodiscard]] const TAttributeRefs& findAttributesById(std::string_view attributeId) const& noexcept;
+
+    /**
+     * @brief Returns all relations referencing a component.
+     *
+     * @param componentId The internal id of the component
+     * @return const TRelationRefs& to the relations. Empty if no relation references this component.
+     */
+    [[nodiscard]] const TRelationRefs& findRelationsByComponent(uint64_t componentId) const& noexcept;
+
+    /**
+     * @brief Returns all relations referencing a component in a specific role.
+     *
+     * @param componentId The internal id of the component
+     * @param role The role the component has in the relation
+     * @return const TRelationRefs& to the relations. Empty if no relation references this component in this role.
+     */
+    [[nodiscard]] const TRelationRefs& findRelationsByComponent(uint64_t componentId,
+                                                                TRelationRole role) const& noexcept;
+
+  private:
+    template<typename Key, typename Refs>
+    static const Refs& find(const std::unordered_map<Key, Refs>& index, const Key& key) noexcept;
+
+    template<typename Refs, typename Element>
+    static void addUnique(Refs& refs, const Element& element);
+
+    std::unordered_map<uint64_t, std::reference_wrapper<const TComponent>> m_ComponentsByInternalId;
+    std::unordered_map<uint64_t, std::reference_wrapper<const TComponent>> m_ComponentsByExternalId;
+    std::unordered_map<std::string_view, TComponentRefs> m_ComponentsByType;
+    std::unordered_map<std::string_view, TAttributeRefs> m_AttributesById;
+    std::unordered_map<uint64_t, TRelationRefs> m_RelationsByComponent;
+    std::unordered_map<uint64_t, std::unordered_map<TRelationRole, TRelationRefs>> m_RelationsByComponentAndRole;
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  inline TModelIndex::TModelIndex(const TModel& model)
+  {
+    const auto& components = model.getComponents();
+    m_ComponentsByInternalId.reserve(components.size());
+    m_ComponentsByExternalId.reserve(components.size());
+    for (const auto& component : components) {
+      m_ComponentsByInternalId.emplace(component.getInternalId(), component);
+      if (component.getExternalId() != std::numeric_limits<uint64_t>::max()) {
+        m_ComponentsByExternalId.emplace(component.getExternalId(), component);
+      }
+      m_ComponentsByType[component.getType()].emplace_back(component);
+      for (const auto& attribute : component.getAttributes()) {
+        m_AttributesById[attribute.getAttributeId()].emplace_back(TComponentAttribute{component, attribute});
+      }
+    }
+
+    for (const auto& relation : model.getRelations()) {
+      for (const auto& reference : relation.getReferences()) {
+        const auto componentId = reference.getComponent().getInternalId();
+        addUnique(m_RelationsByComponent[componentId], relation);
+        addUnique(m_RelationsByComponentAndRole[componentId][reference.getRole()], relation);
+      }
+    }
+  }
+
+  inline const TComponent* TModelIndex::findComponentByInternalId(uint64_t id) const noexcept
+  {
+    const auto it = m_ComponentsByInternalId.find(id);
+    return it != m_ComponentsByInternalId.end() ? &it->second.get() : nullptr;
+  }
+
+  inline const TComponent* TModelIndex::findComponentByExternalId(uint64_t id) const noexcept
+  {
+    const auto it = m_ComponentsByExternalId.find(id);
+    return it != m_ComponentsByExternalId.end() ? &it->second.get() : nullptr;
+  }
+
+  inline const TModelIndex::TComponentRefs& TModelIndex::findComponentsByType(std::string_view type) const& noexcept
+  {
+    return find(m_ComponentsByType, type);
+  }
+
+  inline const TModelIndex::TAttributeRefs&
+  TModelIndex::findAttributesById(std::string_view attributeId) const& noexcept
+  {
+    return find(m_AttributesById, attributeId);
+  }
+
+  inline const TModelIndex::TRelationRefs& TModelIndex::findRelationsByComponent(uint64_t componentId) const& noexcept
+  {
+    return find(m_RelationsByComponent, componentId);
+  }
+
+  inline const TModelIndex::TRelationRefs& TModelIndex::findRelationsByComponent(uint64_t componentId,
+                                                                                TRelationRole role) const& noexcept
+  {
+    const auto it = m_RelationsByComponentAndRole.find(componentId);
+    if (it == m_RelationsByComponentAndRole.end()) {
+      static const TRelationRefs empty;
+      return empty;
+    }
+    return find(it->second, role);
+  }
+
+  template<typename Key, typename Refs>
+  inline const Refs& TModelIndex::find(const std::unordered_map<Key, Refs>& index, const Key& key) noexcept
+  {
+    static const Refs empty;
+    const auto it = index.find(key);
+    return it != index.end() ? it->second : empty;
+  }
+
+  template<typename Refs, typename Element>
+  inline void TModelIndex::addUnique(Refs& refs, const Element& element)
+  {
+    // a relation can reference the same component more than once
+    if (refs.empty() || &refs.back().get() != &element) {
+      refs.emplace_back(element);
+    }
+  }
+}
+
+#endif
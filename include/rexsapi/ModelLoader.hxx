@@ -17,13 +17,20 @@
 #ifndef REXSAPI_MODEL_LOADER_HXX
 #define REXSAPI_MODEL_LOADER_HXX
 
+#include <rexsapi/FileUtils.hxx>
 #include <rexsapi/JsonModelLoader.hxx>
 #include <rexsapi/XMLModelLoader.hxx>
 #include <rexsapi/ZipArchive.hxx>
 #include <rexsapi/database/FileResourceLoader.hxx>
+#include <rexsapi/database/ModelCache.hxx>
 #include <rexsapi/database/ModelRegistry.hxx>
 #include <rexsapi/database/XMLModelLoader.hxx>
 
+#include <algorithm>
+#include <atomic>
+#include <system_error>
+#include <thread>
+
 namespace rexsapi
 {
   /**
@@ -32,12 +39,17 @@ namespace rexsapi
    * The filesystem path should contain REXS database model files for different versions and languages. Additionally,
    * the XML database model schema file (*rexs-schema.xsd*) has to be available in the path.
    *
+   * Only the versions and languages of the database model files are read upfront. A database model will be loaded the
+   * first time it is requested from the registry.
+   *
    * @param path The filesystem path to load REXS database model files from.
+   * @param cache Will be used to cache the loaded database models in a binary format if set
    * @return database::TModelRegistry containing all available REXS database models
    * @throws TException if anything goes wrong with the creation of the registry, like missing permissions, no schema
    * found, parsing errors, etc.
    */
-  static database::TModelRegistry createModelRegistry(const std::filesystem::path& path);
+  static database::TModelRegistry createModelRegistry(const std::filesystem::path& path,
+                                                      std::optional<database::TModelCache> cache = {});
 
 
   /**
@@ -49,7 +61,8 @@ namespace rexsapi
    * available. The REXS project contains the directory ```models``` with all relevant files that can be used with
    * the loader.
    *
-   * Allows loading of multiple REXS model files with the same loader.
+   * Allows loading of multiple REXS model files with the same loader, either one by one or in parallel with loadAll.
+   * The loader can be used from multiple threads at the same time.
    */
   class TModelLoader final
   {
@@ -98,6 +111,35 @@ namespace rexsapi
     {
     }
 
+    /**
+     * @brief Constructs a new TModelLoader object caching the REXS database models.
+     *
+     * The REXS database models will be stored in a compact binary format in the cache directory the first time they
+     * are used. Later loaders will create the database models from the cache files instead of parsing and validating
+     * the database model xml files. Cache files will only be used as long as the corresponding xml files are unchanged.
+     *
+     * @param databasePath filesystem path containing REXS database model files for different versions and languages and
+     * all relevant schema files. The necessary schema files are:
+     * - rexs-schema.xsd
+     * - rexs-file.xsd
+     * - rexs-file.json
+     * @param cache The cache to use for the REXS database models
+     * @param customExtensionMappings Additional custom extension mappings to respect for REXS model file type detection
+     * @param dataSourceResolver Will be used to load external model data sources if set. Triggers an error if not set
+     *                           and model has external references.
+     * @throws TException if the model registry or the schema validators cannot be created
+     */
+    TModelLoader(const std::filesystem::path& databasePath, database::TModelCache cache,
+                 TCustomExtensionMappings customExtensionMappings = {},
+                 const TDataSourceResolver* dataSourceResolver = nullptr)
+    : m_Registry{createModelRegistry(databasePath, std::move(cache))}
+    , m_XMLSchemaValidator{createXMLSchemaValidator(databasePath)}
+    , m_JsonValidator{createJsonSchemaValidator(databasePath)}
+    , m_ExtensionChecker{std::move(customExtensionMappings)}
+    , m_DataSourceResolver{dataSourceResolver}
+    {
+    }
+
     /**
      * @brief Loads a RESX model file and creates a TModel instance.
      *
@@ -117,6 +159,9 @@ namespace rexsapi
      * created. That outcome is the case when loading non-compliant models. Using the TMode::RELEAXED mode,
      * non-compliant REXS model can be loaded without the result yielding false even in case of issues.
      *
+     * The method may be called concurrently from multiple threads on the same TModelLoader instance. The components of
+     * all loaded models get unique internal ids. A configured TDataSourceResolver has to be thread-safe as well.
+     *
      * @param path The filesystem path to the REXS model file to load
      * @param result Describes the outcome of the load operation. Will contain messages upon issues encountered.
      * @param mode Defines how to handle encountered issues while processing a REXS model file
@@ -126,6 +171,23 @@ namespace rexsapi
     std::optional<TModel> load(const std::filesystem::path& path, TResult& result,
                                TMode mode = TMode::STRICT_MODE) const noexcept;
 
+    /**
+     * @brief Loads multiple REXS model files in parallel.
+     *
+     * Every file is loaded like with a call to load. The files are distributed over a number of threads, all sharing
+     * the model registry and the schema validators of this loader.
+     *
+     * @param paths The filesystem paths to the REXS model files to load
+     * @param mode Defines how to handle encountered issues while processing a REXS model file
+     * @param threads The maximum number of threads to use. 0 will use as many threads as there are hardware threads
+     * available.
+     * @return std::vector<std::pair<std::optional<TModel>, TResult>> containing the model and the result for every path
+     * in the same order as the given paths
+     */
+    std::vector<std::pair<std::optional<TModel>, TResult>> loadAll(const std::vector<std::filesystem::path>& paths,
+                                                                   TMode mode = TMode::STRICT_MODE,
+                                                                   size_t threads = 0) const;
+
   private:
     static TXSDSchemaValidator createXMLSchemaValidator(const std::filesystem::path& path);
 
@@ -197,12 +259,13 @@ namespace rexsapi
   // Implementation
   /////////////////////////////////////////////////////////////////////////////
 
-  static inline database::TModelRegistry createModelRegistry(const std::filesystem::path& path)
+  static inline database::TModelRegistry createModelRegistry(const std::filesystem::path& path,
+                                                             std::optional<database::TModelCache> cache)
   {
     TFileXsdSchemaLoader schemaLoader{path / "rexs-schema.xsd"};
     database::TFileResourceLoader resourceLoader{path};
-    database::TXmlModelLoader modelLoader{resourceLoader, schemaLoader};
-    return database::TModelRegistry::createModelRegistry(modelLoader).first;
+    database::TXmlModelLoader modelLoader{resourceLoader, schemaLoader, std::move(cache)};
+    return database::TModelRegistry::createLazyModelRegistry(modelLoader).first;
   }
 
   inline std::optional<TModel> TModelLoader::load(const std::filesystem::path& path, TResult& result,
@@ -255,6 +318,39 @@ namespace rexsapi
     return model;
   }
 
+  inline std::vector<std::pair<std::optional<TModel>, TResult>>
+  TModelLoader::loadAll(const std::vector<std::filesystem::path>& paths, TMode mode, size_t threads) const
+  {
+    std::vector<std::pair<std::optional<TModel>, TResult>> models(paths.size());
+    std::atomic<size_t> next{0};
+    const auto worker = [this, &paths, &models, &next, mode]() {
+      for (auto n = next.fetch_add(1); n < paths.size(); n = next.fetch_add(1)) {
+        models[n].first = load(paths[n], models[n].second, mode);
+      }
+    };
+
+    if (threads == 0) {
+      threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    threads = std::min(threads, paths.size());
+
+    std::vector<std::thread> workers;
+    try {
+      // the calling thread will be one of the workers
+      for (size_t n = 1; n < threads; ++n) {
+        workers.emplace_back(worker);
+      }
+    } catch (const std::system_error&) {
+      // continue with the threads that could be started
+    }
+    worker();
+    for (auto& thread : workers) {
+      thread.join();
+    }
+
+    return models;
+  }
+
   inline TXSDSchemaValidator TModelLoader::createXMLSchemaValidator(const std::filesystem::path& path)
   {
     TFileXsdSchemaLoader schemaLoader{path / "rexs-file.xsd"};
@@ -281,11 +377,13 @@ namespace rexsapi
   detail::TFileModelLoader<TSchemaValidator, TLoader>::load(TMode mode, TResult& result,
                                                             const rexsapi::database::TModelRegistry& registry)
   {
-    auto buffer = detail::loadFile(result, m_Path);
+    // the loaders work on the mapped file directly, without copying it into a buffer first
+    auto file = detail::mapFile(result, m_Path);
     if (!result) {
       return {};
     }
-    return TLoader{mode, m_Validator, m_DataSourceResolver}.load(result, registry, buffer);
+    return TLoader{mode, m_Validator, m_DataSourceResolver}.load(result, registry,
+                                                                 TBufferView{file->data(), file->size()});
   }
 }
 
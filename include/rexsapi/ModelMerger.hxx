@@ -20,6 +20,7 @@
 #include <rexsapi/ExternalSubcomponentsChecker.hxx>
 #include <rexsapi/Mode.hxx>
 #include <rexsapi/ModelBuilder.hxx>
+#include <rexsapi/ModelIndex.hxx>
 #include <rexsapi/database/ModelRegistry.hxx>
 
 #include <functional>
@@ -61,7 +62,8 @@ namespace rexsapi
       [[nodiscard]] std::optional<std::reference_wrapper<const TComponent>>
       findComponentByInternalId(uint64_t id) const;
 
-      [[nodiscard]] std::vector<TAttribute> findAllAttributesByAttributeId(const std::string& attribute) const;
+      [[nodiscard]] std::vector<std::reference_wrapper<const TAttribute>>
+      findAllAttributesByAttributeId(const std::string& attribute) const;
 
     private:
       const rexsapi::TComponents& m_Components;
@@ -71,8 +73,8 @@ namespace rexsapi
     class TRelationFinder
     {
     public:
-      explicit TRelationFinder(TMode mode, const TModel& model, const TRexsVersion& version)
-      : m_Model{model}
+      explicit TRelationFinder(TMode mode, const TModelIndex& index, const TRexsVersion& version)
+      : m_Index{index}
       , m_Version{version}
       , m_Checker{mode}
       , m_SubcomponentChecker{mode, version}
@@ -83,7 +85,7 @@ namespace rexsapi
       findRelationsByReferenceId(TResult& result, uint64_t id, bool mainLevel = true) const;
 
     private:
-      const TModel& m_Model;
+      const TModelIndex& m_Index;
       const TRexsVersion& m_Version;
       const TRelationTypeChecker m_Checker;
       TExternalSubcomponentsChecker m_SubcomponentChecker;
@@ -153,8 +155,8 @@ namespace rexsapi
 
       TModelBuilder modelBuilder{databaseModel};
 
-      const detail::TComponentFinder componentFinder{referencedModel.getComponents()};
-      const detail::TRelationFinder relationFinder{m_Mode.getMode(), referencedModel,
+      const TModelIndex referencedModelIndex{referencedModel};
+      const detail::TRelationFinder relationFinder{m_Mode.getMode(), referencedModelIndex,
                                                    referencedModel.getInfo().getVersion()};
 
       struct ReferencedRelation {
@@ -172,9 +174,10 @@ namespace rexsapi
           const auto dataSourceAttribute = atrributeFinder.findAttributeById("data_source");
           if (dataSourceAttribute && dataSourceAttribute.value().get().getValueAsString() == dataSource) {
             const auto refComponentId = refAttribute.value().get().getValue().getValue<TIntType>();
-            const auto refComponent = componentFinder.findComponentByExternalId(refComponentId);
-            if (refComponent) {
-              const auto& referencedComponent = refComponent.value().get();
+            const auto* refComponent =
+              referencedModelIndex.findComponentByExternalId(static_cast<uint64_t>(refComponentId));
+            if (refComponent != nullptr) {
+              const auto& referencedComponent = *refComponent;
               if (referencedComponent.getType() != component.getType()) {
                 result.addError(
                   TError{TErrorLevel::CRIT,
@@ -202,8 +205,8 @@ namespace rexsapi
               }
 
               TAttributes attributes = getFilteredAttributes(component.getAttributes());
-              std::for_each(refComponent.value().get().getAttributes().begin(),
-                            refComponent.value().get().getAttributes().end(), [&attributes](const auto& attribute) {
+              std::for_each(referencedComponent.getAttributes().begin(), referencedComponent.getAttributes().end(),
+                            [&attributes](const auto& attribute) {
                               auto it =
                                 std::find_if(attributes.begin(), attributes.end(), [&attribute](const auto& attr) {
                                   return attribute.getAttributeId() == attr.getAttributeId();
@@ -390,9 +393,10 @@ namespace rexsapi
       return {};
     }
 
-    inline std::vector<TAttribute> TComponentFinder::findAllAttributesByAttributeId(const std::string& attribute) const
+    inline std::vector<std::reference_wrapper<const TAttribute>>
+    TComponentFinder::findAllAttributesByAttributeId(const std::string& attribute) const
     {
-      std::vector<TAttribute> attributes;
+      std::vector<std::reference_wrapper<const TAttribute>> attributes;
       std::for_each(m_Components.begin(), m_Components.end(), [&attribute, &attributes](const auto& component) {
         TAttributeFinder finder{component};
         const auto& attr = finder.findAttributeById(attribute);
@@ -410,7 +414,8 @@ namespace rexsapi
       std::vector<std::reference_wrapper<const TRelation>> relations;
       const TComponent* mainComponent = nullptr;
 
-      std::for_each(m_Model.getRelations().begin(), m_Model.getRelations().end(), [&, this](const auto& relation) {
+      const auto& componentRelations = m_Index.findRelationsByComponent(id);
+      std::for_each(componentRelations.begin(), componentRelations.end(), [&, this](const TRelation& relation) {
         auto it = std::find_if(
           relation.getReferences().begin(), relation.getReferences().end(), [&, this](const auto& reference) {
             if (reference.getComponent().getInternalId() == id &&
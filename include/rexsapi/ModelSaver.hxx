@@ -22,6 +22,9 @@
 #include <rexsapi/Result.hxx>
 #include <rexsapi/XMLModelSerializer.hxx>
 #include <rexsapi/XMLSerializer.hxx>
+#include <rexsapi/ZipArchive.hxx>
+
+#include <fstream>
 
 namespace rexsapi
 {
@@ -30,27 +33,42 @@ namespace rexsapi
    *
    */
   enum class TSaveType {
-    JSON,  //!< Model shall be saved in JSON format
-    XML    //!< Model shall be saved in XML format
+    JSON,             //!< Model shall be saved in JSON format
+    XML,              //!< Model shall be saved in XML format
+    COMPRESSED_JSON,  //!< Model shall be saved in JSON format to a compressed zip archive
+    COMPRESSED_XML    //!< Model shall be saved in XML format to a compressed zip archive
   };
 
 
   /**
    * @brief Easy to use model saver convenience class abstracting REXS model store operations.
    *
-   * Can store models in XML or JSON format to a file.
+   * Can store models in XML or JSON format to a file or to a compressed zip archive.
    *
    * Allows storing of multiple REXS model files with the same saver.
    */
   class TModelSaver
   {
   public:
+    /**
+     * @brief Constructs a new TModelSaver object.
+     *
+     * @param compressionLevel The compression level used for compressed archives from 0 (no compression) to 10 (best
+     * compression). Higher levels create smaller archives but take more time.
+     */
+    explicit TModelSaver(int compressionLevel = MZ_DEFAULT_LEVEL) noexcept
+    : m_CompressionLevel{compressionLevel}
+    {
+    }
+
     /**
      * @brief Stores a REXS TModel instance to the given filesystem path.
      *
      * Models can be stored either in XML or JSON format. If the filesystem path does not contain an extension, the
      * store operation will add the correct extension depending on the desired store format. For XML format the
-     * extension will be *.rexs* and for JSON *.rexsj*.
+     * extension will be *.rexs*, for JSON *.rexsj*, and for compressed archives *.rexsz*. Compressed archives contain
+     * one model file named like the archive. The model is compressed while it is serialized, the uncompressed model
+     * is never kept in memory.
      *
      * @param result Describes the outcome of the store operation. Will contain messages upon issues encountered. If the
      * result yields false, the model was not stored.
@@ -63,15 +81,37 @@ namespace rexsapi
       try {
         switch (type) {
           case TSaveType::JSON: {
-            rexsapi::TJsonFileSerializer fileSerializer{addExtension(path, ".rexsj")};
-            rexsapi::TJsonModelSerializer modelSerializer;
-            modelSerializer.serialize(model, fileSerializer);
+            const auto file = addExtension(path, ".rexsj");
+            std::ofstream stream{file};
+            if (!stream) {
+              throw TException{fmt::format("cannot open '{}'", file.string())};
+            }
+            storeJson(model, stream);
             break;
           }
           case TSaveType::XML: {
-            rexsapi::TXMLFileSerializer xmlSerializer{addExtension(path, ".rexs")};
+            const auto file = addExtension(path, ".rexs");
+            std::ofstream stream{file, std::ios_base::binary};
+            if (!stream) {
+              throw TException{fmt::format("cannot open '{}'", file.string())};
+            }
             rexsapi::XMLModelSerializer modelSerializer;
-            modelSerializer.serialize(model, xmlSerializer);
+            modelSerializer.serialize(model, stream);
+            break;
+          }
+          case TSaveType::COMPRESSED_JSON: {
+            const auto file = addExtension(path, ".rexsz");
+            detail::ZipArchiveWriter archive{file, m_CompressionLevel};
+            storeJson(model, archive.startFile(getArchiveFileName(file, ".rexsj")));
+            archive.finish();
+            break;
+          }
+          case TSaveType::COMPRESSED_XML: {
+            const auto file = addExtension(path, ".rexsz");
+            detail::ZipArchiveWriter archive{file, m_CompressionLevel};
+            rexsapi::XMLModelSerializer modelSerializer;
+            modelSerializer.serialize(model, archive.startFile(getArchiveFileName(file, ".rexs")));
+            archive.finish();
             break;
           }
         }
@@ -85,6 +125,32 @@ namespace rexsapi
     {
       return path.has_extension() ? path : path.concat(extension);
     }
+
+    static std::string getArchiveFileName(const std::filesystem::path& archive, std::string_view extension)
+    {
+      // model.rexsz and model.rexs.zip both contain model.rexs or model.rexsj
+      auto name = archive.filename().replace_extension();
+      if (name.extension() == ".rexs") {
+        name.replace_extension();
+      }
+      // zip archives store the file names in UTF-8
+      const auto utf8 = name.concat(extension).u8string();
+#if __cplusplus > 201703L
+      return std::string{utf8.begin(), utf8.end()};
+#else
+      return utf8;
+#endif
+    }
+
+    static void storeJson(const TModel& model, std::ostream& stream)
+    {
+      constexpr static uint8_t bom[] = {0xEF, 0xBB, 0xBF};
+      stream.write(reinterpret_cast<const char*>(bom), sizeof(bom));
+      rexsapi::TJsonModelSerializer modelSerializer;
+      modelSerializer.serialize(model, stream);
+    }
+
+    int m_CompressionLevel;
   };
 }
 
@@ -0,0 +1,342 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_RELATION_GRAPH_HXX
+#define REXSAPI_RELATION_GRAPH_HXX
+
+#include <rexsapi/Model.hxx>
+
+#include <functional>
+#include <optional>
+#include <queue>
+#include <unordered_map>
+
+namespace rexsapi
+{
+  /**
+   * @brief Restricts the relations and neighbours visited by TRelationGraph.
+   *
+   * Unset members match everything.
+   */
+  struct TRelationFilter {
+    std::optional<TRelationType> m_Type;          //!< the type of the relation
+    std::optional<TRelationRole> m_Role;          //!< the role of the component the relation is reached from
+    std::optional<TRelationRole> m_NeighbourRole; //!< the role of the neighbour in the relation
+
+    bool matches(const TRelation& relation, TRelationRole role) const noexcept
+    {
+      return (!m_Type || *m_Type == relation.getType()) && (!m_Role || *m_Role == role);
+    }
+  };
+
+
+  /**
+   * @brief Adjacency structure of the bipartite graph of the components and relations of a model.
+   *
+   * The graph is stored in compressed sparse row format: the relations of every component, and the components of
+   * every relation, are stored contiguously in one array each together with the role of the component in the
+   * relation. Navigating from a component to its relations or neighbours only visits the relations actually
+   * referencing the component.
+   *
+   * Components are identified by their internal id. If a relation references the same component in more than one
+   * role, the relation is visited once per role.
+   *
+   * @attention The graph references the model, the model has to outlive the graph.
+   */
+  class TRelationGraph
+  {
+  public:
+    /**
+     * @brief Constructs a new TRelationGraph object.
+     *
+     * @param model The model to create the graph for
+     */
+    explicit TRelationGraph(const TModel& model);
+
+    TRelationGraph(const TRelationGraph&) = delete;
+    TRelationGraph& operator=(const TRelationGraph&) = delete;
+    TRelationGraph(TRelationGraph&&) noexcept = default;
+    TRelationGraph& operator=(TRelationGraph&&) = delete;
+
+    [[nodiscard]] size_t getComponentCount() const noexcept
+    {
+      return m_Components.size();
+    }
+
+    [[nodiscard]] size_t getRelationCount() const noexcept
+    {
+      return m_Relations.size();
+    }
+
+    /**
+     * @brief Checks if the graph contains a component.
+     *
+     * @param componentId The internal id of the component
+     * @return true if the component is part of the model
+     * @return false if the component is not part of the model
+     */
+    [[nodiscard]] bool hasComponent(uint64_t componentId) const noexcept
+    {
+      return m_ComponentIndex.find(componentId) != m_ComponentIndex.end();
+    }
+
+    /**
+     * @brief Calls the visitor for every relation referencing a component.
+     *
+     * The m_NeighbourRole member of the filter is ignored.
+     *
+     * @tparam Visitor A callable with the signature `void(const TRelation& relation, TRelationRole role)`, where role
+     * is the role of the component in the relation
+     * @param componentId The internal id of the component
+     * @param filter Restricts the visited relations
+     * @param visitor Called for every matching relation in the order of the relations in the model
+     * @throws TException if the component is not part of the model
+     */
+    template<typename Visitor>
+    void visitRelations(uint64_t componentId, const TRelationFilter& filter, Visitor&& visitor) const;
+
+    /**
+     * @brief Calls the visitor for every component sharing a relation with a component.
+     *
+     * @tparam Visitor A callable with the signature `void(const TComponent& neighbour, const TRelation& relation,
+     * TRelationRole role)`, where role is the role of the neighbour in the relation
+     * @param componentId The internal id of the component
+     * @param filter Restricts the visited relations and neighbours
+     * @param visitor Called for every matching neighbour. A neighbour sharing multiple relations with the component
+     * is visited once per relation.
+     * @throws TException if the component is not part of the model
+     */
+    template<typename Visitor>
+    void visitNeighbours(uint64_t componentId, const TRelationFilter& filter, Visitor&& visitor) const;
+
+    /**
+     * @brief Returns the distinct neighbours of a component.
+     *
+     * @param componentId The internal id of the component
+     * @param filter Restricts the visited relations and neighbours
+     * @return std::vector<std::reference_wrapper<const TComponent>> with the neighbours in the order they were found
+     * @throws TException if the component is not part of the model
+     */
+    [[nodiscard]] std::vector<std::reference_wrapper<const TComponent>>
+    getNeighbours(uint64_t componentId, const TRelationFilter& filter = {}) const;
+
+    /**
+     * @brief Returns all components reachable from a component in breadth first order.
+     *
+     * @param componentId The internal id of the start component
+     * @param filter Restricts the relations and neighbours followed on every step
+     * @return std::vector<std::reference_wrapper<const TComponent>> starting with the start component
+     * @throws TException if the component is not part of the model
+     */
+    [[nodiscard]] std::vector<std::reference_wrapper<const TComponent>>
+    breadthFirstSearch(uint64_t componentId, const TRelationFilter& filter = {}) const;
+
+    /**
+     * @brief Returns all components reachable from a component in depth first pre-order.
+     *
+     * @param componentId The internal id of the start component
+     * @param filter Restricts the relations and neighbours followed on every step
+     * @return std::vector<std::reference_wrapper<const TComponent>> starting with the start component
+     * @throws TException if the component is not part of the model
+     */
+    [[nodiscard]] std::vector<std::reference_wrapper<const TComponent>>
+    depthFirstSearch(uint64_t componentId, const TRelationFilter& filter = {}) const;
+
+  private:
+    struct TEdge {
+      size_t m_Index;
+      TRelationRole m_Role;
+    };
+
+    size_t getComponentIndex(uint64_t componentId) const;
+
+    template<typename Visitor>
+    void visitNeighbourIndices(size_t component, const TRelationFilter& filter, Visitor&& visitor) const;
+
+    const TComponents& m_Components;
+    const TRelations& m_Relations;
+    std::unordered_map<uint64_t, size_t> m_ComponentIndex;
+    // m_RelationEdges[m_RelationOffsets[c]..m_RelationOffsets[c + 1]] are the relations of component c
+    std::vector<size_t> m_RelationOffsets;
+    std::vector<TEdge> m_RelationEdges;
+    // m_ComponentEdges[m_ComponentOffsets[r]..m_ComponentOffsets[r + 1]] are the components of relation r
+    std::vector<size_t> m_ComponentOffsets;
+    std::vector<TEdge> m_ComponentEdges;
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  inline TRelationGraph::TRelationGraph(const TModel& model)
+  : m_Components{model.getComponents()}
+  , m_Relations{model.getRelations()}
+  , m_RelationOffsets(m_Components.size() + 1, 0)
+  , m_ComponentOffsets(m_Relations.size() + 1, 0)
+  {
+    m_ComponentIndex.reserve(m_Components.size());
+    for (size_t n = 0; n < m_Components.size(); ++n) {
+      m_ComponentIndex.emplace(m_Components[n].getInternalId(), n);
+    }
+
+    for (size_t r = 0; r < m_Relations.size(); ++r) {
+      const auto& references = m_Relations[r].getReferences();
+      m_ComponentOffsets[r + 1] = m_ComponentOffsets[r] + references.size();
+      for (const auto& reference : references) {
+        ++m_RelationOffsets[getComponentIndex(reference.getComponent().getInternalId()) + 1];
+      }
+    }
+    for (size_t c = 0; c < m_Components.size(); ++c) {
+      m_RelationOffsets[c + 1] += m_RelationOffsets[c];
+    }
+
+    m_ComponentEdges.reserve(m_ComponentOffsets.back());
+    m_RelationEdges.resize(m_RelationOffsets.back());
+    std::vector<size_t> positions(m_RelationOffsets.begin(), m_RelationOffsets.end() - 1);
+    for (size_t r = 0; r < m_Relations.size(); ++r) {
+      for (const auto& reference : m_Relations[r].getReferences()) {
+        const auto component = getComponentIndex(reference.getComponent().getInternalId());
+        m_ComponentEdges.emplace_back(TEdge{component, reference.getRole()});
+        m_RelationEdges[positions[component]++] = TEdge{r, reference.getRole()};
+      }
+    }
+  }
+
+  template<typename Visitor>
+  inline void TRelationGraph::visitRelations(uint64_t componentId, const TRelationFilter& filter,
+                                             Visitor&& visitor) const
+  {
+    const auto component = getComponentIndex(componentId);
+    for (size_t n = m_RelationOffsets[component]; n < m_RelationOffsets[component + 1]; ++n) {
+      const auto& edge = m_RelationEdges[n];
+      const auto& relation = m_Relations[edge.m_Index];
+      if (filter.matches(relation, edge.m_Role)) {
+        visitor(relation, edge.m_Role);
+      }
+    }
+  }
+
+  template<typename Visitor>
+  inline void TRelationGraph::visitNeighbours(uint64_t componentId, const TRelationFilter& filter,
+                                              Visitor&& visitor) const
+  {
+    visitNeighbourIndices(getComponentIndex(componentId), filter,
+                          [this, &visitor](size_t neighbour, const TRelation& relation, TRelationRole role) {
+                            visitor(m_Components[neighbour], relation, role);
+                          });
+  }
+
+  inline std::vector<std::reference_wrapper<const TComponent>>
+  TRelationGraph::getNeighbours(uint64_t componentId, const TRelationFilter& filter) const
+  {
+    const auto component = getComponentIndex(componentId);
+    std::vector<std::reference_wrapper<const TComponent>> neighbours;
+    std::vector<bool> found(m_Components.size(), false);
+    visitNeighbourIndices(component, filter, [&](size_t neighbour, const TRelation&, TRelationRole) {
+      if (!found[neighbour]) {
+        found[neighbour] = true;
+        neighbours.emplace_back(m_Components[neighbour]);
+      }
+    });
+    return neighbours;
+  }
+
+  inline std::vector<std::reference_wrapper<const TComponent>>
+  TRelationGraph::breadthFirstSearch(uint64_t componentId, const TRelationFilter& filter) const
+  {
+    const auto start = getComponentIndex(componentId);
+    std::vector<std::reference_wrapper<const TComponent>> components;
+    std::vector<bool> visited(m_Components.size(), false);
+    std::queue<size_t> queue;
+
+    visited[start] = true;
+    queue.push(start);
+    while (!queue.empty()) {
+      const auto component = queue.front();
+      queue.pop();
+      components.emplace_back(m_Components[component]);
+      visitNeighbourIndices(component, filter, [&](size_t neighbour, const TRelation&, TRelationRole) {
+        if (!visited[neighbour]) {
+          visited[neighbour] = true;
+          queue.push(neighbour);
+        }
+      });
+    }
+    return components;
+  }
+
+  inline std::vector<std::reference_wrapper<const TComponent>>
+  TRelationGraph::depthFirstSearch(uint64_t componentId, const TRelationFilter& filter) const
+  {
+    const auto start = getComponentIndex(componentId);
+    std::vector<std::reference_wrapper<const TComponent>> components;
+    std::vector<bool> visited(m_Components.size(), false);
+    std::vector<size_t> stack{start};
+    std::vector<size_t> neighbours;
+
+    while (!stack.empty()) {
+      const auto component = stack.back();
+      stack.pop_back();
+      if (visited[component]) {
+        continue;
+      }
+      visited[component] = true;
+      components.emplace_back(m_Components[component]);
+
+      neighbours.clear();
+      visitNeighbourIndices(component, filter, [&](size_t neighbour, const TRelation&, TRelationRole) {
+        if (!visited[neighbour]) {
+          neighbours.emplace_back(neighbour);
+        }
+      });
+      // push in reverse to visit the neighbours in the order they were found
+      stack.insert(stack.end(), neighbours.rbegin(), neighbours.rend());
+    }
+    return components;
+  }
+
+  inline size_t TRelationGraph::getComponentIndex(uint64_t componentId) const
+  {
+    const auto it = m_ComponentIndex.find(componentId);
+    if (it == m_ComponentIndex.end()) {
+      throw TException{fmt::format("component id={} is not part of the model", componentId)};
+    }
+    return it->second;
+  }
+
+  template<typename Visitor>
+  inline void TRelationGraph::visitNeighbourIndices(size_t component, const TRelationFilter& filter,
+                                                    Visitor&& visitor) const
+  {
+    for (size_t n = m_RelationOffsets[component]; n < m_RelationOffsets[component + 1]; ++n) {
+      const auto& edge = m_RelationEdges[n];
+      const auto& relation = m_Relations[edge.m_Index];
+      if (!filter.matches(relation, edge.m_Role)) {
+        continue;
+      }
+      for (size_t m = m_ComponentOffsets[edge.m_Index]; m < m_ComponentOffsets[edge.m_Index + 1]; ++m) {
+        const auto& neighbour = m_ComponentEdges[m];
+        if (neighbour.m_Index != component &&
+            (!filter.m_NeighbourRole || *filter.m_NeighbourRole == neighbour.m_Role)) {
+          visitor(neighbour.m_Index, relation, neighbour.m_Role);
+        }
+      }
+    }
+  }
+}
+
+#endif
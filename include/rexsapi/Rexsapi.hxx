@@ -21,11 +21,14 @@
 #include <rexsapi/Defines.hxx>
 #include <rexsapi/JsonModelSerializer.hxx>
 #include <rexsapi/JsonSerializer.hxx>
+#include <rexsapi/LoadSpectrumColumns.hxx>
 #include <rexsapi/ModelBuilder.hxx>
+#include <rexsapi/ModelIndex.hxx>
 #include <rexsapi/ModelLoader.hxx>
 #include <rexsapi/ModelMerger.hxx>
 #include <rexsapi/ModelSaver.hxx>
 #include <rexsapi/ModelVisitor.hxx>
+#include <rexsapi/RelationGraph.hxx>
 #include <rexsapi/Version.hxx>
 #include <rexsapi/XMLModelSerializer.hxx>
 #include <rexsapi/XMLSerializer.hxx>
@@ -0,0 +1,97 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_STRING_POOL_HXX
+#define REXSAPI_STRING_POOL_HXX
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace rexsapi::detail
+{
+  /**
+   * @brief Process wide pool of interned strings.
+   *
+   * Used for the vocabulary of the REXS database models repeated in nearly every model element, like component types
+   * and unit names. Each distinct string is stored only once and stays valid until the end of the process, so
+   * references to interned strings can be freely copied between models. The pool never shrinks and must therefore not
+   * be used for strings taken from model files, like custom attribute ids and custom units.
+   *
+   * With hidden symbol visibility or on Windows every shared library has its own pool, so equal strings are not
+   * guaranteed to be the same string.
+   *
+   * The pool is thread-safe.
+   */
+  class TStringPool
+  {
+  public:
+    /**
+     * @brief Returns the interned copy of a string.
+     *
+     * @param s The string to intern
+     * @return const std::string& to the interned string. Equal strings always return the same reference.
+     */
+    static const std::string& intern(std::string_view s);
+
+  private:
+    static TStringPool& instance();
+
+    std::shared_mutex m_Mutex;
+    std::deque<std::string> m_Strings;
+    std::unordered_map<std::string_view, const std::string*> m_Index;
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  inline const std::string& TStringPool::intern(std::string_view s)
+  {
+    static const std::string empty{};
+    if (s.empty()) {
+      return empty;
+    }
+
+    auto& pool = instance();
+    {
+      std::shared_lock lock{pool.m_Mutex};
+      if (auto it = pool.m_Index.find(s); it != pool.m_Index.end()) {
+        return *it->second;
+      }
+    }
+
+    std::scoped_lock lock{pool.m_Mutex};
+    if (auto it = pool.m_Index.find(s); it != pool.m_Index.end()) {
+      return *it->second;
+    }
+    const auto& interned = pool.m_Strings.emplace_back(s);
+    pool.m_Index.emplace(interned, &interned);
+    return interned;
+  }
+
+  inline TStringPool& TStringPool::instance()
+  {
+    static TStringPool pool;
+    return pool;
+  }
+}
+
+#endif
@@ -49,6 +49,7 @@ namespace rexs_date = std::chrono;
 #include <date/date.h>
 namespace rexs_date = date;
 #endif
+#include <iterator>
 #include <sstream>
 #include <vector>
 
@@ -140,20 +141,159 @@ namespace rexsapi
   };
 
 
+  /**
+   * @brief Read-only view of a row or a column of a TMatrix.
+   *
+   * The view references the matrix storage and is only valid as long as the matrix is not changed or destroyed.
+   *
+   * @tparam T The C++ type of the matrix elements
+   */
+  template<typename T>
+  class TMatrixView
+  {
+  public:
+    class const_iterator
+    {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = T;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const T*;
+      using reference = const T&;
+
+      const_iterator(const T* first, size_t index, size_t stride) noexcept
+      : m_First{first}
+      , m_Index{index}
+      , m_Stride{stride}
+      {
+      }
+
+      reference operator*() const noexcept
+      {
+        return m_First[m_Index * m_Stride];
+      }
+
+      pointer operator->() const noexcept
+      {
+        return &m_First[m_Index * m_Stride];
+      }
+
+      const_iterator& operator++() noexcept
+      {
+        ++m_Index;
+        return *this;
+      }
+
+      const_iterator operator++(int) noexcept
+      {
+        auto tmp = *this;
+        ++(*this);
+        return tmp;
+      }
+
+      friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) noexcept
+      {
+        return lhs.m_Index == rhs.m_Index;
+      }
+
+      friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs) noexcept
+      {
+        return lhs.m_Index != rhs.m_Index;
+      }
+
+    private:
+      // the element address is only formed for valid indices, the end of a column view lies beyond the storage
+      const T* m_First;
+      size_t m_Index;
+      size_t m_Stride;
+    };
+
+    TMatrixView(const T* first, size_t size, size_t stride) noexcept
+    : m_First{first}
+    , m_Size{size}
+    , m_Stride{stride}
+    {
+    }
+
+    [[nodiscard]] size_t size() const noexcept
+    {
+      return m_Size;
+    }
+
+    [[nodiscard]] const T& operator[](size_t n) const noexcept
+    {
+      return m_First[n * m_Stride];
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept
+    {
+      return const_iterator{m_First, 0, m_Stride};
+    }
+
+    [[nodiscard]] const_iterator end() const noexcept
+    {
+      return const_iterator{m_First, m_Size, m_Stride};
+    }
+
+  private:
+    const T* m_First;
+    size_t m_Size;
+    size_t m_Stride;
+  };
+
+
   /**
    * @brief Represents the REXS matrix type.
    *
+   * The elements are stored in one contiguous buffer in row-major order.
+   *
    * @tparam T The C++ type for this matrix. Currently, integer, boolean, floating point and string are allowed.
    */
   template<typename T>
-  struct TMatrix {
+  class TMatrix
+  {
+  public:
     using value_type = T;
+    using const_iterator = typename std::vector<T>::const_iterator;
 
     TMatrix() = default;
 
-    explicit TMatrix(std::vector<std::vector<T>> v)
-    : m_Values{std::move(v)}
+    /**
+     * @brief Constructs a new TMatrix object from rows.
+     *
+     * @param v The rows of the matrix. All rows have to have the same column count.
+     * @throws TException if the rows have differing column counts
+     */
+    explicit TMatrix(const std::vector<std::vector<T>>& v)
+    : m_Rows{v.size()}
+    , m_Columns{v.empty() ? 0 : v[0].size()}
     {
+      m_Values.reserve(m_Rows * m_Columns);
+      for (const auto& row : v) {
+        if (row.size() != m_Columns) {
+          throw TException{"matrix rows have differing column counts"};
+        }
+        m_Values.insert(m_Values.end(), row.begin(), row.end());
+      }
+    }
+
+    /**
+     * @brief Constructs a new TMatrix object from a row-major buffer.
+     *
+     * @param rows The row count
+     * @param columns The column count
+     * @param values The elements in row-major order
+     * @throws TException if the element count does not correspond to the row and column count
+     */
+    TMatrix(size_t rows, size_t columns, std::vector<T> values)
+    : m_Rows{rows}
+    , m_Columns{columns}
+    , m_Values{std::move(values)}
+    {
+      if (m_Values.size() != m_Rows * m_Columns) {
+        throw TException{fmt::format("matrix does not have the correct element count: {} rows: {} columns: {}",
+                                     m_Values.size(), m_Rows, m_Columns)};
+      }
     }
 
     /**
@@ -164,15 +304,13 @@ namespace rexsapi
      */
     template<typename S>
     TMatrix(const TMatrix<S>& m)  /// deliberately not marked as "explicit"
+    : m_Rows{m.getRowCount()}
+    , m_Columns{m.getColumnCount()}
     {
-      for (const auto& row : m.m_Values) {
-        std::vector<T> tmp;
-        tmp.resize(row.size());
-        std::transform(row.begin(), row.end(), tmp.begin(), [](auto x) {
-          return static_cast<T>(x);
-        });
-        m_Values.emplace_back(std::move(tmp));
-      }
+      m_Values.resize(m.size());
+      std::transform(m.begin(), m.end(), m_Values.begin(), [](const auto& x) {
+        return static_cast<T>(x);
+      });
     }
 
     TMatrix(const TMatrix<T>& m) = default;
@@ -185,36 +323,115 @@ namespace rexsapi
     /**
      * @brief Checks if a martrix is valid.
      *
-     * A valid matrix has the same column count for every row.
+     * A valid matrix has the same column count for every row. As matrices can only be created with the same column
+     * count for every row, matrices are always valid.
      *
      * @return true the matrix has the same column count for every row
      * @return false the matrix is invalid
      */
     bool validate() const noexcept
     {
-      if (m_Values.size()) {
-        size_t n = m_Values[0].size();
-        for (const auto& row : m_Values) {
-          if (row.size() != n) {
-            return false;
-          }
-        }
-      }
-      return true;
+      return m_Values.size() == m_Rows * m_Columns;
     }
 
-    friend bool operator==(const TMatrix<T>& lhs, const TMatrix<T>& rhs) noexcept
+    [[nodiscard]] size_t getRowCount() const noexcept
+    {
+      return m_Rows;
+    }
+
+    [[nodiscard]] size_t getColumnCount() const noexcept
+    {
+      return m_Columns;
+    }
+
+    /**
+     * @brief Returns the element count of the matrix.
+     *
+     * @return The row count multiplied by the column count
+     */
+    [[nodiscard]] size_t size() const noexcept
+    {
+      return m_Values.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+      return m_Values.empty();
+    }
+
+    [[nodiscard]] const T& operator()(size_t row, size_t column) const noexcept
+    {
+      return m_Values[row * m_Columns + column];
+    }
+
+    /**
+     * @brief Returns the elements of the matrix.
+     *
+     * @return const std::vector<T>& to all elements in row-major order
+     */
+    [[nodiscard]] const std::vector<T>& getValues() const& noexcept
+    {
+      return m_Values;
+    }
+
+    /**
+     * @brief Returns a pointer to the contiguous elements in row-major order.
+     */
+    [[nodiscard]] const T* data() const noexcept
     {
-      return lhs.m_Values == rhs.m_Values;
+      return m_Values.data();
     }
 
     /**
-     * @brief The store for the actual matrix values.
+     * @brief Iterates all elements in row-major order.
+     */
+    [[nodiscard]] const_iterator begin() const noexcept
+    {
+      return m_Values.begin();
+    }
+
+    [[nodiscard]] const_iterator end() const noexcept
+    {
+      return m_Values.end();
+    }
+
+    [[nodiscard]] TMatrixView<T> getRow(size_t row) const noexcept
+    {
+      return TMatrixView<T>{m_Values.data() + row * m_Columns, m_Columns, 1};
+    }
+
+    [[nodiscard]] TMatrixView<T> getColumn(size_t column) const noexcept
+    {
+      return TMatrixView<T>{m_Values.data() + column, m_Rows, m_Columns};
+    }
+
+    /**
+     * @brief Returns a copy of the matrix as rows.
      *
-     * Currently, the only way to access the matrix values.
+     * Provided for code working with nested vectors. Prefer the views and linear access for new code.
      *
+     * @return std::vector<std::vector<T>> containing a vector for each row
      */
-    std::vector<std::vector<T>> m_Values;
+    [[nodiscard]] std::vector<std::vector<T>> getRows() const
+    {
+      std::vector<std::vector<T>> rows;
+      rows.reserve(m_Rows);
+      for (size_t row = 0; row < m_Rows; ++row) {
+        rows.emplace_back(m_Values.begin() + static_cast<std::ptrdiff_t>(row * m_Columns),
+                          m_Values.begin() + static_cast<std::ptrdiff_t>((row + 1) * m_Columns));
+      }
+      return rows;
+    }
+
+    friend bool operator==(const TMatrix<T>& lhs, const TMatrix<T>& rhs) noexcept
+    {
+      return lhs.m_Rows == rhs.m_Rows && lhs.m_Columns == rhs.m_Columns && lhs.m_Values == rhs.m_Values;
+    }
+
+  private:
+    size_t m_Rows{0};
+    size_t m_Columns{0};
+    std::vector<T> m_Values;
   };
 
 
@@ -17,8 +17,11 @@
 #ifndef REXSAPI_UNIT_HXX
 #define REXSAPI_UNIT_HXX
 
+#include <rexsapi/StringPool.hxx>
 #include <rexsapi/database/Unit.hxx>
 
+#include <memory>
+
 
 namespace rexsapi
 {
@@ -45,7 +48,7 @@ namespace rexsapi
      * @param unit The unit to create this unit with
      */
     explicit TUnit(const database::TUnit& unit)
-    : m_Unit{unit.getName()}
+    : m_Unit{&unit.getName()}
     , m_IsCustomUnit{false}
     {
     }
@@ -55,8 +58,9 @@ namespace rexsapi
      *
      * @param unit The units name
      */
-    explicit TUnit(std::string unit)
-    : m_Unit{std::move(unit)}
+    explicit TUnit(const std::string& unit)
+    : m_CustomUnit{unit.empty() ? nullptr : std::make_shared<const std::string>(unit)}
+    , m_Unit{m_CustomUnit ? m_CustomUnit.get() : &detail::TStringPool::intern({})}
     {
     }
 
@@ -73,7 +77,7 @@ namespace rexsapi
 
     [[nodiscard]] const std::string& getName() const& noexcept
     {
-      return m_Unit;
+      return *m_Unit;
     }
 
     /**
@@ -86,7 +90,7 @@ namespace rexsapi
      */
     friend bool operator==(const TUnit& lhs, const database::TUnit& rhs)
     {
-      return rhs.compare(lhs.m_Unit);
+      return rhs.compare(*lhs.m_Unit);
     }
 
     /**
@@ -112,7 +116,8 @@ namespace rexsapi
      */
     friend bool operator==(const TUnit& lhs, const TUnit& rhs) noexcept
     {
-      return lhs.m_Unit == rhs.m_Unit;
+      // names of database units are interned and usually the same string
+      return lhs.m_Unit == rhs.m_Unit || *lhs.m_Unit == *rhs.m_Unit;
     }
 
     /**
@@ -129,7 +134,9 @@ namespace rexsapi
     }
 
   private:
-    std::string m_Unit{};
+    // custom units from model files are not interned to not keep them for the whole process
+    std::shared_ptr<const std::string> m_CustomUnit;
+    const std::string* m_Unit{&detail::TStringPool::intern({})};
     bool m_IsCustomUnit{true};
   };
 }
@@ -80,19 +80,15 @@ namespace rexsapi::detail
         });
       }
       case TValueType::FLOATING_POINT_MATRIX: {
-        const auto& values = val.getValue<TFloatMatrixType>().m_Values;
-        return std::all_of(values.begin(), values.end(), [&interval](const auto& v) {
-          return std::all_of(v.begin(), v.end(), [&interval](const auto& d) {
-            return checkRange(interval, d);
-          });
+        const auto& values = val.getValue<TFloatMatrixType>();
+        return std::all_of(values.begin(), values.end(), [&interval](const auto& d) {
+          return checkRange(interval, d);
         });
       }
       case TValueType::INTEGER_MATRIX: {
-        const auto& values = val.getValue<TIntMatrixType>().m_Values;
-        return std::all_of(values.begin(), values.end(), [&interval](const auto& v) {
-          return std::all_of(v.begin(), v.end(), [&interval](const auto& i) {
-            return checkRange(interval, static_cast<double>(i));
-          });
+        const auto& values = val.getValue<TIntMatrixType>();
+        return std::all_of(values.begin(), values.end(), [&interval](const auto& i) {
+          return checkRange(interval, static_cast<double>(i));
         });
       }
       case TValueType::BOOLEAN:
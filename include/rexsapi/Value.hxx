@@ -23,6 +23,7 @@
 #include <rexsapi/database/EnumValues.hxx>
 
 #include <functional>
+#include <type_traits>
 
 namespace rexsapi
 {
@@ -313,6 +314,28 @@ namespace rexsapi
   template<typename R>
   auto dispatch(TValueType type, const TValue& value, DispatcherFuncs<R> funcs);
 
+  /**
+   * @brief Calls a visitor with the value converted to the C++ type of the given value type.
+   *
+   * Works like rexsapi::dispatch, but takes any callable instead of a tuple of std::function objects. The visitor will
+   * be called with the tag of the value type as first and the value as second argument, e.g. with
+   * `visitor(TFloatTag{}, const TFloatType&)`. Typically the visitor is a set of lambdas combined with
+   * rexsapi::detail::overload, but a single generic lambda works as well. As nothing is type-erased, the compiler is
+   * able to inline the visitor.
+   *
+   * The visitor has to be callable for all value types and has to return the same type for all of them.
+   *
+   * @tparam Visitor The type of the visitor
+   * @param type The value type to visit
+   * @param value The actual value to hand over to the visitor. The values type shall correspond to the value type
+   * given.
+   * @param visitor The visitor to call
+   * @return auto Returns the result of the visitor. If the visitor returns void, no value will be returned.
+   * @throws TException if the values type does not correspond to the value type given
+   */
+  template<typename Visitor>
+  decltype(auto) visitValue(TValueType type, const TValue& value, Visitor&& visitor);
+
 
   /////////////////////////////////////////////////////////////////////////////
   // Implementation
@@ -367,6 +390,29 @@ namespace rexsapi
       stream << "]";
       return stream.str();
     }
+
+    template<typename T>
+    std::string matrixToString(const TMatrix<T>& matrix,
+                               std::function<std::string(typename TMatrix<T>::value_type)>&& formatter)
+    {
+      std::stringstream stream;
+      stream << "[";
+      for (size_t row = 0; row < matrix.getRowCount(); ++row) {
+        if (row) {
+          stream << ",";
+        }
+        stream << "[";
+        for (size_t column = 0; column < matrix.getColumnCount(); ++column) {
+          if (column) {
+            stream << ",";
+          }
+          stream << formatter(matrix(row, column));
+        }
+        stream << "]";
+      }
+      stream << "]";
+      return stream.str();
+    }
   }
 
   inline std::string TValue::asString() const
@@ -415,164 +461,87 @@ namespace rexsapi
                                          });
                                        },
                                        [](const TMatrix<double>& matrix) -> std::string {
-                                         return detail::array2dToString(matrix.m_Values, [](const auto& val) {
+                                         return detail::matrixToString(matrix, [](const auto& val) {
                                            return format(val);
                                          });
                                        },
                                        [](const TMatrix<int64_t>& matrix) -> std::string {
-                                         return detail::array2dToString(matrix.m_Values, [](const auto& val) {
+                                         return detail::matrixToString(matrix, [](const auto& val) {
                                            return fmt::format("{}", val);
                                          });
                                        },
                                        [](const TMatrix<Bool>& matrix) -> std::string {
-                                         return detail::array2dToString(matrix.m_Values, [](const auto& val) {
+                                         return detail::matrixToString(matrix, [](const auto& val) {
                                            return fmt::format("{}", *val);
                                          });
                                        },
                                        [](const TMatrix<std::string>& matrix) -> std::string {
-                                         return detail::array2dToString(matrix.m_Values, [](const auto& val) {
+                                         return detail::matrixToString(matrix, [](const auto& val) {
                                            return fmt::format("{}", val);
                                          });
                                        }},
                       m_Value);
   }
 
-  template<typename R>
-  inline auto dispatch(TValueType type, const TValue& value, DispatcherFuncs<R> funcs)
+  template<typename Visitor>
+  inline decltype(auto) visitValue(TValueType type, const TValue& value, Visitor&& visitor)
   {
+    using R = std::invoke_result_t<Visitor, TFloatTag, const TFloatType&>;
     try {
       switch (type) {
-        case TValueType::FLOATING_POINT: {
-          auto c = std::get<std::function<R(TFloatTag, const TFloatType&)>>(funcs);
-          if (c) {
-            return c(TFloatTag(), value.getValue<TFloatType>());
-          }
-          break;
-        }
-        case TValueType::BOOLEAN: {
-          auto c = std::get<std::function<R(TBoolTag, const bool&)>>(funcs);
-          if (c) {
-            return c(TBoolTag(), value.getValue<TBoolType>());
-          }
-          break;
-        }
-        case TValueType::INTEGER: {
-          auto c = std::get<std::function<R(TIntTag, const TIntType&)>>(funcs);
-          if (c) {
-            return c(TIntTag(), value.getValue<TIntType>());
-          }
-          break;
-        }
-        case TValueType::ENUM: {
-          auto c = std::get<std::function<R(TEnumTag, const TEnumType&)>>(funcs);
-          if (c) {
-            return c(TEnumTag(), value.getValue<TEnumType>());
-          }
-          break;
-        }
-        case TValueType::STRING: {
-          auto c = std::get<std::function<R(TStringTag, const TStringType&)>>(funcs);
-          if (c) {
-            return c(TStringTag(), value.getValue<TStringType>());
-          }
-          break;
-        }
-        case TValueType::DATE_TIME: {
-          auto c = std::get<std::function<R(TDatetimeTag, const TDatetimeType&)>>(funcs);
-          if (c) {
-            return c(TDatetimeTag(), value.getValue<TDatetimeType>());
-          }
-          break;
-        }
-        case TValueType::FILE_REFERENCE: {
-          auto c = std::get<std::function<R(TFileReferenceTag, const TFileReferenceType&)>>(funcs);
-          if (c) {
-            return c(TFileReferenceTag(), value.getValue<TFileReferenceType>());
-          }
-          break;
-        }
-        case TValueType::FLOATING_POINT_ARRAY: {
-          auto c = std::get<std::function<R(TFloatArrayTag, const TFloatArrayType&)>>(funcs);
-          if (c) {
-            return c(TFloatArrayTag(), value.getValue<TFloatArrayType>());
-          }
-          break;
-        }
-        case TValueType::BOOLEAN_ARRAY: {
-          auto c = std::get<std::function<R(TBoolArrayTag, const TBoolArrayType&)>>(funcs);
-          if (c) {
-            return c(TBoolArrayTag(), value.getValue<TBoolArrayType>());
-          }
-          break;
-        }
-        case TValueType::INTEGER_ARRAY: {
-          auto c = std::get<std::function<R(TIntArrayTag, const TIntArrayType&)>>(funcs);
-          if (c) {
-            return c(TIntArrayTag(), value.getValue<TIntArrayType>());
-          }
-          break;
-        }
-        case TValueType::ENUM_ARRAY: {
-          auto c = std::get<std::function<R(TEnumArrayTag, const TEnumArrayType&)>>(funcs);
-          if (c) {
-            return c(TEnumArrayTag(), value.getValue<TEnumArrayType>());
-          }
-          break;
-        }
-        case TValueType::STRING_ARRAY: {
-          auto c = std::get<std::function<R(TStringArrayTag, const TStringArrayType&)>>(funcs);
-          if (c) {
-            return c(TStringArrayTag(), value.getValue<TStringArrayType>());
-          }
-          break;
-        }
-        case TValueType::REFERENCE_COMPONENT: {
-          auto c = std::get<std::function<R(TReferenceComponentTag, const TReferenceComponentType&)>>(funcs);
-          if (c) {
-            return c(TReferenceComponentTag(), value.getValue<TReferenceComponentType>());
-          }
-          break;
-        }
-        case TValueType::FLOATING_POINT_MATRIX: {
-          auto c = std::get<std::function<R(TFloatMatrixTag, const TFloatMatrixType&)>>(funcs);
-          if (c) {
-            return c(TFloatMatrixTag(), value.getValue<TFloatMatrixType>());
-          }
-          break;
-        }
-        case TValueType::INTEGER_MATRIX: {
-          auto c = std::get<std::function<R(TIntMatrixTag, const TIntMatrixType&)>>(funcs);
-          if (c) {
-            return c(TIntMatrixTag(), value.getValue<TIntMatrixType>());
-          }
-          break;
-        }
-        case TValueType::BOOLEAN_MATRIX: {
-          auto c = std::get<std::function<R(TBoolMatrixTag, const TBoolMatrixType&)>>(funcs);
-          if (c) {
-            return c(TBoolMatrixTag(), value.getValue<TBoolMatrixType>());
-          }
-          break;
-        }
-        case TValueType::STRING_MATRIX: {
-          auto c = std::get<std::function<R(TStringMatrixTag, const TStringMatrixType&)>>(funcs);
-          if (c) {
-            return c(TStringMatrixTag(), value.getValue<TStringMatrixType>());
-          }
-          break;
-        }
-        case TValueType::ARRAY_OF_INTEGER_ARRAYS: {
-          auto c = std::get<std::function<R(TArrayOfIntArraysTag, const TArrayOfIntArraysType&)>>(funcs);
-          if (c) {
-            return c(TArrayOfIntArraysTag(), value.getValue<TArrayOfIntArraysType>());
-          }
-          break;
-        }
+        case TValueType::FLOATING_POINT:
+          return static_cast<R>(visitor(TFloatTag(), value.getValue<TFloatType>()));
+        case TValueType::BOOLEAN:
+          return static_cast<R>(visitor(TBoolTag(), value.getValue<TBoolType>()));
+        case TValueType::INTEGER:
+          return static_cast<R>(visitor(TIntTag(), value.getValue<TIntType>()));
+        case TValueType::ENUM:
+          return static_cast<R>(visitor(TEnumTag(), value.getValue<TEnumType>()));
+        case TValueType::STRING:
+          return static_cast<R>(visitor(TStringTag(), value.getValue<TStringType>()));
+        case TValueType::DATE_TIME:
+          return static_cast<R>(visitor(TDatetimeTag(), value.getValue<TDatetimeType>()));
+        case TValueType::FILE_REFERENCE:
+          return static_cast<R>(visitor(TFileReferenceTag(), value.getValue<TFileReferenceType>()));
+        case TValueType::FLOATING_POINT_ARRAY:
+          return static_cast<R>(visitor(TFloatArrayTag(), value.getValue<TFloatArrayType>()));
+        case TValueType::BOOLEAN_ARRAY:
+          return static_cast<R>(visitor(TBoolArrayTag(), value.getValue<TBoolArrayType>()));
+        case TValueType::INTEGER_ARRAY:
+          return static_cast<R>(visitor(TIntArrayTag(), value.getValue<TIntArrayType>()));
+        case TValueType::ENUM_ARRAY:
+          return static_cast<R>(visitor(TEnumArrayTag(), value.getValue<TEnumArrayType>()));
+        case TValueType::STRING_ARRAY:
+          return static_cast<R>(visitor(TStringArrayTag(), value.getValue<TStringArrayType>()));
+        case TValueType::REFERENCE_COMPONENT:
+          return static_cast<R>(visitor(TReferenceComponentTag(), value.getValue<TReferenceComponentType>()));
+        case TValueType::FLOATING_POINT_MATRIX:
+          return static_cast<R>(visitor(TFloatMatrixTag(), value.getValue<TFloatMatrixType>()));
+        case TValueType::INTEGER_MATRIX:
+          return static_cast<R>(visitor(TIntMatrixTag(), value.getValue<TIntMatrixType>()));
+        case TValueType::BOOLEAN_MATRIX:
+          return static_cast<R>(visitor(TBoolMatrixTag(), value.getValue<TBoolMatrixType>()));
+        case TValueType::STRING_MATRIX:
+          return static_cast<R>(visitor(TStringMatrixTag(), value.getValue<TStringMatrixType>()));
+        case TValueType::ARRAY_OF_INTEGER_ARRAYS:
+          return static_cast<R>(visitor(TArrayOfIntArraysTag(), value.getValue<TArrayOfIntArraysType>()));
       }
     } catch (const std::bad_variant_access&) {
       throw TException{fmt::format("wrong value {} for type {}", value.asString(), toTypeString(type))};
     }
-    throw TException{fmt::format("no function set for {}", toTypeString(type))};
+    throw TException{fmt::format("unknown value type {}", static_cast<int>(type))};
+  }
+
+  template<typename R>
+  inline auto dispatch(TValueType type, const TValue& value, DispatcherFuncs<R> funcs)
+  {
+    return visitValue(type, value, [&funcs, type](auto tag, const auto& val) -> R {
+      const auto& c = std::get<std::function<R(decltype(tag), const std::decay_t<decltype(val)>&)>>(funcs);
+      if (!c) {
+        throw TException{fmt::format("no function set for {}", toTypeString(type))};
+      }
+      return c(tag, val);
+    });
   }
 }
 
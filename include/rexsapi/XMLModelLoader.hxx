@@ -17,17 +17,22 @@
 #ifndef REXSAPI_XML_MODEL_LOADER_HXX
 #define REXSAPI_XML_MODEL_LOADER_HXX
 
+#include <rexsapi/BufferView.hxx>
 #include <rexsapi/ConversionHelper.hxx>
 #include <rexsapi/DataSourceResolver.hxx>
 #include <rexsapi/ModelHelper.hxx>
 #include <rexsapi/ModelMerger.hxx>
 #include <rexsapi/RelationTypeChecker.hxx>
+#include <rexsapi/XMLStreamReader.hxx>
 #include <rexsapi/XMLValueDecoder.hxx>
 #include <rexsapi/XSDSchemaValidator.hxx>
 #include <rexsapi/XmlUtils.hxx>
 #include <rexsapi/database/ModelRegistry.hxx>
 
+#include <algorithm>
+#include <istream>
 #include <set>
+#include <unordered_map>
 
 namespace rexsapi
 {
@@ -68,20 +73,82 @@ namespace rexsapi
      * @param result Describes the outcome of the operation. Will contain messages upon issues encountered.
      * @param registry Will load the REXS database version and language corresponding to the version information in the
      * buffer
-     * @param buffer The actual REXS model in xml format
+     * @param buffer The actual REXS model in xml format, e.g. a vector or a memory-mapped file. Will be modified, as the
+     * document is parsed in-place.
      * @return std::optional<TModel> Will contain a TModel instance if one could be created. Can be empty if critical
      * errors are encountered while processing the buffer. Buffer not validating against the schema are one source of
      * critical errors.
      */
-    std::optional<TModel> load(TResult& result, const database::TModelRegistry& registry,
-                               std::vector<uint8_t>& buffer) const;
+    std::optional<TModel> load(TResult& result, const database::TModelRegistry& registry, TBufferView buffer) const;
+
+    /**
+     * @brief Processes a stream and creates a TModel instance upon success.
+     *
+     * In contrast to loading a buffer, the document is never kept in memory as a whole. Components, relations, and
+     * load cases are read one after another and validated against the xsd schema on the fly. Memory consumption is
+     * therefore bound by the size of the resulting model instead of the size of the document, which pays off for
+     * documents with large load spectra. Processing stops with a critical error as soon as an element does not
+     * validate against the schema.
+     *
+     * @param result Describes the outcome of the operation. Will contain messages upon issues encountered.
+     * @param registry Will load the REXS database version and language corresponding to the version information in the
+     * stream
+     * @param stream The actual REXS model in xml format
+     * @return std::optional<TModel> Will contain a TModel instance if one could be created. Can be empty if critical
+     * errors are encountered while processing the stream. Malformed documents or documents not validating against the
+     * schema are sources of critical errors.
+     */
+    std::optional<TModel> load(TResult& result, const database::TModelRegistry& registry, std::istream& stream) const;
 
   private:
+    /**
+     * @brief The attributes of a relation element, used to keep relations until the components are known.
+     */
+    struct TRelationRecord {
+      struct TReference {
+        std::string m_Id;
+        std::string m_Role;
+        std::string m_Hint;
+      };
+
+      std::string m_Id;
+      std::string m_Type;
+      std::optional<uint32_t> m_Order;
+      std::vector<TReference> m_References;
+    };
+
+    static TModelInfo getModelInfo(const pugi::xml_node& rexsModel);
+
+    const database::TModel& getDatabaseModel(TResult& result, const database::TModelRegistry& registry,
+                                             const TModelInfo& info) const;
+
+    void addComponent(TResult& result, const database::TModel& dbModel, detail::ComponentMapping& componentsMapping,
+                      TComponents& components, const pugi::xml_node& component) const;
+
+    static TRelationRecord readRelation(const pugi::xml_node& relation);
+
+    void addRelation(TResult& result, const detail::ComponentMapping& componentsMapping, const TComponents& components,
+                     std::set<uint64_t>& usedComponents, TRelations& relations, const TRelationRecord& relation) const;
+
+    static void checkUsedComponents(TResult& result, const TComponents& components,
+                                    const std::set<uint64_t>& usedComponents);
+
+    TLoadCase getLoadCase(TResult& result, const database::TModel& dbModel,
+                          const detail::ComponentMapping& componentsMapping, const TComponents& components,
+                          const pugi::xml_node& loadCase) const;
+
+    void addAccumulationComponents(TResult& result, const database::TModel& dbModel,
+                                   const detail::ComponentMapping& componentsMapping, const TComponents& components,
+                                   TLoadComponents& loadComponents, const pugi::xml_node& accumulation) const;
+
+    std::optional<TModel> createModel(TResult& result, const database::TModelRegistry& registry, TModelInfo info,
+                                      TComponents components, TRelations relations, TLoadCases loadCases,
+                                      TLoadComponents accumulationComponents) const;
+
     static bool checkDuplicate(const TAttributes& attributes, const TAttribute& attribute);
 
     TAttributes getAttributes(const std::string& context, TResult& result, uint64_t componentId,
-                              const database::TComponent& componentType,
-                              const pugi::xpath_node_set& attributeNodes) const;
+                              const database::TComponent& componentType, const pugi::xml_node& node) const;
 
     detail::TModeAdapter m_Mode;
     const TXSDSchemaValidator& m_Validator;
@@ -95,163 +162,391 @@ namespace rexsapi
   /////////////////////////////////////////////////////////////////////////////
 
   inline std::optional<TModel> TXMLModelLoader::load(TResult& result, const database::TModelRegistry& registry,
-                                                     std::vector<uint8_t>& buffer) const
+                                                     TBufferView buffer) const
   {
     const pugi::xml_document doc = detail::loadXMLDocument(result, buffer, m_Validator);
     if (!result) {
       return {};
     }
 
-    const auto rexsModel = *doc.select_nodes("/model").begin();
+    // the document has been validated against the schema, so the structure can be walked directly instead of
+    // querying it with xpath expressions for every single component, relation, and load case
+    const auto rexsModel = doc.child("model");
+    TModelInfo info = getModelInfo(rexsModel);
+    const auto& dbModel = getDatabaseModel(result, registry, info);
+
+    detail::ComponentMapping componentsMapping;
+    TComponents components;
+    components.reserve(10);
+    for (const auto& component : rexsModel.child("components").children("component")) {
+      addComponent(result, dbModel, componentsMapping, components, component);
+    }
+    detail::ComponentPostProcessor postProcessor{result, m_Mode, components, componentsMapping};
+    components = postProcessor.release();
+
+    TRelations relations;
+    std::set<uint64_t> usedComponents;
+    for (const auto& relation : rexsModel.child("relations").children("relation")) {
+      addRelation(result, componentsMapping, components, usedComponents, relations, readRelation(relation));
+    }
+    checkUsedComponents(result, components, usedComponents);
+
+    TLoadCases loadCases;
+    for (const auto& loadCase : doc.select_nodes("/model/load_spectrum/load_case")) {
+      loadCases.emplace_back(getLoadCase(result, dbModel, componentsMapping, components, loadCase.node()));
+    }
+    TLoadComponents accumulationComponents;
+    for (const auto& accumulation : doc.select_nodes("/model/load_spectrum/accumulation")) {
+      addAccumulationComponents(result, dbModel, componentsMapping, components, accumulationComponents,
+                                accumulation.node());
+    }
+
+    return createModel(result, registry, std::move(info), std::move(components), std::move(relations),
+                       std::move(loadCases), std::move(accumulationComponents));
+  }
+
+  inline std::optional<TModel> TXMLModelLoader::load(TResult& result, const database::TModelRegistry& registry,
+                                                     std::istream& stream) const
+  {
+    const auto addErrors = [&result](const std::vector<std::string>& errors) {
+      for (const auto& error : errors) {
+        result.addError(TError{TErrorLevel::CRIT, error});
+      }
+    };
+
+    std::optional<TModelInfo> info;
+    const database::TModel* dbModel{nullptr};
+
+    try {
+      detail::TXMLStreamReader reader{stream};
+      // contains the model, relations, components, and load_spectrum elements together with the first two records of
+      // each kind. This is sufficient for checking the structure and occurrence constraints of the schema at the end.
+      pugi::xml_document skeleton;
+      // records not kept in the skeleton are read into a fragment and dropped after processing
+      pugi::xml_document fragment;
+      // relations and load spectrum records that can only be processed once all components are known
+      std::vector<TRelationRecord> pendingRelations;
+      pugi::xml_document deferred;
+      std::vector<pugi::xml_node> pendingRecords;
+      std::vector<pugi::xml_node> elements;
+      std::vector<std::string> path;
+      std::vector<std::unordered_map<std::string, uint64_t>> occurrences;
+      std::vector<std::string> errors;
+
+      detail::ComponentMapping componentsMapping;
+      TComponents components;
+      bool componentsProcessed{false};
+      bool relationsClosed{false};
+      bool relationsChecked{false};
+      TRelations relations;
+      std::set<uint64_t> usedComponents;
+      TLoadCases loadCases;
+      TLoadComponents accumulationComponents;
+
+      const auto processRecord = [&](const pugi::xml_node& node) {
+        const std::string_view name = node.name();
+        if (name == "component") {
+          addComponent(result, *dbModel, componentsMapping, components, node);
+        } else if (name == "relation") {
+          addRelation(result, componentsMapping, components, usedComponents, relations, readRelation(node));
+        } else if (name == "load_case") {
+          loadCases.emplace_back(getLoadCase(result, *dbModel, componentsMapping, components, node));
+        } else if (name == "accumulation") {
+          addAccumulationComponents(result, *dbModel, componentsMapping, components, accumulationComponents, node);
+        }
+      };
+
+      // the unused components can only be determined once all components and relations have been processed
+      const auto checkRelations = [&]() {
+        if (componentsProcessed && relationsClosed && !relationsChecked) {
+          relationsChecked = true;
+          checkUsedComponents(result, components, usedComponents);
+        }
+      };
+
+      const auto processComponents = [&]() {
+        if (componentsProcessed) {
+          return;
+        }
+        componentsProcessed = true;
+        detail::ComponentPostProcessor postProcessor{result, m_Mode, components, componentsMapping};
+        components = postProcessor.release();
+
+        // relations precede the components in a REXS document and have to be processed before the load spectrum
+        for (const auto& relation : pendingRelations) {
+          addRelation(result, componentsMapping, components, usedComponents, relations, relation);
+        }
+        checkRelations();
+        std::for_each(pendingRecords.begin(), pendingRecords.end(), processRecord);
+        pendingRelations.clear();
+        pendingRecords.clear();
+        deferred.reset();
+      };
+
+      for (auto event = reader.next(); event != detail::TXMLEvent::END_DOCUMENT; event = reader.next()) {
+        if (event == detail::TXMLEvent::TEXT) {
+          if (!elements.empty()) {
+            elements.back().append_child(pugi::node_pcdata).set_value(reader.getText().c_str());
+          }
+          continue;
+        }
+
+        const auto& name = reader.getName();
+        if (event == detail::TXMLEvent::END_ELEMENT) {
+          if (name == "components" || name == "model") {
+            processComponents();
+          }
+          if (name == "relations" || name == "model") {
+            relationsClosed = true;
+            checkRelations();
+          }
+          elements.pop_back();
+          path.pop_back();
+          occurrences.pop_back();
+          continue;
+        }
+
+        if (elements.empty()) {
+          if (name != "model") {
+            result.addError(TError{TErrorLevel::CRIT, fmt::format("unknown root element '{}'", name)});
+            return {};
+          }
+        } else if (elements.size() > 1 || (name != "relations" && name != "components" && name != "load_spectrum")) {
+          // a record, only the first two of each kind are needed for checking the occurrence constraints
+          const bool keep = ++occurrences.back()[name] <= 2;
+          const bool defer = !componentsProcessed && name != "component";
+          // deferred relations are kept in a compact form, only load spectrum records need the complete element
+          const bool deferElement = defer && name != "relation";
+          fragment.reset();
+          const auto node = reader.readElement(keep ? elements.back() : (deferElement ? deferred : fragment));
+          if (!m_Validator.validate(node, path, errors)) {
+            addErrors(errors);
+            return {};
+          }
+          if (deferElement) {
+            pendingRecords.emplace_back(node);
+          } else if (defer) {
+            pendingRelations.emplace_back(readRelation(node));
+          } else {
+            processRecord(node);
+          }
+          continue;
+        }
+
+        auto element = (elements.empty() ? skeleton : elements.back()).append_child(name.c_str());
+        for (const auto& [attributeName, value] : reader.getAttributes()) {
+          element.append_attribute(attributeName.c_str()).set_value(value.c_str());
+        }
+        elements.emplace_back(element);
+        path.emplace_back(name);
+        occurrences.emplace_back();
+
+        if (name == "model") {
+          // the version information is needed right away for processing the records
+          if (!m_Validator.validate(skeleton, errors)) {
+            addErrors(errors);
+            return {};
+          }
+          info = getModelInfo(element);
+          dbModel = &getDatabaseModel(result, registry, *info);
+        }
+      }
+
+      if (!info) {
+        result.addError(TError{TErrorLevel::CRIT, "no model element found"});
+        return {};
+      }
+      if (!m_Validator.validate(skeleton, errors)) {
+        addErrors(errors);
+        return {};
+      }
+
+      return createModel(result, registry, std::move(*info), std::move(components), std::move(relations),
+                         std::move(loadCases), std::move(accumulationComponents));
+    } catch (const std::exception& ex) {
+      if (info && dbModel == nullptr) {
+        // the database model could not be loaded, which is not a parse error. Let the exception escape just like
+        // loading from a buffer does.
+        throw;
+      }
+      result.addError(TError{TErrorLevel::CRIT, fmt::format("cannot parse xml document: {}", ex.what())});
+    }
+    return {};
+  }
+
+  inline TModelInfo TXMLModelLoader::getModelInfo(const pugi::xml_node& rexsModel)
+  {
     const auto language = detail::getStringAttribute(rexsModel, "applicationLanguage", "");
-    TModelInfo info{detail::getStringAttribute(rexsModel, "applicationId"),
-                    detail::getStringAttribute(rexsModel, "applicationVersion"),
-                    detail::getStringAttribute(rexsModel, "date"),
-                    TRexsVersion{detail::getStringAttribute(rexsModel, "version")},
-                    language.empty() ? std::optional<std::string>{} : language};
+    return TModelInfo{detail::getStringAttribute(rexsModel, "applicationId"),
+                      detail::getStringAttribute(rexsModel, "applicationVersion"),
+                      detail::getStringAttribute(rexsModel, "date"),
+                      TRexsVersion{detail::getStringAttribute(rexsModel, "version")},
+                      language.empty() ? std::optional<std::string>{} : language};
+  }
 
+  inline const database::TModel& TXMLModelLoader::getDatabaseModel(TResult& result,
+                                                                   const database::TModelRegistry& registry,
+                                                                   const TModelInfo& info) const
+  {
+    const auto language = info.getApplicationLanguage().value_or("en");
     const auto& dbModel =
-      registry.getModel(info.getVersion(), language.empty() ? "en" : language, m_Mode.getMode() == TMode::STRICT_MODE);
+      registry.getModel(result, info.getVersion(), language, m_Mode.getMode() == TMode::STRICT_MODE);
 
     if (dbModel.getVersion() != info.getVersion()) {
       result.addError(TError{TErrorLevel::WARN, fmt::format("exact database model for version not available, using {}",
                                                             dbModel.getVersion().asString())});
     }
+    return dbModel;
+  }
 
-    detail::ComponentMapping componentsMapping;
-    TComponents components;
-    components.reserve(10);
-    std::set<uint64_t> usedComponents;
+  inline void TXMLModelLoader::addComponent(TResult& result, const database::TModel& dbModel,
+                                            detail::ComponentMapping& componentsMapping, TComponents& components,
+                                            const pugi::xml_node& component) const
+  {
+    const auto componentId = convertToUint64(component.attribute("id").value());
+    const std::string componentName = detail::getStringAttribute(component, "name", "");
+    try {
+      const auto& componentType = dbModel.findComponentById(detail::getStringAttribute(component, "type"));
 
-    for (const auto& component : doc.select_nodes("/model/components/component")) {
-      const auto componentId = convertToUint64(detail::getStringAttribute(component, "id"));
-      const std::string componentName = detail::getStringAttribute(component, "name", "");
-      try {
-        const auto& componentType = dbModel.findComponentById(detail::getStringAttribute(component, "type"));
+      std::string context = componentName.empty() ? componentType.getName() : componentName;
+      TAttributes attributes = getAttributes(context, result, componentId, componentType, component);
 
-        const auto attributeNodes =
-          doc.select_nodes(fmt::format("/model/components/component[@id = '{}']/attribute", componentId).c_str());
-        std::string context = componentName.empty() ? componentType.getName() : componentName;
-        TAttributes attributes = getAttributes(context, result, componentId, componentType, attributeNodes);
+      components.emplace_back(TComponent{componentId, componentsMapping.addComponent(componentId), componentType,
+                                         componentName, std::move(attributes)});
+    } catch (const std::exception& ex) {
+      result.addError(
+        TError{m_Mode.adapt(TErrorLevel::ERR), fmt::format("component id={}: {}", componentId, ex.what())});
+    }
+  }
 
-        components.emplace_back(TComponent{componentId, componentsMapping.addComponent(componentId), componentType,
-                                           componentName, std::move(attributes)});
-      } catch (const std::exception& ex) {
-        result.addError(
-          TError{m_Mode.adapt(TErrorLevel::ERR), fmt::format("component id={}: {}", componentId, ex.what())});
-      }
+  inline TXMLModelLoader::TRelationRecord TXMLModelLoader::readRelation(const pugi::xml_node& relation)
+  {
+    TRelationRecord record{detail::getStringAttribute(relation, "id"), detail::getStringAttribute(relation, "type"),
+                           {}, {}};
+    if (const auto orderAtt = relation.attribute("order"); !orderAtt.empty()) {
+      record.m_Order = orderAtt.as_uint();
     }
-    detail::ComponentPostProcessor postProcessor{result, m_Mode, components, componentsMapping};
-    components = postProcessor.release();
+    for (const auto& reference : relation.children("ref")) {
+      record.m_References.emplace_back(TRelationRecord::TReference{detail::getStringAttribute(reference, "id"),
+                                                                   detail::getStringAttribute(reference, "role"),
+                                                                   detail::getStringAttribute(reference, "hint", "")});
+    }
+    return record;
+  }
 
-    TRelations relations;
-    for (const auto& relation : doc.select_nodes("/model/relations/relation")) {
-      std::string relationId = detail::getStringAttribute(relation, "id");
-      try {
-        auto relationType = relationTypeFromString(detail::getStringAttribute(relation, "type"));
-        std::optional<uint32_t> order;
-        if (const auto orderAtt = relation.node().attribute("order"); !orderAtt.empty()) {
-          order = orderAtt.as_uint();
-          if (order.value() < 1) {
-            result.addError(
-              TError{m_Mode.adapt(TErrorLevel::ERR), fmt::format("relation id={} order is <1", relationId)});
-          }
-        }
+  inline void TXMLModelLoader::addRelation(TResult& result, const detail::ComponentMapping& componentsMapping,
+                                           const TComponents& components, std::set<uint64_t>& usedComponents,
+                                           TRelations& relations, const TRelationRecord& relation) const
+  {
+    const std::string& relationId = relation.m_Id;
+    try {
+      auto relationType = relationTypeFromString(relation.m_Type);
+      const std::optional<uint32_t> order = relation.m_Order;
+      if (order && order.value() < 1) {
+        result.addError(TError{m_Mode.adapt(TErrorLevel::ERR), fmt::format("relation id={} order is <1", relationId)});
+      }
 
-        TRelationReferences references;
-        for (const auto& reference :
-             doc.select_nodes(fmt::format("/model/relations/relation[@id = '{}']/ref", relationId).c_str())) {
-          std::string referenceId = detail::getStringAttribute(reference, "id");
-          try {
-            auto role = relationRoleFromString(detail::getStringAttribute(reference, "role"));
-            const std::string hint = detail::getStringAttribute(reference, "hint", "");
-
-            const auto* component = componentsMapping.getComponent(convertToUint64(referenceId), components);
-            if (component == nullptr) {
-              result.addError(TError{
-                m_Mode.adapt(TErrorLevel::ERR),
-                fmt::format("relation id={} referenced component id={} does not exist", relationId, referenceId)});
-              continue;
-            }
-            usedComponents.emplace(component->getInternalId());
-            references.emplace_back(TRelationReference{role, hint, *component});
-          } catch (const std::exception& ex) {
-            result.addError(TError{m_Mode.adapt(TErrorLevel::ERR),
-                                   fmt::format("cannot process relation reference id={}: {}", referenceId, ex.what())});
+      TRelationReferences references;
+      for (const auto& reference : relation.m_References) {
+        const std::string& referenceId = reference.m_Id;
+        try {
+          auto role = relationRoleFromString(reference.m_Role);
+          const std::string& hint = reference.m_Hint;
+
+          const auto* component = componentsMapping.getComponent(convertToUint64(referenceId), components);
+          if (component == nullptr) {
+            result.addError(TError{
+              m_Mode.adapt(TErrorLevel::ERR),
+              fmt::format("relation id={} referenced component id={} does not exist", relationId, referenceId)});
+            continue;
           }
+          usedComponents.emplace(component->getInternalId());
+          references.emplace_back(TRelationReference{role, hint, *component});
+        } catch (const std::exception& ex) {
+          result.addError(TError{m_Mode.adapt(TErrorLevel::ERR),
+                                 fmt::format("cannot process relation reference id={}: {}", referenceId, ex.what())});
         }
-
-        relations.emplace_back(TRelation{relationType, order, std::move(references)});
-      } catch (const std::exception& ex) {
-        result.addError(TError{m_Mode.adapt(TErrorLevel::ERR),
-                               fmt::format("cannot process relation id={}: {}", relationId, ex.what())});
       }
+
+      relations.emplace_back(TRelation{relationType, order, std::move(references)});
+    } catch (const std::exception& ex) {
+      result.addError(TError{m_Mode.adapt(TErrorLevel::ERR),
+                             fmt::format("cannot process relation id={}: {}", relationId, ex.what())});
     }
+  }
+
+  inline void TXMLModelLoader::checkUsedComponents(TResult& result, const TComponents& components,
+                                                   const std::set<uint64_t>& usedComponents)
+  {
     if (usedComponents.size() != components.size()) {
       result.addError(TError{TErrorLevel::WARN, fmt::format("{} components are not used in a relation",
                                                             components.size() - usedComponents.size())});
     }
+  }
 
-    TLoadCases loadCases;
-    {
-      for (const auto& loadCase : doc.select_nodes("/model/load_spectrum/load_case")) {
-        std::string loadCaseId = detail::getStringAttribute(loadCase, "id");
-        TLoadComponents loadComponents;
-
-        for (const auto& component : doc.select_nodes(
-               fmt::format("/model/load_spectrum/load_case[@id = '{}']/component", loadCaseId).c_str())) {
-          auto componentId = convertToUint64(detail::getStringAttribute(component, "id"));
-          try {
-            const auto* refComponent = componentsMapping.getComponent(componentId, components);
-            if (refComponent == nullptr) {
-              result.addError(
-                TError{m_Mode.adapt(TErrorLevel::ERR),
-                       fmt::format("load_case id={} component id={} does not exist", loadCaseId, componentId)});
-              continue;
-            }
-
-            const auto attributeNodes =
-              doc.select_nodes(fmt::format("/model/load_spectrum/load_case[@id = '{}']/component[@id = '{}']/attribute",
-                                           loadCaseId, componentId)
-                                 .c_str());
-            const auto context = fmt::format("load_case id={}", loadCaseId);
-            TAttributes attributes = getAttributes(context, result, componentId,
-                                                   dbModel.findComponentById(refComponent->getType()), attributeNodes);
-            loadComponents.emplace_back(TLoadComponent(*refComponent, std::move(attributes)));
-          } catch (const std::exception& ex) {
-            result.addError(TError{m_Mode.adapt(TErrorLevel::ERR), fmt::format("load_case id={} component id={}: {}",
-                                                                               loadCaseId, componentId, ex.what())});
-          }
+  inline TLoadCase TXMLModelLoader::getLoadCase(TResult& result, const database::TModel& dbModel,
+                                                const detail::ComponentMapping& componentsMapping,
+                                                const TComponents& components, const pugi::xml_node& loadCase) const
+  {
+    std::string loadCaseId = detail::getStringAttribute(loadCase, "id");
+    TLoadComponents loadComponents;
+
+    for (const auto& component : loadCase.children("component")) {
+      auto componentId = convertToUint64(component.attribute("id").value());
+      try {
+        const auto* refComponent = componentsMapping.getComponent(componentId, components);
+        if (refComponent == nullptr) {
+          result.addError(
+            TError{m_Mode.adapt(TErrorLevel::ERR),
+                   fmt::format("load_case id={} component id={} does not exist", loadCaseId, componentId)});
+          continue;
         }
-        loadCases.emplace_back(std::move(loadComponents));
+
+        const auto context = fmt::format("load_case id={}", loadCaseId);
+        TAttributes attributes =
+          getAttributes(context, result, componentId, dbModel.findComponentById(refComponent->getType()), component);
+        loadComponents.emplace_back(TLoadComponent(*refComponent, std::move(attributes)));
+      } catch (const std::exception& ex) {
+        result.addError(TError{m_Mode.adapt(TErrorLevel::ERR), fmt::format("load_case id={} component id={}: {}",
+                                                                           loadCaseId, componentId, ex.what())});
       }
     }
-    std::optional<TAccumulation> accumulation;
-    {
-      TLoadComponents loadComponents;
-      for (const auto& component : doc.select_nodes("/model/load_spectrum/accumulation/component")) {
-        auto componentId = convertToUint64(detail::getStringAttribute(component, "id"));
-        try {
-          const auto* refComponent = componentsMapping.getComponent(componentId, components);
-          if (refComponent == nullptr) {
-            result.addError(TError{m_Mode.adapt(TErrorLevel::ERR),
-                                   fmt::format("accumulation component id={} does not exist", componentId)});
-            continue;
-          }
+    return TLoadCase{std::move(loadComponents)};
+  }
 
-          const auto attributeNodes = doc.select_nodes(
-            fmt::format("/model/load_spectrum/accumulation/component[@id = '{}']/attribute", componentId).c_str());
-          TAttributes attributes = getAttributes("accumulation", result, componentId,
-                                                 dbModel.findComponentById(refComponent->getType()), attributeNodes);
-          loadComponents.emplace_back(TLoadComponent(*refComponent, std::move(attributes)));
-        } catch (const std::exception& ex) {
+  inline void TXMLModelLoader::addAccumulationComponents(TResult& result, const database::TModel& dbModel,
+                                                         const detail::ComponentMapping& componentsMapping,
+                                                         const TComponents& components, TLoadComponents& loadComponents,
+                                                         const pugi::xml_node& accumulation) const
+  {
+    for (const auto& component : accumulation.children("component")) {
+      auto componentId = convertToUint64(component.attribute("id").value());
+      try {
+        const auto* refComponent = componentsMapping.getComponent(componentId, components);
+        if (refComponent == nullptr) {
           result.addError(TError{m_Mode.adapt(TErrorLevel::ERR),
-                                 fmt::format("accumulation component id={}: {}", componentId, ex.what())});
+                                 fmt::format("accumulation component id={} does not exist", componentId)});
+          continue;
         }
+
+        TAttributes attributes = getAttributes("accumulation", result, componentId,
+                                               dbModel.findComponentById(refComponent->getType()), component);
+        loadComponents.emplace_back(TLoadComponent(*refComponent, std::move(attributes)));
+      } catch (const std::exception& ex) {
+        result.addError(TError{m_Mode.adapt(TErrorLevel::ERR),
+                               fmt::format("accumulation component id={}: {}", componentId, ex.what())});
       }
-      if (!loadComponents.empty()) {
-        accumulation = TAccumulation{std::move(loadComponents)};
-      }
+    }
+  }
+
+  inline std::optional<TModel> TXMLModelLoader::createModel(TResult& result, const database::TModelRegistry& registry,
+                                                            TModelInfo info, TComponents components,
+                                                            TRelations relations, TLoadCases loadCases,
+                                                            TLoadComponents accumulationComponents) const
+  {
+    std::optional<TAccumulation> accumulation;
+    if (!accumulationComponents.empty()) {
+      accumulation = TAccumulation{std::move(accumulationComponents)};
     }
 
     std::optional<TModel> model = TModel{std::move(info), std::move(components), std::move(relations),
@@ -263,7 +558,7 @@ namespace rexsapi
     std::set<std::string, std::less<>> referencedDataSources;
     const detail::TComponentFinder finder{model->getComponents()};
     for (const auto& attribute : finder.findAllAttributesByAttributeId("data_source")) {
-      referencedDataSources.emplace(attribute.getValueAsString());
+      referencedDataSources.emplace(attribute.get().getValueAsString());
     }
     if (m_DataSourceResolver != nullptr) {
       for (const auto& dataSource : referencedDataSources) {
@@ -310,10 +605,10 @@ namespace rexsapi
 
   inline TAttributes TXMLModelLoader::getAttributes(const std::string& context, TResult& result, uint64_t componentId,
                                                     const database::TComponent& componentType,
-                                                    const pugi::xpath_node_set& attributeNodes) const
+                                                    const pugi::xml_node& node) const
   {
     TAttributes attributes;
-    for (const auto& attribute : attributeNodes) {
+    for (const auto& attribute : node.children("attribute")) {
       std::string id = detail::getStringAttribute(attribute, "id");
       auto unit = detail::getStringAttribute(attribute, "unit");
 
@@ -333,7 +628,7 @@ namespace rexsapi
           }
         }
 
-        auto value = m_LoaderHelper.getValue(result, context, id, componentId, att, attribute.node());
+        auto value = m_LoaderHelper.getValue(result, context, id, componentId, att, attribute);
         TAttribute newAttribute{att, std::move(value)};
         if (checkDuplicate(attributes, newAttribute)) {
           result.addError(TError{m_Mode.adapt(TErrorLevel::ERR),
@@ -342,7 +637,7 @@ namespace rexsapi
         }
         attributes.emplace_back(std::move(newAttribute));
       } else {
-        auto [value, type] = m_LoaderHelper.getDecoder().decodeUnknown(attribute.node());
+        auto [value, type] = m_LoaderHelper.getDecoder().decodeUnknown(attribute);
         attributes.emplace_back(TAttribute{id, TUnit{unit}, type, std::move(value)});
       }
     }
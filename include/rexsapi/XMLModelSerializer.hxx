@@ -19,8 +19,11 @@
 
 #include <rexsapi/CodedValue.hxx>
 #include <rexsapi/Model.hxx>
+#include <rexsapi/XMLStreamWriter.hxx>
 #include <rexsapi/Xml.hxx>
 
+#include <type_traits>
+
 namespace rexsapi
 {
   /**
@@ -41,25 +44,46 @@ namespace rexsapi
      * @param model The model to serialize
      * @param serializer The serializer to output the serialized model with
      */
-    template<typename TSerializer>
+    template<typename TSerializer, typename = std::enable_if_t<!std::is_base_of_v<std::ostream, TSerializer>>>
     void serialize(const TModel& model, TSerializer& serializer);
 
+    /**
+     * @brief Serializes a TModel in REXS xml format directly to a stream.
+     *
+     * Does not create an xml object, the model is written piece by piece to the stream using a bounded buffer. The
+     * output is byte-identical to the output of the TXMLFileSerializer and TXMLStringSerializer, including the UTF-8
+     * BOM. Should be preferred for large models.
+     *
+     * @param model The model to serialize
+     * @param stream The stream to write the model to. Streams writing to files should be opened in binary mode.
+     * @throws TException if the model cannot be serialized or the stream cannot be written
+     */
+    void serialize(const TModel& model, std::ostream& stream);
+
   private:
-    void createDocument();
+    template<typename TWriter>
+    void serializeModel(TWriter& writer, const TModel& model);
 
-    pugi::xml_node serialize(const TModelInfo& info);
+    template<typename TWriter>
+    void serialize(TWriter& writer, const TModelInfo& info);
 
-    void serialize(pugi::xml_node& relationsNode, const TRelations& relations);
+    template<typename TWriter>
+    void serialize(TWriter& writer, const TRelations& relations);
 
-    void serialize(pugi::xml_node& modelNode, const TComponents& components);
+    template<typename TWriter>
+    void serialize(TWriter& writer, const TComponents& components);
 
-    pugi::xml_node serialize(pugi::xml_node& componentsNode, const TComponent& component);
+    template<typename TWriter>
+    void serialize(TWriter& writer, const TAttributes& attributes);
 
-    void serialize(pugi::xml_node& compNode, const TAttributes& attributes);
+    template<typename TWriter>
+    void serialize(TWriter& writer, const TAttribute& attribute);
 
-    void serialize(pugi::xml_node& attNode, const TAttribute& attribute);
+    template<typename TWriter>
+    void serialize(TWriter& writer, const TLoadSpectrum& loadSpectrum);
 
-    void serialize(pugi::xml_node& loadSpectrumNode, const TLoadSpectrum& loadSpectrum);
+    template<typename TWriter>
+    void serialize(TWriter& writer, const TLoadComponents& loadComponents);
 
     std::string getNextComponentId() noexcept
     {
@@ -71,295 +95,369 @@ namespace rexsapi
       return std::to_string(++m_RelationId);
     }
 
-    std::string getComponentId(uint64_t internalId) const;
+    const std::string& getComponentId(uint64_t internalId) const;
 
-    pugi::xml_document m_Doc;
     uint64_t m_ComponentId{0};
     uint64_t m_RelationId{0};
     std::unordered_map<uint64_t, std::string> m_ComponentMapping;
   };
 
 
-  /////////////////////////////////////////////////////////////////////////////
-  // Implementation
-  /////////////////////////////////////////////////////////////////////////////
-
-  template<typename TSerializer>
-  inline void XMLModelSerializer::serialize(const TModel& model, TSerializer& serializer)
+  namespace detail
   {
-    createDocument();
-    auto models = serialize(model.getInfo());
-    pugi::xml_node relationsNode = models.append_child("relations");
-    serialize(models, model.getComponents());
-    serialize(relationsNode, model.getRelations());
+    /**
+     * @brief Event based xml writer creating a pugixml document.
+     *
+     * Offers the same interface as the TXMLStreamWriter.
+     */
+    class TXMLDocumentWriter
+    {
+    public:
+      explicit TXMLDocumentWriter(pugi::xml_document& doc)
+      : m_Doc{doc}
+      {
+      }
 
-    if (model.getLoadSpectrum().hasLoadCases()) {
-      pugi::xml_node loadSpectrum = models.append_child("load_spectrum");
-      serialize(loadSpectrum, model.getLoadSpectrum());
-    }
+      void startDocument();
+
+      void startElement(const char* name)
+      {
+        m_Nodes.emplace_back(m_Nodes.empty() ? m_Doc.append_child(name) : m_Nodes.back().append_child(name));
+      }
+
+      void attribute(const char* name, const std::string& value)
+      {
+        m_Nodes.back().append_attribute(name).set_value(value.c_str());
+      }
 
-    serializer.serialize(m_Doc);
+      void text(const std::string& value)
+      {
+        m_Nodes.back().append_child(pugi::node_pcdata).set_value(value.c_str());
+      }
+
+      void endElement()
+      {
+        m_Nodes.pop_back();
+      }
+
+      void endDocument() const noexcept
+      {
+      }
+
+    private:
+      pugi::xml_document& m_Doc;
+      std::vector<pugi::xml_node> m_Nodes;
+    };
   }
 
-  inline void XMLModelSerializer::createDocument()
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  inline void detail::TXMLDocumentWriter::startDocument()
   {
     m_Doc.reset();
+    m_Nodes.clear();
     auto decl = m_Doc.append_child(pugi::node_declaration);
     decl.append_attribute("version") = "1.0";
     decl.append_attribute("encoding") = "UTF-8";
     decl.append_attribute("standalone") = "no";
   }
 
-  inline pugi::xml_node XMLModelSerializer::serialize(const TModelInfo& info)
+  template<typename TSerializer, typename>
+  inline void XMLModelSerializer::serialize(const TModel& model, TSerializer& serializer)
+  {
+    pugi::xml_document doc;
+    detail::TXMLDocumentWriter writer{doc};
+    serializeModel(writer, model);
+    serializer.serialize(doc);
+  }
+
+  inline void XMLModelSerializer::serialize(const TModel& model, std::ostream& stream)
+  {
+    detail::TXMLStreamWriter writer{stream};
+    serializeModel(writer, model);
+  }
+
+  template<typename TWriter>
+  inline void XMLModelSerializer::serializeModel(TWriter& writer, const TModel& model)
   {
-    pugi::xml_node modelNode = m_Doc.append_child("model");
-    modelNode.append_attribute("applicationId").set_value(info.getApplicationId().c_str());
-    modelNode.append_attribute("applicationVersion").set_value(info.getApplicationVersion().c_str());
-    modelNode.append_attribute("date").set_value(info.getDate().c_str());
-    modelNode.append_attribute("version").set_value(info.getVersion().asString().c_str());
+    m_ComponentId = 0;
+    m_RelationId = 0;
+    m_ComponentMapping.clear();
+    for (const auto& component : model.getComponents()) {
+      m_ComponentMapping.emplace(component.getInternalId(), getNextComponentId());
+    }
+
+    writer.startDocument();
+    serialize(writer, model.getInfo());
+    serialize(writer, model.getRelations());
+    serialize(writer, model.getComponents());
+    if (model.getLoadSpectrum().hasLoadCases()) {
+      serialize(writer, model.getLoadSpectrum());
+    }
+    writer.endElement();
+    writer.endDocument();
+  }
+
+  template<typename TWriter>
+  inline void XMLModelSerializer::serialize(TWriter& writer, const TModelInfo& info)
+  {
+    writer.startElement("model");
+    writer.attribute("applicationId", info.getApplicationId());
+    writer.attribute("applicationVersion", info.getApplicationVersion());
+    writer.attribute("date", info.getDate());
+    writer.attribute("version", info.getVersion().asString());
     if (info.getApplicationLanguage().has_value()) {
-      modelNode.append_attribute("applicationLanguage").set_value(info.getApplicationLanguage()->c_str());
+      writer.attribute("applicationLanguage", *info.getApplicationLanguage());
     }
-    return modelNode;
   }
 
-  inline void XMLModelSerializer::serialize(pugi::xml_node& relationsNode, const TRelations& relations)
+  template<typename TWriter>
+  inline void XMLModelSerializer::serialize(TWriter& writer, const TRelations& relations)
   {
+    writer.startElement("relations");
     for (const auto& relation : relations) {
-      pugi::xml_node relNode = relationsNode.append_child("relation");
-      relNode.append_attribute("id").set_value(getNextRelationId().c_str());
-      relNode.append_attribute("type").set_value(toRelationTypeString(relation.getType()).c_str());
+      writer.startElement("relation");
+      writer.attribute("id", getNextRelationId());
+      writer.attribute("type", toRelationTypeString(relation.getType()));
       if (relation.getOrder().has_value()) {
-        relNode.append_attribute("order").set_value(relation.getOrder().value());
+        writer.attribute("order", std::to_string(relation.getOrder().value()));
       }
       for (const auto& reference : relation.getReferences()) {
-        pugi::xml_node refNode = relNode.append_child("ref");
+        writer.startElement("ref");
         if (!reference.getHint().empty()) {
-          refNode.append_attribute("hint").set_value(reference.getHint().c_str());
+          writer.attribute("hint", reference.getHint());
         }
-        auto id = getComponentId(reference.getComponent().getInternalId());
-        refNode.append_attribute("id").set_value(id.c_str());
-        refNode.append_attribute("role").set_value(toRelationRoleString(reference.getRole()).c_str());
+        writer.attribute("id", getComponentId(reference.getComponent().getInternalId()));
+        writer.attribute("role", toRelationRoleString(reference.getRole()));
+        writer.endElement();
       }
+      writer.endElement();
     }
+    writer.endElement();
   }
 
-  inline void XMLModelSerializer::serialize(pugi::xml_node& modelNode, const TComponents& components)
+  template<typename TWriter>
+  inline void XMLModelSerializer::serialize(TWriter& writer, const TComponents& components)
   {
-    pugi::xml_node componentsNode = modelNode.append_child("components");
-    for (const auto& component : components) {
-      auto id = getNextComponentId();
-      m_ComponentMapping.emplace(component.getInternalId(), id);
-    }
+    writer.startElement("components");
     for (const auto& component : components) {
-      auto compNode = serialize(componentsNode, component);
-      serialize(compNode, component.getAttributes());
+      writer.startElement("component");
+      writer.attribute("id", getComponentId(component.getInternalId()));
+      writer.attribute("name", component.getName());
+      writer.attribute("type", component.getType());
+      serialize(writer, component.getAttributes());
+      writer.endElement();
     }
+    writer.endElement();
   }
 
-  inline pugi::xml_node XMLModelSerializer::serialize(pugi::xml_node& componentsNode, const TComponent& component)
-  {
-    pugi::xml_node compNode = componentsNode.append_child("component");
-    compNode.append_attribute("id").set_value(getComponentId(component.getInternalId()).c_str());
-    compNode.append_attribute("name").set_value(component.getName().c_str());
-    compNode.append_attribute("type").set_value(component.getType().c_str());
-    return compNode;
-  }
-
-  inline void XMLModelSerializer::serialize(pugi::xml_node& compNode, const TAttributes& attributes)
+  template<typename TWriter>
+  inline void XMLModelSerializer::serialize(TWriter& writer, const TAttributes& attributes)
   {
     for (const auto& attribute : attributes) {
-      pugi::xml_node attNode = compNode.append_child("attribute");
-      attNode.append_attribute("id").set_value(attribute.getAttributeId().c_str());
-      attNode.append_attribute("unit").set_value(attribute.getUnit().getName().c_str());
-      serialize(attNode, attribute);
+      writer.startElement("attribute");
+      writer.attribute("id", attribute.getAttributeId());
+      writer.attribute("unit", attribute.getUnit().getName());
+      serialize(writer, attribute);
+      writer.endElement();
     }
   }
 
-  template<typename T>
-  inline void xmlEncodeCodedArray(pugi::xml_node& attNode, const TValue& value, const std::vector<T>& array,
+  template<typename TWriter, typename T>
+  inline void xmlEncodeCodedArray(TWriter& writer, const TValue& value, const std::vector<T>& array,
                                   std::function<std::string(typename std::vector<T>::value_type)>&& formatter)
   {
-    auto arrayNode = attNode.append_child("array");
+    writer.startElement("array");
 
     if (value.coded() != TCodeType::None) {
       const auto [val, code] = detail::encodeArray(array, value.coded());
-      arrayNode.append_attribute("code").set_value(detail::toCodedValueString(code).c_str());
-      arrayNode.append_child(pugi::node_pcdata).set_value(val.c_str());
+      writer.attribute("code", detail::toCodedValueString(code));
+      writer.text(val);
     } else {
       for (const T& element : array) {
-        auto child = arrayNode.append_child("c");
-        child.append_child(pugi::node_pcdata).set_value(formatter(element).c_str());
+        writer.startElement("c");
+        writer.text(formatter(element));
+        writer.endElement();
       }
     }
+    writer.endElement();
   }
 
-  template<typename T>
-  inline void xmlEncodeCodedMatrix(pugi::xml_node& attNode, const TValue& value, const TMatrix<T>& matrix,
+  template<typename TWriter, typename T>
+  inline void xmlEncodeCodedMatrix(TWriter& writer, const TValue& value, const TMatrix<T>& matrix,
                                    std::function<std::string(typename TMatrix<T>::value_type)>&& formatter)
   {
-    auto matrixNode = attNode.append_child("matrix");
+    writer.startElement("matrix");
 
     if (value.coded() != TCodeType::None) {
       const auto [val, code] = detail::encodeMatrix(matrix, value.coded());
-      matrixNode.append_attribute("code").set_value(detail::toCodedValueString(code).c_str());
-      matrixNode.append_attribute("rows").set_value(matrix.m_Values.size());
-      matrixNode.append_attribute("columns").set_value(matrix.m_Values.size());
-      matrixNode.append_child(pugi::node_pcdata).set_value(val.c_str());
+      writer.attribute("code", detail::toCodedValueString(code));
+      writer.attribute("rows", std::to_string(matrix.getRowCount()));
+      writer.attribute("columns", std::to_string(matrix.getColumnCount()));
+      writer.text(val);
     } else {
-      for (const auto& row : matrix.m_Values) {
-        auto rowNode = matrixNode.append_child("r");
-        for (const auto& column : row) {
-          auto child = rowNode.append_child("c");
-          child.append_child(pugi::node_pcdata).set_value(formatter(column).c_str());
+      for (size_t row = 0; row < matrix.getRowCount(); ++row) {
+        writer.startElement("r");
+        for (const auto& column : matrix.getRow(row)) {
+          writer.startElement("c");
+          writer.text(formatter(column));
+          writer.endElement();
         }
+        writer.endElement();
       }
     }
+    writer.endElement();
   }
 
-  inline void XMLModelSerializer::serialize(pugi::xml_node& attNode, const TAttribute& attribute)
+  template<typename TWriter>
+  inline void XMLModelSerializer::serialize(TWriter& writer, const TAttribute& attribute)
   {
     if (attribute.getValue().isEmpty()) {
       return;
     }
 
-    rexsapi::dispatch<void>(
+    auto writeElements = [&writer](const char* name, const auto& elements) {
+      writer.startElement(name);
+      for (const auto& element : elements) {
+        writer.startElement("c");
+        writer.text(fmt::format("{}", element));
+        writer.endElement();
+      }
+      writer.endElement();
+    };
+
+    rexsapi::visitValue(
       attribute.getValueType(), attribute.getValue(),
-      {[&attNode](rexsapi::TFloatTag, const auto& d) -> void {
-         attNode.append_child(pugi::node_pcdata).set_value(format(d).c_str());
-       },
-       [&attNode](rexsapi::TBoolTag, const auto& b) -> void {
-         attNode.append_child(pugi::node_pcdata).set_value(fmt::format("{}", b).c_str());
-       },
-       [&attNode](rexsapi::TIntTag, const auto& i) -> void {
-         attNode.append_child(pugi::node_pcdata).set_value(fmt::format("{}", i).c_str());
-       },
-       [&attNode](rexsapi::TEnumTag, const auto& s) -> void {
-         attNode.append_child(pugi::node_pcdata).set_value(s.c_str());
-       },
-       [&attNode](rexsapi::TStringTag, const auto& s) -> void {
-         attNode.append_child(pugi::node_pcdata).set_value(s.c_str());
-       },
-       [&attNode](rexsapi::TFileReferenceTag, const auto& s) -> void {
-         attNode.append_child(pugi::node_pcdata).set_value(s.c_str());
-       },
-       [&attNode](rexsapi::TDatetimeTag, const auto& d) -> void {
-         attNode.append_child(pugi::node_pcdata).set_value(d.asUTCString().data());
-       },
-       [&attNode, &attribute](rexsapi::TFloatArrayTag, const auto& a) -> void {
-         xmlEncodeCodedArray(attNode, attribute.getValue(), a, [](double element) {
-           return format(element);
-         });
-       },
-       [&attNode](rexsapi::TBoolArrayTag, const auto& a) -> void {
-         auto arrayNode = attNode.append_child("array");
-         for (const auto& element : a) {
-           auto child = arrayNode.append_child("c");
-           child.append_child(pugi::node_pcdata).set_value(fmt::format("{}", element.m_Value).c_str());
-         }
-       },
-       [&attNode, &attribute](rexsapi::TIntArrayTag, const auto& a) -> void {
-         xmlEncodeCodedArray(attNode, attribute.getValue(), a, [](auto element) {
-           return fmt::format("{}", element);
-         });
-       },
-       [&attNode](rexsapi::TEnumArrayTag, const auto& a) -> void {
-         auto arrayNode = attNode.append_child("array");
-         for (const auto& element : a) {
-           auto child = arrayNode.append_child("c");
-           child.append_child(pugi::node_pcdata).set_value(fmt::format("{}", element).c_str());
-         }
-       },
-       [&attNode](rexsapi::TStringArrayTag, const auto& a) -> void {
-         auto arrayNode = attNode.append_child("array");
-         for (const auto& element : a) {
-           auto child = arrayNode.append_child("c");
-           child.append_child(pugi::node_pcdata).set_value(fmt::format("{}", element).c_str());
-         }
-       },
-       [&attNode](rexsapi::TReferenceComponentTag, const auto& n) -> void {
-         attNode.append_child(pugi::node_pcdata).set_value(fmt::format("{}", n).c_str());
-       },
-       [&attNode, &attribute](rexsapi::TFloatMatrixTag, const auto& m) -> void {
-         xmlEncodeCodedMatrix(attNode, attribute.getValue(), m, [](auto element) {
-           return format(element);
-         });
-       },
-       [&attNode, &attribute](rexsapi::TIntMatrixTag, const auto& m) -> void {
-         xmlEncodeCodedMatrix(attNode, attribute.getValue(), m, [](auto element) {
-           return format(static_cast<double>(element));
-         });
-       },
-       [&attNode](rexsapi::TBoolMatrixTag, const auto& m) -> void {
-         auto matrixNode = attNode.append_child("matrix");
-         for (const auto& row : m.m_Values) {
-           auto rowNode = matrixNode.append_child("r");
-           for (const auto& column : row) {
-             auto child = rowNode.append_child("c");
-             child.append_child(pugi::node_pcdata).set_value(fmt::format("{}", *column).c_str());
-           }
-         }
-       },
-       [&attNode](rexsapi::TStringMatrixTag, const auto& m) -> void {
-         auto matrixNode = attNode.append_child("matrix");
-         for (const auto& row : m.m_Values) {
-           auto rowNode = matrixNode.append_child("r");
-           for (const auto& column : row) {
-             auto child = rowNode.append_child("c");
-             child.append_child(pugi::node_pcdata).set_value(fmt::format("{}", column).c_str());
-           }
-         }
-       },
-       [&attNode](rexsapi::TArrayOfIntArraysTag, const auto& a) -> void {
-         auto arraysNode = attNode.append_child("array_of_arrays");
-         for (const auto& array : a) {
-           auto aNode = arraysNode.append_child("array");
-           for (const auto& c : array) {
-             auto child = aNode.append_child("c");
-             child.append_child(pugi::node_pcdata).set_value(fmt::format("{}", c).c_str());
-           }
-         }
-       }});
+      detail::overload{[&writer](rexsapi::TFloatTag, const auto& d) -> void {
+                         writer.text(format(d));
+                       },
+                       [&writer](rexsapi::TBoolTag, const auto& b) -> void {
+                         writer.text(fmt::format("{}", b));
+                       },
+                       [&writer](rexsapi::TIntTag, const auto& i) -> void {
+                         writer.text(fmt::format("{}", i));
+                       },
+                       [&writer](rexsapi::TEnumTag, const auto& s) -> void {
+                         writer.text(s);
+                       },
+                       [&writer](rexsapi::TStringTag, const auto& s) -> void {
+                         writer.text(s);
+                       },
+                       [&writer](rexsapi::TFileReferenceTag, const auto& s) -> void {
+                         writer.text(s);
+                       },
+                       [&writer](rexsapi::TDatetimeTag, const auto& d) -> void {
+                         writer.text(d.asUTCString());
+                       },
+                       [&writer, &attribute](rexsapi::TFloatArrayTag, const auto& a) -> void {
+                         xmlEncodeCodedArray(writer, attribute.getValue(), a, [](double element) {
+                           return format(element);
+                         });
+                       },
+                       [&writer](rexsapi::TBoolArrayTag, const auto& a) -> void {
+                         writer.startElement("array");
+                         for (const auto& element : a) {
+                           writer.startElement("c");
+                           writer.text(fmt::format("{}", element.m_Value));
+                           writer.endElement();
+                         }
+                         writer.endElement();
+                       },
+                       [&writer, &attribute](rexsapi::TIntArrayTag, const auto& a) -> void {
+                         xmlEncodeCodedArray(writer, attribute.getValue(), a, [](auto element) {
+                           return fmt::format("{}", element);
+                         });
+                       },
+                       [&writeElements](rexsapi::TEnumArrayTag, const auto& a) -> void {
+                         writeElements("array", a);
+                       },
+                       [&writeElements](rexsapi::TStringArrayTag, const auto& a) -> void {
+                         writeElements("array", a);
+                       },
+                       [&writer](rexsapi::TReferenceComponentTag, const auto& n) -> void {
+                         writer.text(fmt::format("{}", n));
+                       },
+                       [&writer, &attribute](rexsapi::TFloatMatrixTag, const auto& m) -> void {
+                         xmlEncodeCodedMatrix(writer, attribute.getValue(), m, [](auto element) {
+                           return format(element);
+                         });
+                       },
+                       [&writer, &attribute](rexsapi::TIntMatrixTag, const auto& m) -> void {
+                         xmlEncodeCodedMatrix(writer, attribute.getValue(), m, [](auto element) {
+                           return format(static_cast<double>(element));
+                         });
+                       },
+                       [&writer](rexsapi::TBoolMatrixTag, const auto& m) -> void {
+                         writer.startElement("matrix");
+                         for (size_t row = 0; row < m.getRowCount(); ++row) {
+                           writer.startElement("r");
+                           for (const auto& column : m.getRow(row)) {
+                             writer.startElement("c");
+                             writer.text(fmt::format("{}", *column));
+                             writer.endElement();
+                           }
+                           writer.endElement();
+                         }
+                         writer.endElement();
+                       },
+                       [&writer, &writeElements](rexsapi::TStringMatrixTag, const auto& m) -> void {
+                         writer.startElement("matrix");
+                         for (size_t row = 0; row < m.getRowCount(); ++row) {
+                           writeElements("r", m.getRow(row));
+                         }
+                         writer.endElement();
+                       },
+                       [&writer, &writeElements](rexsapi::TArrayOfIntArraysTag, const auto& a) -> void {
+                         writer.startElement("array_of_arrays");
+                         for (const auto& array : a) {
+                           writeElements("array", array);
+                         }
+                         writer.endElement();
+                       }});
   }
 
-  inline void XMLModelSerializer::serialize(pugi::xml_node& loadSpectrumNode, const TLoadSpectrum& loadSpectrum)
+  template<typename TWriter>
+  inline void XMLModelSerializer::serialize(TWriter& writer, const TLoadSpectrum& loadSpectrum)
   {
-    loadSpectrumNode.append_attribute("id").set_value("1");
+    writer.startElement("load_spectrum");
+    writer.attribute("id", "1");
 
     uint64_t loadCaseId{0};
     for (const auto& loadCase : loadSpectrum.getLoadCases()) {
-      pugi::xml_node loadCaseNode = loadSpectrumNode.append_child("load_case");
-      loadCaseNode.append_attribute("id").set_value(std::to_string(++loadCaseId).c_str());
-      for (const auto& loadComponent : loadCase.getLoadComponents()) {
-        const auto& component = loadComponent.getComponent();
-        pugi::xml_node compNode = loadCaseNode.append_child("component");
-        auto id = getComponentId(component.getInternalId());
-        compNode.append_attribute("id").set_value(id.c_str());
-        if (!component.getName().empty()) {
-          compNode.append_attribute("name").set_value(component.getName().c_str());
-        }
-        compNode.append_attribute("type").set_value(component.getType().c_str());
-        serialize(compNode, loadComponent.getLoadAttributes());
-      }
+      writer.startElement("load_case");
+      writer.attribute("id", std::to_string(++loadCaseId));
+      serialize(writer, loadCase.getLoadComponents());
+      writer.endElement();
     }
 
     if (loadSpectrum.hasAccumulation()) {
-      pugi::xml_node accumulationNode = loadSpectrumNode.append_child("accumulation");
-      for (const auto& loadComponent : loadSpectrum.getAccumulation().getLoadComponents()) {
-        const auto& component = loadComponent.getComponent();
-        pugi::xml_node compNode = accumulationNode.append_child("component");
-        auto id = getComponentId(component.getInternalId());
-        compNode.append_attribute("id").set_value(id.c_str());
-        if (!component.getName().empty()) {
-          compNode.append_attribute("name").set_value(component.getName().c_str());
-        }
-        compNode.append_attribute("type").set_value(component.getType().c_str());
-        serialize(compNode, loadComponent.getLoadAttributes());
+      writer.startElement("accumulation");
+      serialize(writer, loadSpectrum.getAccumulation().getLoadComponents());
+      writer.endElement();
+    }
+    writer.endElement();
+  }
+
+  template<typename TWriter>
+  inline void XMLModelSerializer::serialize(TWriter& writer, const TLoadComponents& loadComponents)
+  {
+    for (const auto& loadComponent : loadComponents) {
+      const auto& component = loadComponent.getComponent();
+      writer.startElement("component");
+      writer.attribute("id", getComponentId(component.getInternalId()));
+      if (!component.getName().empty()) {
+        writer.attribute("name", component.getName());
       }
+      writer.attribute("type", component.getType());
+      serialize(writer, loadComponent.getLoadAttributes());
+      writer.endElement();
     }
   }
 
-  inline std::string XMLModelSerializer::getComponentId(uint64_t internalId) const
+  inline const std::string& XMLModelSerializer::getComponentId(uint64_t internalId) const
   {
     auto it = m_ComponentMapping.find(internalId);
     if (it == m_ComponentMapping.end()) {
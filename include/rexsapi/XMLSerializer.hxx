@@ -73,9 +73,9 @@ namespace rexsapi
   public:
     void serialize(const pugi::xml_document& doc)
     {
-      std::stringstream stream;
-      doc.save(stream, "  ", pugi::format_indent | pugi::format_write_bom, pugi::encoding_utf8);
-      m_Model = stream.str();
+      m_Model.clear();
+      TStringWriter writer{m_Model};
+      doc.save(writer, "  ", pugi::format_indent | pugi::format_write_bom, pugi::encoding_utf8);
     }
 
     /**
@@ -89,6 +89,20 @@ namespace rexsapi
     }
 
   private:
+    struct TStringWriter : pugi::xml_writer {
+      explicit TStringWriter(std::string& model)
+      : m_Model{model}
+      {
+      }
+
+      void write(const void* data, size_t size) override
+      {
+        m_Model.append(static_cast<const char*>(data), size);
+      }
+
+      std::string& m_Model;
+    };
+
     std::string m_Model;
   };
 }
@@ -0,0 +1,488 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_XML_STREAM_READER_HXX
+#define REXSAPI_XML_STREAM_READER_HXX
+
+#include <rexsapi/Exception.hxx>
+#include <rexsapi/Format.hxx>
+#include <rexsapi/Xml.hxx>
+
+#include <charconv>
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace rexsapi::detail
+{
+  enum class TXMLEvent { START_ELEMENT, END_ELEMENT, TEXT, END_DOCUMENT };
+
+  using TXMLAttributes = std::vector<std::pair<std::string, std::string>>;
+
+
+  /**
+   * @brief Event based xml reader working on a stream.
+   *
+   * Reads an xml document piece by piece from a stream and reports start elements, end elements, and text as events.
+   * Only the current event is kept in memory. Comments, processing instructions, and document type declarations are
+   * skipped. Text consisting only of whitespace is skipped as well, mirroring the default pugixml parse options.
+   *
+   * Self-closing elements will be reported as a start element directly followed by an end element.
+   */
+  class TXMLStreamReader
+  {
+  public:
+    /**
+     * @brief Constructs a new TXMLStreamReader object.
+     *
+     * @param stream The stream to read the xml document from. Has to outlive the reader.
+     * @throws TException if the stream has no buffer associated
+     */
+    explicit TXMLStreamReader(std::istream& stream);
+
+    /**
+     * @brief Reads the next event from the stream.
+     *
+     * @return TXMLEvent The event read. TXMLEvent::END_DOCUMENT will be returned once the stream has been consumed.
+     * @throws TException if the document is not well-formed
+     */
+    TXMLEvent next();
+
+    /**
+     * @brief Reads the complete element the reader is currently positioned at into a pugixml node.
+     *
+     * Has to be called directly after next() returned TXMLEvent::START_ELEMENT. Will append the element with all
+     * attributes and children to the given parent and position the reader after the elements end.
+     *
+     * @param parent The node to append the element to
+     * @return pugi::xml_node The appended element
+     * @throws TException if the document is not well-formed
+     */
+    pugi::xml_node readElement(pugi::xml_node parent);
+
+    [[nodiscard]] const std::string& getName() const& noexcept
+    {
+      return m_Name;
+    }
+
+    [[nodiscard]] const TXMLAttributes& getAttributes() const& noexcept
+    {
+      return m_Attributes;
+    }
+
+    [[nodiscard]] const std::string& getText() const& noexcept
+    {
+      return m_Text;
+    }
+
+    /**
+     * @brief Returns the offset of the current event in bytes from the start of the stream.
+     *
+     */
+    [[nodiscard]] uint64_t getOffset() const noexcept
+    {
+      return m_EventOffset;
+    }
+
+  private:
+    int peek();
+    int get();
+    void expect(char c);
+    [[noreturn]] void fail(const std::string& message) const;
+
+    bool readText();
+    void readCData();
+    void readStartElement();
+    void readEndElement();
+    void readReference(std::string& value);
+    std::string readName();
+    void skipUntil(std::string_view terminator);
+    void skipDocumentType();
+    void skipWhitespace();
+
+    static bool isWhitespace(int c) noexcept
+    {
+      return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    static void appendUtf8(std::string& value, uint32_t codepoint);
+
+    std::streambuf* m_Buffer;
+    uint64_t m_Offset{0};
+    uint64_t m_EventOffset{0};
+    std::string m_Name;
+    TXMLAttributes m_Attributes;
+    std::string m_Text;
+    std::vector<std::string> m_Elements;
+    bool m_PendingEnd{false};
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  inline TXMLStreamReader::TXMLStreamReader(std::istream& stream)
+  : m_Buffer{stream.rdbuf()}
+  {
+    if (m_Buffer == nullptr) {
+      throw TException{"xml stream has no buffer"};
+    }
+    // skip an utf-8 byte order mark
+    if (peek() == 0xEF) {
+      get();
+      if (get() != 0xBB || get() != 0xBF) {
+        fail("illegal byte order mark");
+      }
+    }
+  }
+
+  inline TXMLEvent TXMLStreamReader::next()
+  {
+    if (m_PendingEnd) {
+      m_PendingEnd = false;
+      m_Name = std::move(m_Elements.back());
+      m_Elements.pop_back();
+      return TXMLEvent::END_ELEMENT;
+    }
+
+    for (;;) {
+      m_EventOffset = m_Offset;
+      auto c = peek();
+      if (c == std::char_traits<char>::eof()) {
+        if (!m_Elements.empty()) {
+          fail(fmt::format("element '{}' is not closed", m_Elements.back()));
+        }
+        return TXMLEvent::END_DOCUMENT;
+      }
+      if (c != '<') {
+        if (readText()) {
+          return TXMLEvent::TEXT;
+        }
+        continue;
+      }
+
+      get();
+      c = peek();
+      if (c == '/') {
+        get();
+        readEndElement();
+        return TXMLEvent::END_ELEMENT;
+      }
+      if (c == '?') {
+        skipUntil("?>");
+        continue;
+      }
+      if (c == '!') {
+        get();
+        c = peek();
+        if (c == '-') {
+          get();
+          expect('-');
+          skipUntil("-->");
+          continue;
+        }
+        if (c == '[') {
+          readCData();
+          return TXMLEvent::TEXT;
+        }
+        skipDocumentType();
+        continue;
+      }
+      readStartElement();
+      return TXMLEvent::START_ELEMENT;
+    }
+  }
+
+  inline pugi::xml_node TXMLStreamReader::readElement(pugi::xml_node parent)
+  {
+    const auto appendElement = [this](pugi::xml_node node) {
+      auto element = node.append_child(m_Name.c_str());
+      for (const auto& [name, value] : m_Attributes) {
+        element.append_attribute(name.c_str()).set_value(value.c_str());
+      }
+      return element;
+    };
+
+    const auto element = appendElement(parent);
+    const auto depth = m_Elements.size();
+    auto current = element;
+    for (;;) {
+      switch (next()) {
+        case TXMLEvent::START_ELEMENT:
+          current = appendElement(current);
+          break;
+        case TXMLEvent::END_ELEMENT:
+          if (m_Elements.size() < depth) {
+            return element;
+          }
+          current = current.parent();
+          break;
+        case TXMLEvent::TEXT:
+          current.append_child(pugi::node_pcdata).set_value(m_Text.c_str());
+          break;
+        case TXMLEvent::END_DOCUMENT:
+          fail(fmt::format("element '{}' is not closed", element.name()));
+      }
+    }
+  }
+
+  inline int TXMLStreamReader::peek()
+  {
+    return m_Buffer->sgetc();
+  }
+
+  inline int TXMLStreamReader::get()
+  {
+    const auto c = m_Buffer->sbumpc();
+    if (c != std::char_traits<char>::eof()) {
+      ++m_Offset;
+    }
+    return c;
+  }
+
+  inline void TXMLStreamReader::expect(char c)
+  {
+    if (get() != std::char_traits<char>::to_int_type(c)) {
+      fail(fmt::format("expected '{}'", c));
+    }
+  }
+
+  inline void TXMLStreamReader::fail(const std::string& message) const
+  {
+    throw TException{fmt::format("malformed xml document at offset {}: {}", m_Offset, message)};
+  }
+
+  inline bool TXMLStreamReader::readText()
+  {
+    m_Text.clear();
+    bool whitespace{true};
+    for (auto c = peek(); c != std::char_traits<char>::eof() && c != '<'; c = peek()) {
+      get();
+      if (c == '&') {
+        readReference(m_Text);
+        whitespace = false;
+        continue;
+      }
+      if (c == '\r') {
+        if (peek() == '\n') {
+          get();
+        }
+        c = '\n';
+      }
+      whitespace = whitespace && isWhitespace(c);
+      m_Text.push_back(static_cast<char>(c));
+    }
+    if (whitespace) {
+      return false;
+    }
+    if (m_Elements.empty()) {
+      fail("text outside of root element");
+    }
+    return true;
+  }
+
+  inline void TXMLStreamReader::readCData()
+  {
+    for (const char c : std::string_view{"[CDATA["}) {
+      expect(c);
+    }
+    if (m_Elements.empty()) {
+      fail("cdata outside of root element");
+    }
+    m_Text.clear();
+    for (;;) {
+      const auto c = get();
+      if (c == std::char_traits<char>::eof()) {
+        fail("cdata section is not closed");
+      }
+      m_Text.push_back(static_cast<char>(c));
+      if (m_Text.size() >= 3 && m_Text.compare(m_Text.size() - 3, 3, "]]>") == 0) {
+        m_Text.resize(m_Text.size() - 3);
+        return;
+      }
+    }
+  }
+
+  inline void TXMLStreamReader::readStartElement()
+  {
+    m_Name = readName();
+    if (m_Name.empty()) {
+      fail("missing element name");
+    }
+    m_Attributes.clear();
+    for (;;) {
+      skipWhitespace();
+      const auto c = peek();
+      if (c == '>') {
+        get();
+        m_Elements.emplace_back(m_Name);
+        return;
+      }
+      if (c == '/') {
+        get();
+        expect('>');
+        m_Elements.emplace_back(m_Name);
+        m_PendingEnd = true;
+        return;
+      }
+
+      auto name = readName();
+      if (name.empty()) {
+        fail(fmt::format("malformed attribute in element '{}'", m_Name));
+      }
+      skipWhitespace();
+      expect('=');
+      skipWhitespace();
+      const auto quote = get();
+      if (quote != '"' && quote != '\'') {
+        fail(fmt::format("value of attribute '{}' is not quoted", name));
+      }
+      std::string value;
+      for (auto v = get(); v != quote; v = get()) {
+        if (v == std::char_traits<char>::eof() || v == '<') {
+          fail(fmt::format("value of attribute '{}' is not closed", name));
+        }
+        if (v == '&') {
+          readReference(value);
+          continue;
+        }
+        if (v == '\r' && peek() == '\n') {
+          get();
+        }
+        value.push_back(isWhitespace(v) ? ' ' : static_cast<char>(v));
+      }
+      m_Attributes.emplace_back(std::move(name), std::move(value));
+    }
+  }
+
+  inline void TXMLStreamReader::readEndElement()
+  {
+    m_Name = readName();
+    skipWhitespace();
+    expect('>');
+    if (m_Elements.empty() || m_Elements.back() != m_Name) {
+      fail(fmt::format("unexpected end of element '{}'", m_Name));
+    }
+    m_Elements.pop_back();
+  }
+
+  inline void TXMLStreamReader::readReference(std::string& value)
+  {
+    std::string reference;
+    for (auto c = get(); c != ';'; c = get()) {
+      if (c == std::char_traits<char>::eof() || reference.size() > 10) {
+        fail("malformed reference");
+      }
+      reference.push_back(static_cast<char>(c));
+    }
+
+    if (reference == "lt") {
+      value.push_back('<');
+    } else if (reference == "gt") {
+      value.push_back('>');
+    } else if (reference == "amp") {
+      value.push_back('&');
+    } else if (reference == "quot") {
+      value.push_back('"');
+    } else if (reference == "apos") {
+      value.push_back('\'');
+    } else if (reference.size() > 1 && reference[0] == '#') {
+      const bool hex = reference[1] == 'x';
+      const auto* first = reference.data() + (hex ? 2 : 1);
+      const auto* last = reference.data() + reference.size();
+      uint32_t codepoint{0};
+      const auto [ptr, ec] = std::from_chars(first, last, codepoint, hex ? 16 : 10);
+      // only characters allowed in xml documents: no null character, surrogates, or values beyond unicode
+      if (ec != std::errc{} || ptr != last || codepoint == 0 || (codepoint >= 0xD800 && codepoint <= 0xDFFF) ||
+          codepoint > 0x10FFFF) {
+        fail(fmt::format("malformed character reference '&{};'", reference));
+      }
+      appendUtf8(value, codepoint);
+    } else {
+      // unknown entities are kept as they are, just like pugixml does
+      value.append("&").append(reference).append(";");
+    }
+  }
+
+  inline std::string TXMLStreamReader::readName()
+  {
+    std::string name;
+    for (auto c = peek(); c != std::char_traits<char>::eof() && !isWhitespace(c) && c != '/' && c != '>' && c != '=';
+         c = peek()) {
+      name.push_back(static_cast<char>(get()));
+    }
+    return name;
+  }
+
+  inline void TXMLStreamReader::skipUntil(std::string_view terminator)
+  {
+    std::string window;
+    while (window != terminator) {
+      const auto c = get();
+      if (c == std::char_traits<char>::eof()) {
+        fail(fmt::format("missing '{}'", terminator));
+      }
+      if (window.size() == terminator.size()) {
+        window.erase(0, 1);
+      }
+      window.push_back(static_cast<char>(c));
+    }
+  }
+
+  inline void TXMLStreamReader::skipDocumentType()
+  {
+    int depth{0};
+    for (auto c = get(); c != '>' || depth > 0; c = get()) {
+      if (c == std::char_traits<char>::eof()) {
+        fail("document type declaration is not closed");
+      }
+      if (c == '[') {
+        ++depth;
+      } else if (c == ']') {
+        --depth;
+      }
+    }
+  }
+
+  inline void TXMLStreamReader::skipWhitespace()
+  {
+    while (isWhitespace(peek())) {
+      get();
+    }
+  }
+
+  inline void TXMLStreamReader::appendUtf8(std::string& value, uint32_t codepoint)
+  {
+    if (codepoint < 0x80) {
+      value.push_back(static_cast<char>(codepoint));
+    } else if (codepoint < 0x800) {
+      value.push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+      value.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    } else if (codepoint < 0x10000) {
+      value.push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+      value.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+      value.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    } else {
+      value.push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+      value.push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+      value.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+      value.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,298 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_XML_STREAM_WRITER_HXX
+#define REXSAPI_XML_STREAM_WRITER_HXX
+
+#include <rexsapi/Exception.hxx>
+#include <rexsapi/Format.hxx>
+
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace rexsapi::detail
+{
+  /**
+   * @brief Event based xml writer working on a stream.
+   *
+   * Writes an xml document element by element to a stream, escaping text and attribute values while writing. The
+   * output is byte-identical to saving a pugixml document containing the same nodes with an indent of two spaces and
+   * the flags `pugi::format_indent | pugi::format_write_bom` in UTF-8 encoding.
+   *
+   * The output is collected in a buffer of bounded size and written to the stream whenever the buffer is full. Apart
+   * from the buffer, only the names of the currently open elements are kept in memory.
+   */
+  class TXMLStreamWriter
+  {
+  public:
+    /**
+     * @brief Constructs a new TXMLStreamWriter object.
+     *
+     * @param stream The stream to write the xml document to. Has to outlive the writer. Streams writing to files should
+     * be opened in binary mode.
+     * @param bufferSize The size of the output buffer in bytes
+     */
+    explicit TXMLStreamWriter(std::ostream& stream, size_t bufferSize = 64 * 1024);
+
+    /**
+     * @brief Writes the UTF-8 BOM and the xml declaration.
+     *
+     */
+    void startDocument();
+
+    /**
+     * @brief Writes the start tag of an element.
+     *
+     * The start tag is left open for attributes until the first child element or text is written.
+     *
+     * @param name The name of the element
+     */
+    void startElement(std::string_view name);
+
+    /**
+     * @brief Writes an attribute of the current element.
+     *
+     * Has to be called before any children or text of the element are written.
+     *
+     * @param name The name of the attribute
+     * @param value The value of the attribute. Will be escaped.
+     * @throws TException if there is no open start tag
+     */
+    void attribute(std::string_view name, std::string_view value);
+
+    /**
+     * @brief Writes text content of the current element.
+     *
+     * @param value The text to write. Will be escaped.
+     * @throws TException if there is no open element
+     */
+    void text(std::string_view value);
+
+    /**
+     * @brief Writes the end tag of the current element.
+     *
+     * Elements without children and text will be written as an empty element tag.
+     *
+     * @throws TException if there is no open element
+     */
+    void endElement();
+
+    /**
+     * @brief Finishes the document and writes the remaining buffer to the stream.
+     *
+     * @throws TException if elements are still open or the stream could not be written
+     */
+    void endDocument();
+
+  private:
+    void write(std::string_view s);
+    void write(char c);
+    void writeIndent(size_t depth);
+    void writeEscaped(std::string_view s, bool attribute);
+    void closeStartTag();
+    void flush();
+
+    std::ostream& m_Stream;
+    size_t m_BufferSize;
+    std::string m_Buffer;
+    std::vector<std::string> m_Elements;
+    bool m_StartTagOpen{false};
+    bool m_Indent{false};
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  inline TXMLStreamWriter::TXMLStreamWriter(std::ostream& stream, size_t bufferSize)
+  : m_Stream{stream}
+  , m_BufferSize{bufferSize}
+  {
+    m_Buffer.reserve(m_BufferSize);
+  }
+
+  inline void TXMLStreamWriter::startDocument()
+  {
+    write("\xef\xbb\xbf<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>");
+    m_Indent = true;
+  }
+
+  inline void TXMLStreamWriter::startElement(std::string_view name)
+  {
+    closeStartTag();
+    // like pugixml, elements following text are not indented
+    if (m_Indent) {
+      write('\n');
+      writeIndent(m_Elements.size());
+    }
+    write('<');
+    write(name);
+    m_Elements.emplace_back(name);
+    m_StartTagOpen = true;
+    m_Indent = true;
+  }
+
+  inline void TXMLStreamWriter::attribute(std::string_view name, std::string_view value)
+  {
+    if (!m_StartTagOpen) {
+      throw TException{fmt::format("cannot write attribute '{}' without open start tag", name)};
+    }
+    write(' ');
+    write(name);
+    write("=\"");
+    writeEscaped(value, true);
+    write('"');
+  }
+
+  inline void TXMLStreamWriter::text(std::string_view value)
+  {
+    if (m_Elements.empty()) {
+      throw TException{"cannot write text without open element"};
+    }
+    closeStartTag();
+    writeEscaped(value, false);
+    m_Indent = false;
+  }
+
+  inline void TXMLStreamWriter::endElement()
+  {
+    if (m_Elements.empty()) {
+      throw TException{"cannot write end tag without open element"};
+    }
+    if (m_StartTagOpen) {
+      write(" />");
+      m_StartTagOpen = false;
+    } else {
+      if (m_Indent) {
+        write('\n');
+        writeIndent(m_Elements.size() - 1);
+      }
+      write("</");
+      write(m_Elements.back());
+      write('>');
+    }
+    m_Elements.pop_back();
+    m_Indent = true;
+  }
+
+  inline void TXMLStreamWriter::endDocument()
+  {
+    if (!m_Elements.empty()) {
+      throw TException{fmt::format("cannot end document with open element '{}'", m_Elements.back())};
+    }
+    if (m_Indent) {
+      write('\n');
+    }
+    flush();
+    m_Stream.flush();
+    if (!m_Stream) {
+      throw TException{"cannot write xml document to stream"};
+    }
+  }
+
+  inline void TXMLStreamWriter::write(std::string_view s)
+  {
+    if (m_Buffer.size() + s.size() > m_BufferSize) {
+      flush();
+      if (s.size() > m_BufferSize) {
+        m_Stream.write(s.data(), static_cast<std::streamsize>(s.size()));
+        return;
+      }
+    }
+    m_Buffer.append(s);
+  }
+
+  inline void TXMLStreamWriter::write(char c)
+  {
+    if (m_Buffer.size() >= m_BufferSize) {
+      flush();
+    }
+    m_Buffer.push_back(c);
+  }
+
+  inline void TXMLStreamWriter::writeIndent(size_t depth)
+  {
+    for (size_t n = 0; n < depth; ++n) {
+      write("  ");
+    }
+  }
+
+  inline void TXMLStreamWriter::writeEscaped(std::string_view s, bool attribute)
+  {
+    // pugixml stores values as c strings, everything after an embedded null is dropped
+    s = s.substr(0, s.find('\0'));
+
+    size_t start = 0;
+    for (size_t n = 0; n < s.size(); ++n) {
+      const auto c = static_cast<unsigned char>(s[n]);
+      std::string_view replacement;
+      switch (c) {
+        case '&':
+          replacement = "&amp;";
+          break;
+        case '<':
+          replacement = "&lt;";
+          break;
+        case '>':
+          if (attribute) {
+            continue;
+          }
+          replacement = "&gt;";
+          break;
+        case '"':
+          if (!attribute) {
+            continue;
+          }
+          replacement = "&quot;";
+          break;
+        default:
+          if (c >= 32 || (!attribute && (c == '\t' || c == '\n' || c == '\r'))) {
+            continue;
+          }
+          break;
+      }
+
+      write(s.substr(start, n - start));
+      start = n + 1;
+      if (!replacement.empty()) {
+        write(replacement);
+      } else {
+        const char reference[] = {'&', '#', static_cast<char>('0' + c / 10), static_cast<char>('0' + c % 10), ';'};
+        write(std::string_view{reference, sizeof(reference)});
+      }
+    }
+    write(s.substr(start));
+  }
+
+  inline void TXMLStreamWriter::closeStartTag()
+  {
+    if (m_StartTagOpen) {
+      write('>');
+      m_StartTagOpen = false;
+    }
+  }
+
+  inline void TXMLStreamWriter::flush()
+  {
+    m_Stream.write(m_Buffer.data(), static_cast<std::streamsize>(m_Buffer.size()));
+    m_Buffer.clear();
+  }
+}
+
+#endif
@@ -115,11 +115,11 @@ namespace rexsapi::detail
       std::pair<TValue, TDecoderResult> onDecode(const std::optional<const database::TEnumValues>&,
                                                  const pugi::xml_node& node) const override
       {
-        try {
-          return std::make_pair(TValue{convertToInt64(node.child_value())}, TDecoderResult::SUCCESS);
-        } catch (const std::exception&) {
+        int64_t value{0};
+        if (tryConvertToInt64(node.child_value(), value) != std::errc{}) {
           return std::make_pair(TValue{}, TDecoderResult::FAILURE);
         }
+        return std::make_pair(TValue{value}, TDecoderResult::SUCCESS);
       }
     };
 
@@ -132,11 +132,11 @@ namespace rexsapi::detail
       std::pair<TValue, TDecoderResult> onDecode(const std::optional<const database::TEnumValues>&,
                                                  const pugi::xml_node& node) const override
       {
-        try {
-          return std::make_pair(TValue{convertToDouble(node.child_value())}, TDecoderResult::SUCCESS);
-        } catch (const std::exception&) {
+        double value{0.0};
+        if (tryConvertToDouble(node.child_value(), value) != std::errc{}) {
           return std::make_pair(TValue{}, TDecoderResult::FAILURE);
         }
+        return std::make_pair(TValue{value}, TDecoderResult::SUCCESS);
       }
     };
 
@@ -248,29 +248,36 @@ namespace rexsapi::detail
       std::pair<TValue, TDecoderResult> onDecode(const std::optional<const database::TEnumValues>& enumValue,
                                                  const pugi::xml_node& node) const override
       {
-        TMatrix<type2> matrix;
+        std::vector<type2> values;
+        size_t rows{0};
+        size_t columns{0};
         const ElementDecoder decoder;
         bool result{true};
 
         for (const auto& row : node.select_nodes("matrix/r")) {
-          std::vector<type2> r;
+          size_t count{0};
 
           for (const auto& column : row.node().select_nodes("c")) {
             const auto [value, res] = decoder.decode(enumValue, column.node());
             if (res == TDecoderResult::SUCCESS) {
               const TValue& val = value;
-              r.emplace_back(std::move(val.getValue<type>()));
+              values.emplace_back(std::move(val.getValue<type>()));
+              ++count;
             } else {
               result = false;
             }
           }
 
-          matrix.m_Values.emplace_back(std::move(r));
+          if (rows++ == 0) {
+            columns = count;
+          }
+          result &= count == columns;
         }
 
-        result &= matrix.validate();
-
-        return std::make_pair(TValue{std::move(matrix)}, result ? TDecoderResult::SUCCESS : TDecoderResult::FAILURE);
+        if (!result) {
+          return std::make_pair(TValue{TMatrix<type2>{}}, TDecoderResult::FAILURE);
+        }
+        return std::make_pair(TValue{TMatrix<type2>{rows, columns, std::move(values)}}, TDecoderResult::SUCCESS);
       }
     };
 
@@ -287,8 +294,8 @@ namespace rexsapi::detail
         TValue value;
         const auto codedType = rexsapi::detail::codedValueFromString(detail::getStringAttribute(child, "code"));
         if (codedType != detail::TCodedValueType::None) {
-          rows = convertToUint64(detail::getStringAttribute(child, "rows"));
-          columns = convertToUint64(detail::getStringAttribute(child, "columns"));
+          rows = convertToUint64(child.attribute("rows").value());
+          columns = convertToUint64(child.attribute("columns").value());
         }
         switch (codedType) {
           case detail::TCodedValueType::None:
@@ -316,8 +323,8 @@ namespace rexsapi::detail
           }
         }
         if (codedType != detail::TCodedValueType::None) {
-          if (value.getValue<TMatrix<typename TMatrixDecoder<ElementDecoder>::type>>().m_Values.size() != rows ||
-              value.getValue<TMatrix<typename TMatrixDecoder<ElementDecoder>::type>>().m_Values[0].size() != columns) {
+          const auto& matrix = value.getValue<TMatrix<typename TMatrixDecoder<ElementDecoder>::type>>();
+          if (matrix.getRowCount() != rows || matrix.getColumnCount() != columns) {
             throw TException{"decoded matrix size does not correspond to configured size"};
           }
         }
@@ -304,6 +304,21 @@ namespace rexsapi
      */
     [[nodiscard]] bool validate(const pugi::xml_document& doc, std::vector<std::string>& errors) const;
 
+    /**
+     * @brief Validates a single element against the configured xsd schema
+     *
+     * Allows validating parts of a document without having the complete document in memory. The element has to be
+     * declared as a top-level element in the schema.
+     *
+     * @param node The element to validate
+     * @param parents The names of the parent elements of the node. Only used for reporting issues.
+     * @param errors Will be filled with issues encountered while validating the element
+     * @return true if the validation was successful
+     * @return false if the validation failed
+     */
+    [[nodiscard]] bool validate(const pugi::xml_node& node, const std::vector<std::string>& parents,
+                                std::vector<std::string>& errors) const;
+
   private:
     void init();
     void initTypes();
@@ -525,31 +540,21 @@ namespace rexsapi
 
     inline void TIntegerType::validate(const std::string& value, TValidationContext& context) const
     {
-      try {
-        std::size_t pos{};
-        (void)std::stoll(value, &pos);
-        if (pos != value.length()) {
-          context.addError(fmt::format("cannot convert '{}' to integer", value));
-        }
-      } catch (const std::exception&) {
+      if (int64_t i{0}; tryConvertToInt64(value, i) != std::errc{}) {
         context.addError(fmt::format("cannot convert '{}' to integer", value));
       }
     }
 
     inline void TNonNegativeIntegerType::validate(const std::string& value, TValidationContext& context) const
     {
-      try {
-        (void)convertToUint64(value);
-      } catch (const std::exception&) {
+      if (uint64_t i{0}; tryConvertToUint64(value, i) != std::errc{}) {
         context.addError(fmt::format("cannot convert '{}' to non negative integer", value));
       }
     }
 
     inline void TDecimalType::validate(const std::string& value, TValidationContext& context) const
     {
-      try {
-        (void)convertToDouble(value);
-      } catch (const std::exception&) {
+      if (double d{0.0}; tryConvertToDouble(value, d) != std::errc{}) {
         context.addError(fmt::format("cannot convert '{}' to decimal", value));
       }
     }
@@ -816,6 +821,25 @@ namespace rexsapi
     return !result;
   }
 
+  inline bool TXSDSchemaValidator::validate(const pugi::xml_node& node, const std::vector<std::string>& parents,
+                                            std::vector<std::string>& errors) const
+  {
+    detail::TValidationContext context{m_Elements};
+
+    for (const auto& parent : parents) {
+      context.pushElement(parent);
+    }
+    if (const auto* element = context.findElement(node.name()); element == nullptr) {
+      context.addError(fmt::format("unknown element '{}'", node.name()));
+    } else {
+      element->validate(node, context);
+    }
+    bool result = context.hasErrors();
+    context.swap(errors);
+
+    return !result;
+  }
+
   inline void TXSDSchemaValidator::init()
   {
     if (const auto root = m_Doc.select_node(fmt::format("/{}:schema", detail::xsdSchemaNS).c_str()); !root) {
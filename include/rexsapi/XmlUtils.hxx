@@ -17,6 +17,7 @@
 #ifndef REXSAPI_XML_UTILS_HXX
 #define REXSAPI_XML_UTILS_HXX
 
+#include <rexsapi/BufferView.hxx>
 #include <rexsapi/Result.hxx>
 #include <rexsapi/XSDSchemaValidator.hxx>
 #include <rexsapi/Xml.hxx>
@@ -28,6 +29,15 @@ namespace rexsapi::detail
     return node.attribute(attribute).value();
   }
 
+  static inline std::string getStringAttribute(const pugi::xml_node& node, const char* attribute,
+                                               const std::string& def) noexcept
+  {
+    if (const auto att = node.attribute(attribute); !att.empty()) {
+      return att.value();
+    }
+    return def;
+  }
+
   static inline std::string getStringAttribute(const pugi::xpath_node& node, const char* attribute) noexcept
   {
     return node.node().attribute(attribute).value();
@@ -51,7 +61,7 @@ namespace rexsapi::detail
     return def;
   }
 
-  static inline pugi::xml_document loadXMLDocument(TResult& result, std::vector<uint8_t>& buffer,
+  static inline pugi::xml_document loadXMLDocument(TResult& result, TBufferView buffer,
                                                    const TXSDSchemaValidator& validator) noexcept
   {
     pugi::xml_document doc;
@@ -18,6 +18,9 @@
 #define REXSAPI_ZIP_ARCHIVE_HXX
 
 #include <rexsapi/FileTypes.hxx>
+#include <rexsapi/FileUtils.hxx>
+
+#include <ctime>
 
 #define MINIZ_NO_ZLIB_APIS
 #define MINIZ_NO_ZLIB_COMPATIBLE_NAMES
@@ -33,13 +36,33 @@
 #if defined(_MSC_VER)
   #pragma warning(pop)
 #endif
+#include <fstream>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <string>
 #include <vector>
 
 namespace rexsapi::detail
 {
-  class ZipArchive
+  /**
+   * @brief Reads the first REXS model file of a zip archive.
+   *
+   * The archive is mapped into memory instead of being read through the C stdio backend of miniz. The model file can
+   * either be extracted into a buffer or decompressed incrementally through a stream.
+   */
+  class ZipArchive : private std::streambuf
   {
   public:
+    /**
+     * @brief Constructs a new ZipArchive object.
+     *
+     * @param archive The path of the archive
+     * @param extensionChecker Identifies the REXS model file in the archive by its extension
+     * @throws TException if the archive cannot be opened or does not contain a REXS model file
+     */
     explicit ZipArchive(std::filesystem::path archive, const TExtensionChecker& extensionChecker);
 
     ZipArchive(const ZipArchive&) = delete;
@@ -47,19 +70,137 @@ namespace rexsapi::detail
     ZipArchive& operator=(const ZipArchive&) = delete;
     ZipArchive& operator=(ZipArchive&&) = delete;
 
-    ~ZipArchive()
+    ~ZipArchive() override
     {
+      if (m_Iterator != nullptr) {
+        mz_zip_reader_extract_iter_free(m_Iterator);
+      }
       mz_zip_reader_end(&m_ZipArchive);
     }
 
+    /**
+     * @brief Extracts the REXS model file.
+     *
+     * The file is decompressed directly into the returned buffer.
+     *
+     * @return std::pair<std::vector<uint8_t>, TFileType> The content and the type of the REXS model file
+     * @throws TException if the file cannot be extracted
+     */
     std::pair<std::vector<uint8_t>, TFileType> load();
 
+    /**
+     * @brief Opens the REXS model file for incremental decompression.
+     *
+     * The file is decompressed in chunks of bounded size while the stream is read, so the uncompressed content is
+     * never kept in memory as a whole. The stream can be passed to the stream based model loaders. Opening the file
+     * again restarts the decompression.
+     *
+     * @param bufferSize The size of the decompressed chunks in bytes
+     * @return std::istream& The stream to read the REXS model file from. Is valid as long as the archive. Reading
+     * from the stream throws a TException if the file cannot be decompressed.
+     * @throws TException if the file cannot be opened
+     */
+    std::istream& open(size_t bufferSize = 64 * 1024);
+
+    TFileType getFileType() const noexcept
+    {
+      return m_Type;
+    }
+
   private:
+    int_type underflow() override;
+
     std::filesystem::path m_Archive;
     const TExtensionChecker& m_ExtensionChecker;
+    TMappedFile m_File;
     mz_zip_archive m_ZipArchive;
     mz_uint m_FileIndex{0};
     TFileType m_Type{TFileType::UNKNOWN};
+    mz_zip_reader_extract_iter_state* m_Iterator{nullptr};
+    std::vector<char> m_Buffer;
+    std::istream m_Stream;
+  };
+
+
+  /**
+   * @brief Writes files to a zip archive, compressing them while they are written.
+   *
+   * The content of a file is written to a stream and deflated in chunks of bounded size directly into the archive
+   * file, so neither the uncompressed nor the compressed content is kept in memory. As size and checksum of a file are
+   * only known after the file has been written, they are stored in a data descriptor following the compressed data.
+   * Files and archives larger than 4 GiB are not supported.
+   */
+  class ZipArchiveWriter : private std::streambuf
+  {
+  public:
+    /**
+     * @brief Constructs a new ZipArchiveWriter object and creates the archive file.
+     *
+     * @param archive The path of the archive. An existing file will be overwritten.
+     * @param compressionLevel The deflate compression level from 0 (no compression) to 10 (best compression). Higher
+     * levels create smaller archives but take more time.
+     * @param bufferSize The size of the chunks in bytes that are compressed at once
+     * @throws TException if the archive cannot be created or the compression level is invalid
+     */
+    explicit ZipArchiveWriter(std::filesystem::path archive, int compressionLevel = MZ_DEFAULT_LEVEL,
+                              size_t bufferSize = 64 * 1024);
+
+    ZipArchiveWriter(const ZipArchiveWriter&) = delete;
+    ZipArchiveWriter(ZipArchiveWriter&&) = delete;
+    ZipArchiveWriter& operator=(const ZipArchiveWriter&) = delete;
+    ZipArchiveWriter& operator=(ZipArchiveWriter&&) = delete;
+
+    ~ZipArchiveWriter() override = default;
+
+    /**
+     * @brief Starts a new file in the archive and finishes the previous one.
+     *
+     * @param name The name of the file in the archive in UTF-8 encoding
+     * @return std::ostream& The stream to write the content of the file to. Is valid until the next file is started
+     * or the archive is finished.
+     * @throws TException if the previous file cannot be finished or the archive cannot be written
+     */
+    std::ostream& startFile(std::string name);
+
+    /**
+     * @brief Finishes the last file and writes the central directory of the archive.
+     *
+     * The archive is only complete after finish has been called successfully.
+     *
+     * @throws TException if the archive cannot be written
+     */
+    void finish();
+
+  private:
+    struct TEntry {
+      std::string m_Name;
+      uint64_t m_Offset;
+      mz_ulong m_Crc;
+      uint64_t m_CompressedSize;
+      uint64_t m_UncompressedSize;
+    };
+
+    int_type overflow(int_type c) override;
+    int sync() override;
+
+    void finishFile();
+    bool compress(tdefl_flush flush);
+    bool write(const void* data, size_t size);
+    static mz_bool putBuffer(const void* data, int size, void* writer);
+    static void appendUint16(std::string& s, uint64_t value);
+    static void appendUint32(std::string& s, uint64_t value);
+
+    std::filesystem::path m_Archive;
+    std::ofstream m_File;
+    mz_uint m_Flags;
+    std::unique_ptr<tdefl_compressor> m_Compressor;
+    std::vector<char> m_Buffer;
+    std::ostream m_Stream;
+    std::vector<TEntry> m_Entries;
+    uint64_t m_Offset{0};
+    uint16_t m_Time{0};
+    uint16_t m_Date{0};
+    bool m_FileOpen{false};
   };
 
 
@@ -70,42 +211,275 @@ namespace rexsapi::detail
   inline ZipArchive::ZipArchive(std::filesystem::path archive, const TExtensionChecker& extensionChecker)
   : m_Archive{std::move(archive)}
   , m_ExtensionChecker{extensionChecker}
+  , m_File{m_Archive}
+  , m_Stream{this}
   {
     ::memset(&m_ZipArchive, 0, sizeof(m_ZipArchive));
-    if (mz_zip_reader_init_file(&m_ZipArchive, m_Archive.string().c_str(), 0) == MZ_FALSE) {
+    if (mz_zip_reader_init_mem(&m_ZipArchive, m_File.data(), m_File.size(), 0) == MZ_FALSE) {
       throw TException{fmt::format("Cannot open zip archive '{}'", m_Archive.string())};
     }
-    for (mz_uint i = 0; i < mz_zip_reader_get_num_files(&m_ZipArchive); ++i) {
-      mz_zip_archive_file_stat file_stat;
-      if (mz_zip_reader_file_stat(&m_ZipArchive, i, &file_stat) == MZ_FALSE) {
-        throw TException{fmt::format("Cannot open zip archive '{}'", m_Archive.string())};
+    try {
+      for (mz_uint i = 0; i < mz_zip_reader_get_num_files(&m_ZipArchive); ++i) {
+        mz_zip_archive_file_stat file_stat;
+        if (mz_zip_reader_file_stat(&m_ZipArchive, i, &file_stat) == MZ_FALSE) {
+          throw TException{fmt::format("Cannot open zip archive '{}'", m_Archive.string())};
+        }
+        m_Type = m_ExtensionChecker.getFileType(file_stat.m_filename);
+        if (m_Type == TFileType::UNKNOWN) {
+          continue;
+        }
+        m_FileIndex = i;
+        break;
       }
-      m_Type = m_ExtensionChecker.getFileType(file_stat.m_filename);
       if (m_Type == TFileType::UNKNOWN) {
-        continue;
+        throw TException{fmt::format("No rexs file in zip archive '{}'", m_Archive.string())};
       }
-      m_FileIndex = i;
-      break;
-    }
-    if (m_Type == TFileType::UNKNOWN) {
-      throw TException{fmt::format("No rexs file in zip archive '{}'", m_Archive.string())};
+    } catch (...) {
+      // the destructor will not be called
+      mz_zip_reader_end(&m_ZipArchive);
+      throw;
     }
   }
 
   inline std::pair<std::vector<uint8_t>, TFileType> ZipArchive::load()
   {
-    std::vector<uint8_t> buffer;
-    size_t uncompressedSize = 0;
-    auto* p = mz_zip_reader_extract_to_heap(&m_ZipArchive, m_FileIndex, &uncompressedSize, 0);
-    if (p == nullptr) {
+    mz_zip_archive_file_stat file_stat;
+    if (mz_zip_reader_file_stat(&m_ZipArchive, m_FileIndex, &file_stat) == MZ_FALSE ||
+        file_stat.m_uncomp_size > std::numeric_limits<size_t>::max()) {
+      throw TException{fmt::format("Cannot extract rexs file from zip archive '{}'", m_Archive.string())};
+    }
+    std::vector<uint8_t> buffer(static_cast<size_t>(file_stat.m_uncomp_size));
+    if (!buffer.empty() &&
+        mz_zip_reader_extract_to_mem(&m_ZipArchive, m_FileIndex, buffer.data(), buffer.size(), 0) == MZ_FALSE) {
       throw TException{fmt::format("Cannot extract rexs file from zip archive '{}': {}", m_Archive.string(),
                                    mz_zip_get_error_string(m_ZipArchive.m_last_error))};
     }
-    buffer.resize(uncompressedSize);
-    ::memcpy(buffer.data(), p, uncompressedSize);
-    mz_free(p);
     return std::make_pair(std::move(buffer), m_Type);
   }
+
+  inline std::istream& ZipArchive::open(size_t bufferSize)
+  {
+    if (m_Iterator != nullptr) {
+      mz_zip_reader_extract_iter_free(m_Iterator);
+    }
+    m_Iterator = mz_zip_reader_extract_iter_new(&m_ZipArchive, m_FileIndex, 0);
+    if (m_Iterator == nullptr) {
+      throw TException{fmt::format("Cannot extract rexs file from zip archive '{}': {}", m_Archive.string(),
+                                   mz_zip_get_error_string(m_ZipArchive.m_last_error))};
+    }
+    m_Buffer.resize(bufferSize);
+    setg(m_Buffer.data(), m_Buffer.data(), m_Buffer.data());
+    m_Stream.clear();
+    // decompression errors are only reported by throwing from the stream buffer
+    m_Stream.exceptions(std::ios_base::badbit);
+    return m_Stream;
+  }
+
+  inline ZipArchive::int_type ZipArchive::underflow()
+  {
+    if (m_Iterator == nullptr) {
+      return traits_type::eof();
+    }
+    const auto size = mz_zip_reader_extract_iter_read(m_Iterator, m_Buffer.data(), m_Buffer.size());
+    if (size == 0) {
+      // checks the size and the crc of the decompressed file
+      const auto valid = mz_zip_reader_extract_iter_free(m_Iterator);
+      m_Iterator = nullptr;
+      if (valid == MZ_FALSE) {
+        throw TException{fmt::format("Cannot extract rexs file from zip archive '{}': {}", m_Archive.string(),
+                                     mz_zip_get_error_string(m_ZipArchive.m_last_error))};
+      }
+      return traits_type::eof();
+    }
+    setg(m_Buffer.data(), m_Buffer.data(), m_Buffer.data() + size);
+    return traits_type::to_int_type(m_Buffer.front());
+  }
+
+  inline ZipArchiveWriter::ZipArchiveWriter(std::filesystem::path archive, int compressionLevel, size_t bufferSize)
+  : m_Archive{std::move(archive)}
+  , m_Buffer(bufferSize)
+  , m_Stream{this}
+  {
+    if (compressionLevel < MZ_NO_COMPRESSION || compressionLevel > MZ_UBER_COMPRESSION) {
+      throw TException{fmt::format("Invalid compression level {} for zip archive '{}'", compressionLevel,
+                                   m_Archive.string())};
+    }
+    // negative window bits create a raw deflate stream without zlib header as required by zip
+    m_Flags = tdefl_create_comp_flags_from_zip_params(compressionLevel, -15, MZ_DEFAULT_STRATEGY);
+    m_Compressor = std::make_unique<tdefl_compressor>();
+
+    m_File.open(m_Archive, std::ios_base::binary);
+    if (!m_File) {
+      throw TException{fmt::format("Cannot create zip archive '{}'", m_Archive.string())};
+    }
+
+    const std::time_t now = std::time(nullptr);
+    tm local{};
+#if defined(WIN32)
+    localtime_s(&local, &now);
+#else
+    localtime_r(&now, &local);
+#endif
+    m_Time = static_cast<uint16_t>((local.tm_hour << 11) | (local.tm_min << 5) | (local.tm_sec / 2));
+    m_Date = static_cast<uint16_t>(((local.tm_year - 80) << 9) | ((local.tm_mon + 1) << 5) | local.tm_mday);
+  }
+
+  inline std::ostream& ZipArchiveWriter::startFile(std::string name)
+  {
+    finishFile();
+    if (name.size() > 0xFFFF) {
+      throw TException{fmt::format("File name too long for zip archive '{}'", m_Archive.string())};
+    }
+
+    std::string header;
+    appendUint32(header, 0x04034b50);
+    appendUint16(header, 20);
+    // sizes and crc follow in the data descriptor, the name is UTF-8 encoded
+    appendUint16(header, 0x0808);
+    appendUint16(header, MZ_DEFLATED);
+    appendUint16(header, m_Time);
+    appendUint16(header, m_Date);
+    appendUint32(header, 0);
+    appendUint32(header, 0);
+    appendUint32(header, 0);
+    appendUint16(header, name.size());
+    appendUint16(header, 0);
+    header.append(name);
+
+    m_Entries.emplace_back(TEntry{std::move(name), m_Offset, MZ_CRC32_INIT, 0, 0});
+    if (!write(header.data(), header.size()) ||
+        tdefl_init(m_Compressor.get(), &ZipArchiveWriter::putBuffer, this, static_cast<int>(m_Flags)) !=
+          TDEFL_STATUS_OKAY) {
+      throw TException{fmt::format("Cannot write zip archive '{}'", m_Archive.string())};
+    }
+    setp(m_Buffer.data(), m_Buffer.data() + m_Buffer.size());
+    m_Stream.clear();
+    m_FileOpen = true;
+    return m_Stream;
+  }
+
+  inline void ZipArchiveWriter::finish()
+  {
+    finishFile();
+
+    std::string directory;
+    for (const auto& entry : m_Entries) {
+      appendUint32(directory, 0x02014b50);
+      appendUint16(directory, 20);
+      appendUint16(directory, 20);
+      appendUint16(directory, 0x0808);
+      appendUint16(directory, MZ_DEFLATED);
+      appendUint16(directory, m_Time);
+      appendUint16(directory, m_Date);
+      appendUint32(directory, entry.m_Crc);
+      appendUint32(directory, entry.m_CompressedSize);
+      appendUint32(directory, entry.m_UncompressedSize);
+      appendUint16(directory, entry.m_Name.size());
+      appendUint16(directory, 0);
+      appendUint16(directory, 0);
+      appendUint16(directory, 0);
+      appendUint16(directory, 0);
+      appendUint32(directory, 0);
+      appendUint32(directory, entry.m_Offset);
+      directory.append(entry.m_Name);
+    }
+    const auto directorySize = directory.size();
+    appendUint32(directory, 0x06054b50);
+    appendUint16(directory, 0);
+    appendUint16(directory, 0);
+    appendUint16(directory, m_Entries.size());
+    appendUint16(directory, m_Entries.size());
+    appendUint32(directory, directorySize);
+    appendUint32(directory, m_Offset);
+    appendUint16(directory, 0);
+
+    if (m_Entries.size() > 0xFFFF || m_Offset + directory.size() > 0xFFFFFFFF) {
+      throw TException{fmt::format("Zip archive '{}' is too large", m_Archive.string())};
+    }
+    if (!write(directory.data(), directory.size()) || !m_File.flush()) {
+      throw TException{fmt::format("Cannot write zip archive '{}'", m_Archive.string())};
+    }
+  }
+
+  inline ZipArchiveWriter::int_type ZipArchiveWriter::overflow(int_type c)
+  {
+    if (!m_FileOpen || !compress(TDEFL_NO_FLUSH)) {
+      return traits_type::eof();
+    }
+    if (!traits_type::eq_int_type(c, traits_type::eof())) {
+      *pptr() = traits_type::to_char_type(c);
+      pbump(1);
+    }
+    return traits_type::not_eof(c);
+  }
+
+  inline int ZipArchiveWriter::sync()
+  {
+    return m_FileOpen && compress(TDEFL_NO_FLUSH) ? 0 : -1;
+  }
+
+  inline void ZipArchiveWriter::finishFile()
+  {
+    if (!m_FileOpen) {
+      return;
+    }
+    m_FileOpen = false;
+    const bool compressed = m_Stream && compress(TDEFL_FINISH);
+    setp(nullptr, nullptr);
+    if (!compressed) {
+      throw TException{fmt::format("Cannot write zip archive '{}'", m_Archive.string())};
+    }
+
+    const auto& entry = m_Entries.back();
+    if (entry.m_UncompressedSize > 0xFFFFFFFF || entry.m_CompressedSize > 0xFFFFFFFF) {
+      throw TException{fmt::format("File '{}' is too large for zip archive '{}'", entry.m_Name, m_Archive.string())};
+    }
+    std::string descriptor;
+    appendUint32(descriptor, 0x08074b50);
+    appendUint32(descriptor, entry.m_Crc);
+    appendUint32(descriptor, entry.m_CompressedSize);
+    appendUint32(descriptor, entry.m_UncompressedSize);
+    if (!write(descriptor.data(), descriptor.size())) {
+      throw TException{fmt::format("Cannot write zip archive '{}'", m_Archive.string())};
+    }
+  }
+
+  inline bool ZipArchiveWriter::compress(tdefl_flush flush)
+  {
+    auto& entry = m_Entries.back();
+    const auto size = static_cast<size_t>(pptr() - pbase());
+    entry.m_Crc = mz_crc32(entry.m_Crc, reinterpret_cast<const unsigned char*>(pbase()), size);
+    entry.m_UncompressedSize += size;
+    const auto status = tdefl_compress_buffer(m_Compressor.get(), pbase(), size, flush);
+    setp(m_Buffer.data(), m_Buffer.data() + m_Buffer.size());
+    return status == TDEFL_STATUS_OKAY || status == TDEFL_STATUS_DONE;
+  }
+
+  inline bool ZipArchiveWriter::write(const void* data, size_t size)
+  {
+    m_File.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    m_Offset += size;
+    return !m_File.fail();
+  }
+
+  inline mz_bool ZipArchiveWriter::putBuffer(const void* data, int size, void* writer)
+  {
+    auto& self = *static_cast<ZipArchiveWriter*>(writer);
+    self.m_Entries.back().m_CompressedSize += static_cast<uint64_t>(size);
+    return self.write(data, static_cast<size_t>(size)) ? MZ_TRUE : MZ_FALSE;
+  }
+
+  inline void ZipArchiveWriter::appendUint16(std::string& s, uint64_t value)
+  {
+    s.push_back(static_cast<char>(value & 0xFF));
+    s.push_back(static_cast<char>((value >> 8) & 0xFF));
+  }
+
+  inline void ZipArchiveWriter::appendUint32(std::string& s, uint64_t value)
+  {
+    appendUint16(s, value & 0xFFFF);
+    appendUint16(s, (value >> 16) & 0xFFFF);
+  }
 }
 
 #endif
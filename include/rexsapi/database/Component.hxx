@@ -19,6 +19,9 @@
 
 #include <rexsapi/database/Attribute.hxx>
 
+#include <string_view>
+#include <unordered_map>
+
 /** @file */
 
 namespace rexsapi::database
@@ -46,12 +49,16 @@ namespace rexsapi::database
      * @param name The name is specific to the REXS datbase model language
      * @param attributes All attributes associated to this component
      */
-    TComponent(std::string componentId, std::string name,
+    TComponent(const std::string& componentId, std::string name,
                std::vector<std::reference_wrapper<const TAttribute>>&& attributes)
-    : m_ComponentId{std::move(componentId)}
+    : m_ComponentId{&rexsapi::detail::TStringPool::intern(componentId)}
     , m_Name{std::move(name)}
     , m_Attributes{std::move(attributes)}
     {
+      m_AttributeIndex.reserve(m_Attributes.size());
+      for (const TAttribute& attribute : m_Attributes) {
+        m_AttributeIndex.emplace(attribute.getAttributeId(), attribute);
+      }
     }
 
     ~TComponent() = default;
@@ -61,9 +68,14 @@ namespace rexsapi::database
     TComponent(TComponent&&) noexcept = default;
     TComponent& operator=(TComponent&&) = delete;
 
+    /**
+     * @brief Returns the id of the component.
+     *
+     * @return const std::string& to the interned id, stays valid after the component has been destroyed
+     */
     [[nodiscard]] const std::string& getComponentId() const& noexcept
     {
-      return m_ComponentId;
+      return *m_ComponentId;
     }
 
     [[nodiscard]] const std::string& getName() const& noexcept
@@ -87,10 +99,7 @@ namespace rexsapi::database
      */
     [[nodiscard]] bool hasAttribute(const std::string& attributeId) const& noexcept
     {
-      auto it = std::find_if(m_Attributes.begin(), m_Attributes.end(), [&attributeId](const TAttribute& attribute) {
-        return attribute.getAttributeId() == attributeId;
-      });
-      return it != m_Attributes.end();
+      return m_AttributeIndex.find(attributeId) != m_AttributeIndex.end();
     }
 
     /**
@@ -102,20 +111,20 @@ namespace rexsapi::database
      */
     [[nodiscard]] const TAttribute& findAttributeById(const std::string& attributeId) const&
     {
-      auto it = std::find_if(m_Attributes.begin(), m_Attributes.end(), [&attributeId](const TAttribute& attribute) {
-        return attribute.getAttributeId() == attributeId;
-      });
-      if (it == m_Attributes.end()) {
-        throw TException{fmt::format("component id={} does not contain attribute id={}", m_ComponentId, attributeId)};
+      auto it = m_AttributeIndex.find(attributeId);
+      if (it == m_AttributeIndex.end()) {
+        throw TException{fmt::format("component id={} does not contain attribute id={}", *m_ComponentId, attributeId)};
       }
 
-      return *it;
+      return it->second;
     }
 
   private:
-    std::string m_ComponentId;
+    const std::string* m_ComponentId;
     std::string m_Name;
     std::vector<std::reference_wrapper<const TAttribute>> m_Attributes;
+    /// Keys reference the ids of the database model attributes, which outlive the component
+    std::unordered_map<std::string_view, std::reference_wrapper<const TAttribute>> m_AttributeIndex;
   };
 }
 
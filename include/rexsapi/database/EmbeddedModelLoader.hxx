@@ -0,0 +1,133 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_DATABASE_EMBEDDED_MODEL_LOADER_HXX
+#define REXSAPI_DATABASE_EMBEDDED_MODEL_LOADER_HXX
+
+#include <rexsapi/Result.hxx>
+#include <rexsapi/database/ModelCache.hxx>
+
+#include <array>
+#include <optional>
+
+namespace rexsapi::database::detail
+{
+  /**
+   * @brief A REXS database model compiled into the binary.
+   *
+   * The data is a database model in the binary format of the TModelCache.
+   */
+  struct TEmbeddedModel {
+    uint32_t m_Major;
+    uint32_t m_Minor;
+    uint32_t m_Patch;
+    const char* m_Language;
+    uint64_t m_Checksum;
+    const uint8_t* m_Data;
+    size_t m_Size;
+  };
+}
+
+#ifdef REXSAPI_EMBEDDED_MODELS
+  // generated at build time for the models selected with the REXSAPI_EMBEDDED_MODELS cmake option. The data is
+  // declared as inline variables, so a program contains it only once regardless of the including translation units.
+  #include <rexsapi/EmbeddedModelData.hxx>
+#else
+namespace rexsapi::database::detail
+{
+  inline constexpr std::array<TEmbeddedModel, 0> EmbeddedModels{};
+}
+#endif
+
+/** @file */
+
+namespace rexsapi::database
+{
+  /**
+   * @brief Loads REXS database models compiled into the binary.
+   *
+   * The database models to compile into the binary can be selected with the REXSAPI_EMBEDDED_MODELS cmake option,
+   * e.g. ```-DREXSAPI_EMBEDDED_MODELS="1.6_en;2.0.0_en"```. The models are converted into the binary format of the
+   * TModelCache at build time, so creating the models neither needs filesystem access nor xml parsing.
+   *
+   * Can be used instead of the TXmlModelLoader to populate the REXS database model registry.
+   */
+  class TEmbeddedModelLoader
+  {
+  public:
+    /**
+     * @brief Loads all embedded REXS database models.
+     *
+     * @param callback Will be called for each created model for further processing
+     * @return TResult describing the outcome of the loading. Contains a critical error for each model that could not be
+     * created.
+     */
+    TResult load(const std::function<void(TModel&&)>& callback) const;
+
+    /**
+     * @brief Indexes all embedded REXS database models without creating them.
+     *
+     * @param callback Will be called with the version, language, and a factory for each embedded model
+     * @return TResult describing the outcome of the indexing
+     */
+    TResult index(const std::function<void(TRexsVersion, std::string, TModelFactory)>& callback) const;
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  inline TResult TEmbeddedModelLoader::load(const std::function<void(TModel&&)>& callback) const
+  {
+    TResult loadResult;
+    TResult result = index([&callback, &loadResult](TRexsVersion version, std::string language, TModelFactory factory) {
+      std::optional<TModel> model;
+      try {
+        model.emplace(factory());
+      } catch (const std::exception& ex) {
+        loadResult.addError(TError{TErrorLevel::CRIT, fmt::format("cannot load embedded database model {} {}: {}",
+                                                                  version.asString(), language, ex.what())});
+        return;
+      }
+      callback(std::move(*model));
+    });
+
+    for (const auto& error : loadResult.getErrors()) {
+      result.addError(error);
+    }
+    return result;
+  }
+
+  inline TResult
+  TEmbeddedModelLoader::index(const std::function<void(TRexsVersion, std::string, TModelFactory)>& callback) const
+  {
+    TResult result;
+    if (detail::EmbeddedModels.empty()) {
+      result.addError(TError{TErrorLevel::CRIT, "No embedded database models found"});
+    }
+
+    for (const auto& model : detail::EmbeddedModels) {
+      callback(TRexsVersion{model.m_Major, model.m_Minor, model.m_Patch}, model.m_Language, [&model]() {
+        return detail::deserializeModel(model.m_Checksum, model.m_Data, model.m_Size);
+      });
+    }
+
+    return result;
+  }
+}
+
+#endif
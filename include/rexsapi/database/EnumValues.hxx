@@ -69,6 +69,11 @@ namespace rexsapi::database
      */
     [[nodiscard]] bool check(const std::string& value) const noexcept;
 
+    [[nodiscard]] const std::vector<TEnumValue>& getValues() const& noexcept
+    {
+      return m_Values;
+    }
+
   private:
     std::vector<TEnumValue> m_Values;
   };
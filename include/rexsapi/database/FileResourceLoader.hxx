@@ -22,6 +22,8 @@
 #include <rexsapi/Format.hxx>
 #include <rexsapi/Result.hxx>
 
+#include <fstream>
+
 /** @file */
 
 namespace rexsapi::database
@@ -34,6 +36,13 @@ namespace rexsapi::database
   class TFileResourceLoader
   {
   public:
+    /**
+     * @brief Loads the contents of a resource on demand.
+     *
+     * Issues loading the resource will be added to the result.
+     */
+    using TResourceFactory = std::function<std::vector<uint8_t>(TResult&)>;
+
     /**
      * @brief Constructs a new TFileResourceLoader object.
      *
@@ -57,6 +66,20 @@ namespace rexsapi::database
      */
     TResult load(const std::function<void(TResult&, std::vector<uint8_t>&)>& callback) const;
 
+    /**
+     * @brief Finds all resources without loading them.
+     *
+     * Will iterate over all xml files in the configured directory and pass a stream opened on each file to the
+     * callback. The stream can be used to read the beginning of the file. Additionally, a function is passed to the
+     * callback that loads the complete file contents when called. The function can be called at any later time, even
+     * after the resource loader has been destroyed.
+     *
+     * @param callback Callback for the processing of the found resources
+     * @return TResult describing the outcome of finding files in the configured directory
+     * @throws TException if the configured directory does not exist, is not a directory, or has no permissions
+     */
+    TResult index(const std::function<void(TResult&, std::istream&, TResourceFactory)>& callback) const;
+
   private:
     [[nodiscard]] std::vector<std::filesystem::path> findResources(TResult& result) const;
 
@@ -87,6 +110,30 @@ namespace rexsapi::database
     return result;
   }
 
+  inline TResult
+  TFileResourceLoader::index(const std::function<void(TResult&, std::istream&, TResourceFactory)>& callback) const
+  {
+    if (!callback) {
+      throw TException{"callback not set for resource loader"};
+    }
+
+    TResult result;
+
+    const auto resources = findResources(result);
+    std::for_each(resources.begin(), resources.end(), [&callback, &result](const auto& resource) {
+      std::ifstream stream{resource, std::ios_base::in | std::ios_base::binary};
+      if (!stream.good()) {
+        result.addError(TError{TErrorLevel::CRIT, fmt::format("'{}' cannot be loaded", resource.string())});
+        return;
+      }
+      callback(result, stream, [resource](TResult& res) {
+        return rexsapi::detail::loadFile(res, resource);
+      });
+    });
+
+    return result;
+  }
+
   inline std::vector<std::filesystem::path> TFileResourceLoader::findResources(TResult& result) const
   {
     if (!std::filesystem::exists(m_Path) || !std::filesystem::is_directory(m_Path)) {
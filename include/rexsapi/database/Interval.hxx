@@ -55,6 +55,16 @@ namespace rexsapi::database
       return m_Set;
     }
 
+    [[nodiscard]] double getLimit() const noexcept
+    {
+      return m_Limit;
+    }
+
+    [[nodiscard]] TIntervalType getType() const noexcept
+    {
+      return m_Type;
+    }
+
     /**
      * @brief Checks if the value is smaller or equal to the limit.
      *
@@ -135,6 +145,16 @@ namespace rexsapi::database
       return m_Min <= value && m_Max >= value;
     }
 
+    [[nodiscard]] const TIntervalEndpoint& getMin() const noexcept
+    {
+      return m_Min;
+    }
+
+    [[nodiscard]] const TIntervalEndpoint& getMax() const noexcept
+    {
+      return m_Max;
+    }
+
   private:
     TIntervalEndpoint m_Min{};
     TIntervalEndpoint m_Max{};
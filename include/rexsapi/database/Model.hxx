@@ -25,6 +25,7 @@
 #include <rexsapi/database/Component.hxx>
 #include <rexsapi/database/Unit.hxx>
 
+#include <functional>
 #include <unordered_map>
 
 /** @file */
@@ -195,6 +196,38 @@ namespace rexsapi::database
      */
     [[nodiscard]] const TComponent& findComponentById(const std::string& componentId) const;
 
+    /**
+     * @brief Returns all units of the model, indexed by id.
+     */
+    [[nodiscard]] const std::unordered_map<uint64_t, TUnit>& getUnits() const& noexcept
+    {
+      return m_Units;
+    }
+
+    /**
+     * @brief Returns all value types of the model, indexed by id.
+     */
+    [[nodiscard]] const std::unordered_map<uint64_t, TValueType>& getValueTypes() const& noexcept
+    {
+      return m_Types;
+    }
+
+    /**
+     * @brief Returns all attributes of the model, indexed by attribute id.
+     */
+    [[nodiscard]] const std::unordered_map<std::string, TAttribute>& getAttributes() const& noexcept
+    {
+      return m_Attributes;
+    }
+
+    /**
+     * @brief Returns all components of the model, indexed by component id.
+     */
+    [[nodiscard]] const std::unordered_map<std::string, TComponent>& getComponents() const& noexcept
+    {
+      return m_Components;
+    }
+
   private:
     TRexsVersion m_Version;
     std::string m_Language;
@@ -207,6 +240,15 @@ namespace rexsapi::database
   };
 
 
+  /**
+   * @brief Creates a database model on demand.
+   *
+   * Used by the TModelRegistry to defer loading a database model until it is requested for the first time. Should
+   * throw a TException if the model cannot be created.
+   */
+  using TModelFactory = std::function<TModel()>;
+
+
   /////////////////////////////////////////////////////////////////////////////
   // Implementation
   /////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,476 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REXSAPI_DATABASE_MODEL_CACHE_HXX
+#define REXSAPI_DATABASE_MODEL_CACHE_HXX
+
+#include <rexsapi/Exception.hxx>
+#include <rexsapi/FileUtils.hxx>
+#include <rexsapi/Format.hxx>
+#include <rexsapi/database/Model.hxx>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <random>
+
+/** @file */
+
+namespace rexsapi::database
+{
+  /**
+   * @brief Caches REXS database models in a compact binary format.
+   *
+   * Creating a database model from a cache file is considerably faster than parsing and validating the REXS database
+   * model xml file. Cache files are named after a checksum of the xml file they have been created from, and the
+   * checksum is stored in the cache file as well. A cache file will therefore only be used for exactly the xml file it
+   * has been created from. Changed xml files will automatically get new cache files.
+   *
+   * Can be used to parametrize the TXmlModelLoader.
+   */
+  class TModelCache
+  {
+  public:
+    /**
+     * @brief Constructs a new TModelCache object.
+     *
+     * @param directory The directory to read and write cache files. Will be created on the first write if it does not
+     * exist.
+     */
+    explicit TModelCache(std::filesystem::path directory)
+    : m_Directory{std::move(directory)}
+    {
+    }
+
+    /**
+     * @brief Calculates the checksum identifying the cache file for a REXS database model xml file.
+     *
+     * @param source The contents of the REXS database model xml file
+     * @return uint64_t The checksum of the source
+     */
+    [[nodiscard]] static uint64_t checksum(const std::vector<uint8_t>& source) noexcept;
+
+    /**
+     * @brief Loads a database model from the cache.
+     *
+     * @param sourceChecksum The checksum of the REXS database model xml file to load the cached model for
+     * @return std::optional<TModel> containing the cached model. Empty if there is no valid cache file for the source.
+     */
+    [[nodiscard]] std::optional<TModel> load(uint64_t sourceChecksum) const noexcept;
+
+    /**
+     * @brief Stores a database model in the cache.
+     *
+     * Failing to store the model is not an error, the model will simply be created from the xml file again the next
+     * time.
+     *
+     * @param sourceChecksum The checksum of the REXS database model xml file the model has been created from
+     * @param model The model to store
+     */
+    void store(uint64_t sourceChecksum, const TModel& model) const noexcept;
+
+  private:
+    [[nodiscard]] std::filesystem::path getPath(uint64_t checksum) const;
+
+    std::filesystem::path m_Directory;
+  };
+
+
+  namespace detail
+  {
+    /**
+     * @brief Calculates the 64 bit FNV-1a hash of a buffer.
+     */
+    static uint64_t checksum(const uint8_t* data, size_t size) noexcept;
+
+    /**
+     * @brief Serializes a database model into the binary cache format.
+     */
+    static std::vector<uint8_t> serializeModel(uint64_t sourceChecksum, const TModel& model);
+
+    /**
+     * @brief Creates a database model from the binary cache format.
+     *
+     * @throws TException if the buffer is corrupt or was not created from the source with the given checksum
+     */
+    static TModel deserializeModel(uint64_t sourceChecksum, const uint8_t* data, size_t size);
+
+
+    class TBinaryWriter
+    {
+    public:
+      void write(uint8_t value)
+      {
+        m_Buffer.emplace_back(value);
+      }
+
+      void write(uint32_t value)
+      {
+        for (size_t n = 0; n < sizeof(value); ++n) {
+          m_Buffer.emplace_back(static_cast<uint8_t>(value >> (n * 8)));
+        }
+      }
+
+      void write(uint64_t value)
+      {
+        for (size_t n = 0; n < sizeof(value); ++n) {
+          m_Buffer.emplace_back(static_cast<uint8_t>(value >> (n * 8)));
+        }
+      }
+
+      void write(double value)
+      {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        write(bits);
+      }
+
+      void write(const std::string& value)
+      {
+        write(static_cast<uint32_t>(value.size()));
+        m_Buffer.insert(m_Buffer.end(), value.begin(), value.end());
+      }
+
+      std::vector<uint8_t>& getBuffer() & noexcept
+      {
+        return m_Buffer;
+      }
+
+    private:
+      std::vector<uint8_t> m_Buffer;
+    };
+
+
+    class TBinaryReader
+    {
+    public:
+      TBinaryReader(const uint8_t* data, size_t size)
+      : m_Data{data}
+      , m_Size{size}
+      {
+      }
+
+      uint8_t readByte()
+      {
+        check(1);
+        return m_Data[m_Offset++];
+      }
+
+      uint32_t readUint32()
+      {
+        return static_cast<uint32_t>(readLittleEndian(sizeof(uint32_t)));
+      }
+
+      uint64_t readUint64()
+      {
+        return readLittleEndian(sizeof(uint64_t));
+      }
+
+      double readDouble()
+      {
+        const auto bits = readUint64();
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+      }
+
+      std::string readString()
+      {
+        const auto size = readUint32();
+        check(size);
+        std::string value{reinterpret_cast<const char*>(m_Data + m_Offset), size};
+        m_Offset += size;
+        return value;
+      }
+
+      bool atEnd() const noexcept
+      {
+        return m_Offset == m_Size;
+      }
+
+    private:
+      uint64_t readLittleEndian(size_t size)
+      {
+        check(size);
+        uint64_t value{0};
+        for (size_t n = 0; n < size; ++n) {
+          value |= static_cast<uint64_t>(m_Data[m_Offset++]) << (n * 8);
+        }
+        return value;
+      }
+
+      void check(size_t size) const
+      {
+        if (m_Size - m_Offset < size) {
+          throw TException{"database model cache is truncated"};
+        }
+      }
+
+      const uint8_t* m_Data;
+      size_t m_Size;
+      size_t m_Offset{0};
+    };
+  }
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Implementation
+  /////////////////////////////////////////////////////////////////////////////
+
+  namespace detail
+  {
+    static constexpr char CacheMagic[] = "REXSDBC";
+    static constexpr uint32_t CacheFormatVersion = 1;
+
+    enum TAttributeFlags : uint8_t { HAS_INTERVAL = 0x01, HAS_ENUM_VALUES = 0x02 };
+
+    static inline uint64_t checksum(const uint8_t* data, size_t size) noexcept
+    {
+      uint64_t hash = 0xcbf29ce484222325;
+      for (size_t n = 0; n < size; ++n) {
+        hash ^= data[n];
+        hash *= 0x100000001b3;
+      }
+      return hash;
+    }
+
+    static inline void writeEndpoint(TBinaryWriter& writer, const TIntervalEndpoint& endpoint)
+    {
+      writer.write(static_cast<uint8_t>(endpoint.isSet()));
+      writer.write(static_cast<uint8_t>(endpoint.getType() == TIntervalType::CLOSED));
+      writer.write(endpoint.getLimit());
+    }
+
+    static inline TIntervalEndpoint readEndpoint(TBinaryReader& reader)
+    {
+      const auto set = reader.readByte() != 0;
+      const auto closed = reader.readByte() != 0;
+      const auto limit = reader.readDouble();
+      if (!set) {
+        return TIntervalEndpoint{};
+      }
+      return TIntervalEndpoint{limit, closed ? TIntervalType::CLOSED : TIntervalType::OPEN};
+    }
+
+    static inline std::vector<uint8_t> serializeModel(uint64_t sourceChecksum, const TModel& model)
+    {
+      TBinaryWriter payload;
+      payload.write(model.getVersion().getMajor());
+      payload.write(model.getVersion().getMinor());
+      payload.write(model.getVersion().getPatch());
+      payload.write(model.getLanguage());
+      payload.write(model.getDate());
+      payload.write(static_cast<uint8_t>(model.isReleased()));
+
+      payload.write(static_cast<uint32_t>(model.getUnits().size()));
+      for (const auto& [id, unit] : model.getUnits()) {
+        payload.write(id);
+        payload.write(unit.getName());
+      }
+
+      payload.write(static_cast<uint32_t>(model.getValueTypes().size()));
+      for (const auto& [id, type] : model.getValueTypes()) {
+        payload.write(id);
+        payload.write(toTypeString(type));
+      }
+
+      payload.write(static_cast<uint32_t>(model.getAttributes().size()));
+      for (const auto& [id, attribute] : model.getAttributes()) {
+        payload.write(id);
+        payload.write(attribute.getName());
+        payload.write(toTypeString(attribute.getValueType()));
+        payload.write(attribute.getUnit().getId());
+        payload.write(attribute.getSymbol());
+        const auto& interval = attribute.getInterval();
+        const auto& enums = attribute.getEnums();
+        payload.write(static_cast<uint8_t>((interval ? HAS_INTERVAL : 0) | (enums ? HAS_ENUM_VALUES : 0)));
+        if (interval) {
+          writeEndpoint(payload, interval->getMin());
+          writeEndpoint(payload, interval->getMax());
+        }
+        if (enums) {
+          payload.write(static_cast<uint32_t>(enums->getValues().size()));
+          for (const auto& value : enums->getValues()) {
+            payload.write(value.m_Value);
+            payload.write(value.m_Name);
+          }
+        }
+      }
+
+      payload.write(static_cast<uint32_t>(model.getComponents().size()));
+      for (const auto& [id, component] : model.getComponents()) {
+        payload.write(id);
+        payload.write(component.getName());
+        const auto attributes = component.getAttributes();
+        payload.write(static_cast<uint32_t>(attributes.size()));
+        for (const TAttribute& attribute : attributes) {
+          payload.write(attribute.getAttributeId());
+        }
+      }
+
+      TBinaryWriter writer;
+      auto& buffer = writer.getBuffer();
+      buffer.insert(buffer.end(), std::begin(CacheMagic), std::end(CacheMagic));
+      writer.write(CacheFormatVersion);
+      writer.write(sourceChecksum);
+      writer.write(checksum(payload.getBuffer().data(), payload.getBuffer().size()));
+      buffer.insert(buffer.end(), payload.getBuffer().begin(), payload.getBuffer().end());
+      return std::move(buffer);
+    }
+
+    static inline TModel deserializeModel(uint64_t sourceChecksum, const uint8_t* data, size_t size)
+    {
+      constexpr size_t headerSize = sizeof(CacheMagic) + sizeof(uint32_t) + 2 * sizeof(uint64_t);
+      if (size < headerSize || std::memcmp(data, CacheMagic, sizeof(CacheMagic)) != 0) {
+        throw TException{"not a database model cache"};
+      }
+
+      TBinaryReader header{data + sizeof(CacheMagic), headerSize - sizeof(CacheMagic)};
+      if (header.readUint32() != CacheFormatVersion) {
+        throw TException{"unsupported database model cache format"};
+      }
+      if (header.readUint64() != sourceChecksum) {
+        throw TException{"database model cache does not belong to the database model"};
+      }
+      if (header.readUint64() != checksum(data + headerSize, size - headerSize)) {
+        throw TException{"database model cache is corrupt"};
+      }
+
+      TBinaryReader reader{data + headerSize, size - headerSize};
+      const auto major = reader.readUint32();
+      const auto minor = reader.readUint32();
+      const auto patch = reader.readUint32();
+      auto language = reader.readString();
+      auto date = reader.readString();
+      const auto status = reader.readByte() ? TStatus::RELEASED : TStatus::IN_DEVELOPMENT;
+      TModel model{TRexsVersion{major, minor, patch}, std::move(language), std::move(date), status};
+
+      for (auto count = reader.readUint32(); count > 0; --count) {
+        const auto id = reader.readUint64();
+        model.addUnit(TUnit{id, reader.readString()});
+      }
+
+      for (auto count = reader.readUint32(); count > 0; --count) {
+        const auto id = reader.readUint64();
+        model.addType(id, typeFromString(reader.readString()));
+      }
+
+      for (auto count = reader.readUint32(); count > 0; --count) {
+        auto attributeId = reader.readString();
+        auto name = reader.readString();
+        const auto valueType = typeFromString(reader.readString());
+        const auto unit = reader.readUint64();
+        auto symbol = reader.readString();
+        const auto flags = reader.readByte();
+
+        std::optional<TInterval> interval;
+        if (flags & HAS_INTERVAL) {
+          const auto min = readEndpoint(reader);
+          const auto max = readEndpoint(reader);
+          interval = TInterval{min, max};
+        }
+
+        std::optional<TEnumValues> enumValues;
+        if (flags & HAS_ENUM_VALUES) {
+          std::vector<TEnumValue> values;
+          for (auto valueCount = reader.readUint32(); valueCount > 0; --valueCount) {
+            auto value = reader.readString();
+            auto valueName = reader.readString();
+            values.emplace_back(TEnumValue{std::move(value), std::move(valueName)});
+          }
+          enumValues = TEnumValues{std::move(values)};
+        }
+
+        model.addAttribute(TAttribute{std::move(attributeId), std::move(name), valueType, model.findUnitById(unit),
+                                      std::move(symbol), std::move(interval), std::move(enumValues)});
+      }
+
+      for (auto count = reader.readUint32(); count > 0; --count) {
+        auto componentId = reader.readString();
+        auto name = reader.readString();
+        std::vector<std::reference_wrapper<const TAttribute>> attributes;
+        for (auto attributeCount = reader.readUint32(); attributeCount > 0; --attributeCount) {
+          attributes.emplace_back(model.findAttributeById(reader.readString()));
+        }
+        model.addComponent(TComponent{std::move(componentId), std::move(name), std::move(attributes)});
+      }
+
+      if (!reader.atEnd()) {
+        throw TException{"database model cache has trailing data"};
+      }
+
+      return model;
+    }
+  }
+
+  inline uint64_t TModelCache::checksum(const std::vector<uint8_t>& source) noexcept
+  {
+    return detail::checksum(source.data(), source.size());
+  }
+
+  inline std::optional<TModel> TModelCache::load(uint64_t sourceChecksum) const noexcept
+  {
+    try {
+      const auto path = getPath(sourceChecksum);
+      if (!std::filesystem::exists(path)) {
+        return {};
+      }
+      TResult result;
+      const auto file = rexsapi::detail::mapFile(result, path);
+      if (!file) {
+        return {};
+      }
+      return detail::deserializeModel(sourceChecksum, file->data(), file->size());
+    } catch (const std::exception&) {
+      // an unusable cache file will be replaced by the next store
+      return {};
+    }
+  }
+
+  inline void TModelCache::store(uint64_t sourceChecksum, const TModel& model) const noexcept
+  {
+    std::filesystem::path tmpPath;
+    try {
+      const auto buffer = detail::serializeModel(sourceChecksum, model);
+
+      std::filesystem::create_directories(m_Directory);
+      const auto path = getPath(sourceChecksum);
+      // write to a temporary file first, so concurrent readers never see a partially written cache file
+      tmpPath = path;
+      tmpPath += fmt::format(".{:08x}.tmp", std::random_device{}());
+      {
+        std::ofstream file{tmpPath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc};
+        file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        if (!file.good()) {
+          throw TException{"cannot write database model cache"};
+        }
+      }
+      std::filesystem::rename(tmpPath, path);
+    } catch (const std::exception&) {
+      // caching is only an optimization
+      std::error_code ec;
+      std::filesystem::remove(tmpPath, ec);
+    }
+  }
+
+  inline std::filesystem::path TModelCache::getPath(uint64_t checksum) const
+  {
+    return m_Directory / fmt::format("rexs_schema_{:016x}.rexscache", checksum);
+  }
+}
+
+#endif
@@ -17,8 +17,13 @@
 #ifndef REXSAPI_DATABASE_MODEL_REGISTRY_HXX
 #define REXSAPI_DATABASE_MODEL_REGISTRY_HXX
 
+#include <rexsapi/Result.hxx>
 #include <rexsapi/database/Model.hxx>
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
 
 /** @file */
 
@@ -49,11 +54,30 @@ namespace rexsapi::database
      * @param strict Determines if the latest available model version shall be returned if an exact one was not found.
      * If set to true, will throw an exception if the exact version could not be found.
      * @return const TModel& to the found database model
-     * @throws TException if the specific version or language is not available and strict mode was set to true
+     * @throws TException if the specific version or language is not available or cannot be loaded and strict mode was
+     * set to true
      */
     [[nodiscard]] const TModel& getModel(const TRexsVersion& version, const std::string& language,
                                          bool strict = true) const;
 
+    /**
+     * @brief Retrieves a database model for a specific version and language reporting models that cannot be loaded.
+     *
+     * In contrast to the overload without a result, database models that are skipped in non-strict mode because they
+     * cannot be loaded are reported as warnings.
+     *
+     * @param result Will contain a warning for each database model that could not be loaded
+     * @param version The database model version to retrieve
+     * @param language The language of the database model to retrieve
+     * @param strict Determines if the latest available model version shall be returned if an exact one was not found.
+     * If set to true, will throw an exception if the exact version could not be found.
+     * @return const TModel& to the found database model
+     * @throws TException if the specific version or language is not available or cannot be loaded and strict mode was
+     * set to true
+     */
+    [[nodiscard]] const TModel& getModel(TResult& result, const TRexsVersion& version, const std::string& language,
+                                         bool strict = true) const;
+
     /**
      * @brief Creates a model registry.
      *
@@ -68,13 +92,56 @@ namespace rexsapi::database
     template<typename TModelLoader>
     static std::pair<TModelRegistry, TResult> createModelRegistry(const TModelLoader& loader);
 
+    /**
+     * @brief Creates a model registry loading the database models on demand.
+     *
+     * Only the versions and languages of the available database models are determined upfront. A database model is
+     * loaded the first time it is retrieved from the registry. Retrieving models is thread-safe.
+     *
+     * @tparam TModelLoader Loader class for indexing the database model files. The TXmlModelLoader class is provided as
+     * default implementation. The loader has to define the following method <br> ```TResult index(const
+     * std::function<void(TRexsVersion, std::string, TModelFactory)>& callback) const```
+     * @param loader The loader instance to index the database model files with
+     * @return std::pair<TModelRegistry, TResult> containing the model registry and a result describing the outcome of
+     * the indexing. Issues with loading a database model will only be reported once the model is retrieved. A database
+     * model that cannot be loaded is treated like a missing one, non-strict retrieval falls back to the next model.
+     */
+    template<typename TModelLoader>
+    static std::pair<TModelRegistry, TResult> createLazyModelRegistry(const TModelLoader& loader);
+
   private:
+    struct TEntry {
+      TRexsVersion m_Version;
+      std::string m_Language;
+      TModelFactory m_Factory;
+      std::mutex m_Mutex{};
+      std::optional<TModel> m_Model{};
+      // set once loading the model failed, the error is not modified afterwards
+      std::atomic<bool> m_Failed{false};
+      std::string m_Error{};
+    };
+
     explicit TModelRegistry(std::vector<TModel>&& models)
-    : m_Models{std::move(models)}
     {
+      for (auto& model : models) {
+        auto version = model.getVersion();
+        auto language = model.getLanguage();
+        m_Entries.emplace_back(new TEntry{std::move(version), std::move(language), {}, {}, std::move(model)});
+      }
     }
 
-    std::vector<TModel> m_Models;
+    explicit TModelRegistry(std::vector<std::unique_ptr<TEntry>>&& entries)
+    : m_Entries{std::move(entries)}
+    {
+    }
+
+    const TModel& findModel(TResult* result, const TRexsVersion& version, const std::string& language,
+                            bool strict) const;
+
+    static const TModel* loadModel(TResult* result, TEntry& entry);
+
+    // the entries are only modified while holding their mutex, when their model is loaded on demand
+    std::vector<std::unique_ptr<TEntry>> m_Entries;
   };
 
 
@@ -85,30 +152,58 @@ namespace rexsapi::database
   inline const TModel& TModelRegistry::getModel(const TRexsVersion& version, const std::string& language,
                                                 bool strict) const
   {
-    const auto it = std::find_if(m_Models.begin(), m_Models.end(), [&version, &language](const auto& model) {
-      return model.getVersion() == version && model.getLanguage() == language;
+    return findModel(nullptr, version, language, strict);
+  }
+
+  inline const TModel& TModelRegistry::getModel(TResult& result, const TRexsVersion& version,
+                                                const std::string& language, bool strict) const
+  {
+    return findModel(&result, version, language, strict);
+  }
+
+  inline const TModel& TModelRegistry::findModel(TResult* result, const TRexsVersion& version,
+                                                 const std::string& language, bool strict) const
+  {
+    const auto it = std::find_if(m_Entries.begin(), m_Entries.end(), [&version, &language](const auto& entry) {
+      return entry->m_Version == version && entry->m_Language == language;
     });
 
-    if (it != m_Models.end()) {
-      return *it;
+    if (it != m_Entries.end()) {
+      // in strict mode the failure is reported by the exception
+      if (const auto* model = loadModel(strict ? nullptr : result, **it); model) {
+        return *model;
+      }
+      if (strict) {
+        throw TException{fmt::format("cannot load database model for version '{}' and locale '{}': {}",
+                                     version.asString(), language, (*it)->m_Error)};
+      }
     }
 
     if (!strict) {
       // no exact model was found, find the latest model for the given language
-      // otherwise choose english
+      // otherwise choose english. Models that cannot be loaded are skipped.
       const TRexsVersion baseVersion{1, 0};
-      const TModel* baseModel{nullptr};
-      std::for_each(m_Models.begin(), m_Models.end(), [&baseModel, &baseVersion, &language](const auto& model) mutable {
-        if (model.getLanguage() == language && model.getVersion() >= (baseModel ? baseModel->getVersion() : baseVersion)) {
-          baseModel = &model;
+      for (;;) {
+        TEntry* baseEntry{nullptr};
+        std::for_each(m_Entries.begin(), m_Entries.end(), [&baseEntry, &baseVersion, &language](const auto& entry) {
+          if (entry->m_Failed) {
+            return;
+          }
+          if (entry->m_Language == language &&
+              entry->m_Version >= (baseEntry ? baseEntry->m_Version : baseVersion)) {
+            baseEntry = entry.get();
+          }
+          if (entry->m_Language == "en" && entry->m_Version > (baseEntry ? baseEntry->m_Version : baseVersion)) {
+            baseEntry = entry.get();
+          }
+        });
+
+        if (!baseEntry) {
+          break;
         }
-        if (model.getLanguage() == "en" && model.getVersion() > (baseModel ? baseModel->getVersion() : baseVersion)) {
-          baseModel = &model;
+        if (const auto* model = loadModel(result, *baseEntry); model) {
+          return *model;
         }
-      });
-
-      if (baseModel) {
-        return *baseModel;
       }
     }
 
@@ -116,6 +211,25 @@ namespace rexsapi::database
       fmt::format("cannot find a database model for version '{}' and locale '{}'", version.asString(), language)};
   }
 
+  inline const TModel* TModelRegistry::loadModel(TResult* result, TEntry& entry)
+  {
+    std::scoped_lock lock{entry.m_Mutex};
+    if (!entry.m_Model && !entry.m_Failed) {
+      try {
+        entry.m_Model.emplace(entry.m_Factory());
+      } catch (const std::exception& ex) {
+        entry.m_Error = ex.what();
+        entry.m_Failed = true;
+      }
+    }
+    if (entry.m_Failed && result != nullptr) {
+      auto message = fmt::format("database model for version '{}' and locale '{}' cannot be loaded: {}",
+                                 entry.m_Version.asString(), entry.m_Language, entry.m_Error);
+      result->addError(TError{TErrorLevel::WARN, std::move(message)});
+    }
+    return entry.m_Model ? &*entry.m_Model : nullptr;
+  }
+
   template<typename TModelLoader>
   std::pair<TModelRegistry, TResult> TModelRegistry::createModelRegistry(const TModelLoader& loader)
   {
@@ -126,6 +240,17 @@ namespace rexsapi::database
 
     return std::make_pair(TModelRegistry{std::move(models)}, result);
   }
+
+  template<typename TModelLoader>
+  std::pair<TModelRegistry, TResult> TModelRegistry::createLazyModelRegistry(const TModelLoader& loader)
+  {
+    std::vector<std::unique_ptr<TEntry>> entries;
+    auto result = loader.index([&entries](TRexsVersion version, std::string language, TModelFactory factory) {
+      entries.emplace_back(new TEntry{std::move(version), std::move(language), std::move(factory)});
+    });
+
+    return std::make_pair(TModelRegistry{std::move(entries)}, result);
+  }
 }
 
 #endif
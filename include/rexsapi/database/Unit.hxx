@@ -17,6 +17,8 @@
 #ifndef REXSAPI_DATABASE_UNIT_HXX
 #define REXSAPI_DATABASE_UNIT_HXX
 
+#include <rexsapi/StringPool.hxx>
+
 #include <cstdint>
 #include <string>
 
@@ -43,9 +45,9 @@ namespace rexsapi::database
      * @param id A unique id for the unit
      * @param name A unique name for the unit
      */
-    TUnit(uint64_t id, std::string name)
+    TUnit(uint64_t id, const std::string& name)
     : m_Id{id}
-    , m_Name{std::move(name)}
+    , m_Name{&rexsapi::detail::TStringPool::intern(name)}
     {
     }
 
@@ -54,14 +56,19 @@ namespace rexsapi::database
       return m_Id;
     }
 
+    /**
+     * @brief Returns the name of the unit.
+     *
+     * @return const std::string& to the interned name, stays valid after the unit has been destroyed
+     */
     [[nodiscard]] const std::string& getName() const noexcept
     {
-      return m_Name;
+      return *m_Name;
     }
 
     [[nodiscard]] bool compare(std::string_view name) const noexcept
     {
-      return m_Name == name;
+      return *m_Name == name;
     }
 
     /**
@@ -92,7 +99,7 @@ namespace rexsapi::database
 
   private:
     uint64_t m_Id{};
-    std::string m_Name{};
+    const std::string* m_Name;
   };
 }
 
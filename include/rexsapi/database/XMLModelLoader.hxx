@@ -18,11 +18,14 @@
 #define REXSAPI_DATABASE_XML_MODEL_LOADER_HXX
 
 #include <rexsapi/ConversionHelper.hxx>
+#include <rexsapi/XMLStreamReader.hxx>
 #include <rexsapi/XSDSchemaValidator.hxx>
 #include <rexsapi/XmlUtils.hxx>
 #include <rexsapi/database/ComponentAttributeMapper.hxx>
+#include <rexsapi/database/ModelCache.hxx>
 
 #include <cstring>
+#include <memory>
 
 /** @file */
 
@@ -49,10 +52,14 @@ namespace rexsapi::database
      *
      * @param resourceLoader Resource loader instance to use for model loading
      * @param schemaLoader Resource loader instance to use for schema loading
+     * @param cache Will be used to load models from and store models to if set, instead of creating them from the XML
+     *              buffers every time
      */
-    explicit TXmlModelLoader(const TResourceLoader& resourceLoader, const TSchemaLoader& schemaLoader)
+    explicit TXmlModelLoader(const TResourceLoader& resourceLoader, const TSchemaLoader& schemaLoader,
+                             std::optional<TModelCache> cache = {})
     : m_ResourceLoader{resourceLoader}
     , m_SchemaLoader{schemaLoader}
+    , m_Cache{std::move(cache)}
     {
     }
 
@@ -68,11 +75,36 @@ namespace rexsapi::database
      */
     TResult load(const std::function<void(TModel&&)>& callback) const;
 
+    /**
+     * @brief Indexes REXS database models without loading them.
+     *
+     * Uses the resource loader to find XML database models and reads only the version and language from each of them.
+     * Hands the version and language together with a factory for the model to the callback. The factory will load the
+     * model buffer, check it against the REXS database model XSD schema, and create the model when called. The factory
+     * does not depend on this loader or the resource and schema loaders, and can be called after they have been
+     * destroyed.
+     *
+     * The resource loader has to define the following method <br> ```TResult index(const std::function<void(TResult&,
+     * std::istream&, std::function<std::vector<uint8_t>(TResult&)>)>& callback) const```
+     *
+     * @param callback Will be called for each found model for further processing
+     * @return TResult describing the outcome of the indexing
+     */
+    TResult index(const std::function<void(TRexsVersion, std::string, TModelFactory)>& callback) const;
+
   private:
-    std::optional<TInterval> readInterval(const pugi::xpath_node& node) const;
+    static std::optional<TModel> loadModel(TResult& result, std::vector<uint8_t>& buffer,
+                                           const TXSDSchemaValidator& validator,
+                                           const std::optional<TModelCache>& cache);
+
+    static std::optional<TModel> createModel(TResult& result, std::vector<uint8_t>& buffer,
+                                             const TXSDSchemaValidator& validator);
+
+    static std::optional<TInterval> readInterval(const pugi::xpath_node& node);
 
     const TResourceLoader& m_ResourceLoader;
     const TSchemaLoader& m_SchemaLoader;
+    const std::optional<TModelCache> m_Cache;
   };
 
 
@@ -84,80 +116,156 @@ namespace rexsapi::database
   inline TResult
   TXmlModelLoader<TResourceLoader, TSchemaLoader>::load(const std::function<void(TModel&&)>& callback) const
   {
-    return m_ResourceLoader.load([this, &callback](TResult& result, std::vector<uint8_t>& buffer) {
-      const pugi::xml_document doc =
-        rexsapi::detail::loadXMLDocument(result, buffer, TXSDSchemaValidator{m_SchemaLoader});
-      if (!result) {
-        return;
+    const TXSDSchemaValidator validator{m_SchemaLoader};
+    return m_ResourceLoader.load([this, &validator, &callback](TResult& result, std::vector<uint8_t>& buffer) {
+      auto model = loadModel(result, buffer, validator, m_Cache);
+      if (model) {
+        callback(std::move(*model));
       }
+    });
+  }
 
-      const auto rexsModel = *doc.select_nodes("/rexsSchema").begin();
-      TModel model{TRexsVersion{rexsapi::detail::getStringAttribute(rexsModel, "version")},
-                   rexsapi::detail::getStringAttribute(rexsModel, "language"),
-                   rexsapi::detail::getStringAttribute(rexsModel, "date"),
-                   statusFromString(rexsapi::detail::getStringAttribute(rexsModel, "status"))};
+  template<typename TResourceLoader, typename TSchemaLoader>
+  inline TResult
+  TXmlModelLoader<TResourceLoader, TSchemaLoader>::index(
+    const std::function<void(TRexsVersion, std::string, TModelFactory)>& callback) const
+  {
+    // the validator is shared by all factories
+    auto validator = std::make_shared<const TXSDSchemaValidator>(m_SchemaLoader);
 
-      for (const auto& node : doc.select_nodes("/rexsSchema/units/unit")) {
-        auto id = convertToUint64(rexsapi::detail::getStringAttribute(node, "id"));
-        auto name = rexsapi::detail::getStringAttribute(node, "name");
-        model.addUnit(TUnit{id, name});
+    return m_ResourceLoader.index([this, &callback, &validator](TResult& result, std::istream& stream, auto factory) {
+      std::string version;
+      std::string language;
+      try {
+        rexsapi::detail::TXMLStreamReader reader{stream};
+        if (reader.next() == rexsapi::detail::TXMLEvent::START_ELEMENT && reader.getName() == "rexsSchema") {
+          for (const auto& [name, value] : reader.getAttributes()) {
+            if (name == "version") {
+              version = value;
+            } else if (name == "language") {
+              language = value;
+            }
+          }
+        }
+      } catch (const std::exception& ex) {
+        result.addError(TError{TErrorLevel::CRIT, fmt::format("cannot read database model header: {}", ex.what())});
+        return;
       }
-
-      for (const auto& node : doc.select_nodes("/rexsSchema/valueTypes/valueType")) {
-        auto id = convertToUint64(rexsapi::detail::getStringAttribute(node, "id"));
-        auto name = rexsapi::detail::getStringAttribute(node, "name");
-        model.addType(id, typeFromString(name));
+      if (version.empty() || language.empty()) {
+        result.addError(TError{TErrorLevel::CRIT, "database model header has no version or language"});
+        return;
       }
 
-      for (const auto& node : doc.select_nodes("/rexsSchema/attributes/attribute")) {
-        auto attributeId = rexsapi::detail::getStringAttribute(node, "attributeId");
-        auto name = rexsapi::detail::getStringAttribute(node, "name");
-        auto valueType =
-          model.findValueTypeById(convertToUint64(rexsapi::detail::getStringAttribute(node, "valueType")));
-        auto unit = convertToUint64(rexsapi::detail::getStringAttribute(node, "unit"));
-        std::string symbol = rexsapi::detail::getStringAttribute(node, "symbol", "");
-
-        std::optional<TInterval> interval = readInterval(node);
-
-        std::optional<TEnumValues> enumValues;
-        if (const auto& enums = node.node().first_child();
-            (valueType == TValueType::ENUM || valueType == TValueType::ENUM_ARRAY) && !enums.empty() &&
-            std::strncmp(enums.name(), "enumValues", ::strlen("enumValues")) == 0) {
-          std::vector<TEnumValue> values;
-          for (const auto& value : enums.children()) {
-            auto enumValue = rexsapi::detail::getStringAttribute(value, "value");
-            auto enumName = rexsapi::detail::getStringAttribute(value, "name");
-            values.emplace_back(TEnumValue{enumValue, enumName});
-          }
-          enumValues = TEnumValues{std::move(values)};
+      callback(TRexsVersion{version}, language, [validator, cache = m_Cache, factory = std::move(factory)]() {
+        TResult res;
+        auto buffer = factory(res);
+        auto model = res ? loadModel(res, buffer, *validator, cache) : std::nullopt;
+        if (!model) {
+          throw TException{fmt::format("cannot load database model: {}",
+                                       res.getErrors().empty() ? "" : res.getErrors().front().getMessage())};
         }
+        return std::move(*model);
+      });
+    });
+  }
 
-        model.addAttribute(
-          TAttribute{attributeId, name, valueType, model.findUnitById(unit), symbol, interval, enumValues});
-      }
+  template<typename TResourceLoader, typename TSchemaLoader>
+  inline std::optional<TModel>
+  TXmlModelLoader<TResourceLoader, TSchemaLoader>::loadModel(TResult& result, std::vector<uint8_t>& buffer,
+                                                             const TXSDSchemaValidator& validator,
+                                                             const std::optional<TModelCache>& cache)
+  {
+    if (!cache) {
+      return createModel(result, buffer, validator);
+    }
 
-      std::vector<std::pair<std::string, std::string>> attributeMappings;
-      for (const auto& node : doc.select_nodes("/rexsSchema/componentAttributeMappings/componentAttributeMapping")) {
-        auto componentId = rexsapi::detail::getStringAttribute(node, "componentId");
-        auto attributeId = rexsapi::detail::getStringAttribute(node, "attributeId");
-        attributeMappings.emplace_back(componentId, attributeId);
-      }
-      rexsapi::database::detail::TComponentAttributeMapper attributeMapper{model, std::move(attributeMappings)};
+    // the checksum has to be calculated before parsing, as the buffer will be modified by the xml parser
+    const auto checksum = TModelCache::checksum(buffer);
+    if (auto model = cache->load(checksum); model) {
+      return model;
+    }
+    auto model = createModel(result, buffer, validator);
+    if (model) {
+      cache->store(checksum, *model);
+    }
+    return model;
+  }
+
+  template<typename TResourceLoader, typename TSchemaLoader>
+  inline std::optional<TModel>
+  TXmlModelLoader<TResourceLoader, TSchemaLoader>::createModel(TResult& result, std::vector<uint8_t>& buffer,
+                                                               const TXSDSchemaValidator& validator)
+  {
+    const pugi::xml_document doc = rexsapi::detail::loadXMLDocument(result, buffer, validator);
+    if (!result) {
+      return {};
+    }
+
+    const auto rexsModel = *doc.select_nodes("/rexsSchema").begin();
+    TModel model{TRexsVersion{rexsapi::detail::getStringAttribute(rexsModel, "version")},
+                 rexsapi::detail::getStringAttribute(rexsModel, "language"),
+                 rexsapi::detail::getStringAttribute(rexsModel, "date"),
+                 statusFromString(rexsapi::detail::getStringAttribute(rexsModel, "status"))};
+
+    for (const auto& node : doc.select_nodes("/rexsSchema/units/unit")) {
+      auto id = convertToUint64(node.node().attribute("id").value());
+      auto name = rexsapi::detail::getStringAttribute(node, "name");
+      model.addUnit(TUnit{id, name});
+    }
 
-      for (const auto& node : doc.select_nodes("/rexsSchema/components/component")) {
-        auto id = rexsapi::detail::getStringAttribute(node, "componentId");
-        auto name = rexsapi::detail::getStringAttribute(node, "name");
-        auto attributes = attributeMapper.getAttributesForComponent(id);
-        model.addComponent(TComponent{id, name, std::move(attributes)});
+    for (const auto& node : doc.select_nodes("/rexsSchema/valueTypes/valueType")) {
+      auto id = convertToUint64(node.node().attribute("id").value());
+      auto name = rexsapi::detail::getStringAttribute(node, "name");
+      model.addType(id, typeFromString(name));
+    }
+
+    for (const auto& node : doc.select_nodes("/rexsSchema/attributes/attribute")) {
+      auto attributeId = rexsapi::detail::getStringAttribute(node, "attributeId");
+      auto name = rexsapi::detail::getStringAttribute(node, "name");
+      auto valueType = model.findValueTypeById(convertToUint64(node.node().attribute("valueType").value()));
+      auto unit = convertToUint64(node.node().attribute("unit").value());
+      std::string symbol = rexsapi::detail::getStringAttribute(node, "symbol", "");
+
+      std::optional<TInterval> interval = readInterval(node);
+
+      std::optional<TEnumValues> enumValues;
+      if (const auto& enums = node.node().first_child();
+          (valueType == TValueType::ENUM || valueType == TValueType::ENUM_ARRAY) && !enums.empty() &&
+          std::strncmp(enums.name(), "enumValues", ::strlen("enumValues")) == 0) {
+        std::vector<TEnumValue> values;
+        for (const auto& value : enums.children()) {
+          auto enumValue = rexsapi::detail::getStringAttribute(value, "value");
+          auto enumName = rexsapi::detail::getStringAttribute(value, "name");
+          values.emplace_back(TEnumValue{enumValue, enumName});
+        }
+        enumValues = TEnumValues{std::move(values)};
       }
 
-      callback(std::move(model));
-    });
+      model.addAttribute(
+        TAttribute{attributeId, name, valueType, model.findUnitById(unit), symbol, interval, enumValues});
+    }
+
+    std::vector<std::pair<std::string, std::string>> attributeMappings;
+    for (const auto& node : doc.select_nodes("/rexsSchema/componentAttributeMappings/componentAttributeMapping")) {
+      auto componentId = rexsapi::detail::getStringAttribute(node, "componentId");
+      auto attributeId = rexsapi::detail::getStringAttribute(node, "attributeId");
+      attributeMappings.emplace_back(componentId, attributeId);
+    }
+    rexsapi::database::detail::TComponentAttributeMapper attributeMapper{model, std::move(attributeMappings)};
+
+    for (const auto& node : doc.select_nodes("/rexsSchema/components/component")) {
+      auto id = rexsapi::detail::getStringAttribute(node, "componentId");
+      auto name = rexsapi::detail::getStringAttribute(node, "name");
+      auto attributes = attributeMapper.getAttributesForComponent(id);
+      model.addComponent(TComponent{id, name, std::move(attributes)});
+    }
+
+    return model;
   }
 
   template<typename TResourceLoader, typename TSchemaLoader>
   std::optional<TInterval>
-  TXmlModelLoader<TResourceLoader, TSchemaLoader>::readInterval(const pugi::xpath_node& node) const
+  TXmlModelLoader<TResourceLoader, TSchemaLoader>::readInterval(const pugi::xpath_node& node)
   {
     std::optional<TInterval> interval;
 
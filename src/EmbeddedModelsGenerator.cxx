@@ -0,0 +1,126 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Converts REXS database model xml files into the binary TModelCache format and writes them as inline C++ arrays
+// into a header. Used by the build for the REXSAPI_EMBEDDED_MODELS option.
+//
+// usage: rexsapi_embedded_models_generator <output header> <rexs-schema.xsd> <database model xml files...>
+
+#include <rexsapi/database/ModelCache.hxx>
+#include <rexsapi/database/XMLModelLoader.hxx>
+
+#include <iostream>
+
+
+namespace
+{
+  class TSingleResourceLoader
+  {
+  public:
+    explicit TSingleResourceLoader(std::vector<uint8_t> buffer)
+    : m_Buffer{std::move(buffer)}
+    {
+    }
+
+    rexsapi::TResult load(const std::function<void(rexsapi::TResult&, std::vector<uint8_t>&)>& callback) const
+    {
+      rexsapi::TResult result;
+      auto buffer = m_Buffer;
+      callback(result, buffer);
+      return result;
+    }
+
+  private:
+    std::vector<uint8_t> m_Buffer;
+  };
+
+  std::string writeModel(std::ostream& out, size_t index, const std::filesystem::path& path,
+                         const rexsapi::TFileXsdSchemaLoader& schemaLoader)
+  {
+    rexsapi::TResult result;
+    auto buffer = rexsapi::detail::loadFile(result, path);
+    if (!result) {
+      throw rexsapi::TException{fmt::format("cannot load '{}'", path.string())};
+    }
+    const auto checksum = rexsapi::database::TModelCache::checksum(buffer);
+
+    const TSingleResourceLoader resourceLoader{std::move(buffer)};
+    const rexsapi::database::TXmlModelLoader modelLoader{resourceLoader, schemaLoader};
+    std::optional<rexsapi::database::TModel> model;
+    result = modelLoader.load([&model](rexsapi::database::TModel&& loaded) {
+      model.emplace(std::move(loaded));
+    });
+    if (!result || !model) {
+      throw rexsapi::TException{fmt::format("cannot create database model from '{}': {}", path.string(),
+                                            result.getErrors().empty() ? "" : result.getErrors()[0].getMessage())};
+    }
+
+    const auto data = rexsapi::database::detail::serializeModel(checksum, *model);
+    out << fmt::format("  // {}\n  inline constexpr uint8_t EmbeddedModelData{}[] = {{", path.filename().string(),
+                       index);
+    for (size_t n = 0; n < data.size(); ++n) {
+      out << (n % 24 ? "," : (n ? ",\n    " : "\n    ")) << fmt::format("0x{:02x}", data[n]);
+    }
+    out << "};\n\n";
+
+    const auto& version = model->getVersion();
+    return fmt::format("    TEmbeddedModel{{{}, {}, {}, \"{}\", 0x{:016x}ULL, EmbeddedModelData{}, "
+                       "sizeof(EmbeddedModelData{})}}",
+                       version.getMajor(), version.getMinor(), version.getPatch(), model->getLanguage(), checksum,
+                       index, index);
+  }
+}
+
+int main(int argc, char** argv)
+{
+  if (argc < 4) {
+    std::cerr << "usage: " << argv[0] << " <output header> <rexs-schema.xsd> <database model xml files...>"
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  try {
+    const std::filesystem::path output{argv[1]};
+    const rexsapi::TFileXsdSchemaLoader schemaLoader{argv[2]};
+    const std::vector<std::filesystem::path> models{argv + 3, argv + argc};
+
+    std::stringstream out;
+    out << "// generated by rexsapi_embedded_models_generator, do not edit\n\n"
+        << "#ifndef REXSAPI_EMBEDDED_MODEL_DATA_HXX\n#define REXSAPI_EMBEDDED_MODEL_DATA_HXX\n\n"
+        << "namespace rexsapi::database::detail\n{\n";
+    std::vector<std::string> entries;
+    for (size_t n = 0; n < models.size(); ++n) {
+      entries.emplace_back(writeModel(out, n, models[n], schemaLoader));
+    }
+    out << fmt::format("  inline constexpr std::array<TEmbeddedModel, {}> EmbeddedModels{{{{\n", models.size());
+    for (size_t n = 0; n < entries.size(); ++n) {
+      out << entries[n] << (n + 1 < entries.size() ? ",\n" : "\n");
+    }
+    out << "  }};\n}\n\n#endif\n";
+
+    std::filesystem::create_directories(output.parent_path());
+    std::ofstream file{output, std::ios_base::out | std::ios_base::trunc};
+    file << out.str();
+    if (!file.good()) {
+      throw rexsapi::TException{fmt::format("cannot write '{}'", output.string())};
+    }
+  } catch (const std::exception& ex) {
+    std::cerr << "Exception caught: " << ex.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
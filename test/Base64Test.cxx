@@ -40,5 +40,36 @@ TEST_CASE("Base64 test")
     checkBase64("foob", "Zm9vYg==");
     checkBase64("fooba", "Zm9vYmE=");
     checkBase64("foobar", "Zm9vYmFy");
+    checkBase64("foobarfoobarf", "Zm9vYmFyZm9vYmFyZg==");
+    checkBase64("foobarfoobarfo", "Zm9vYmFyZm9vYmFyZm8=");
+  }
+
+  SUBCASE("Encoding / decoding all byte values")
+  {
+    std::vector<uint8_t> data;
+    for (size_t n = 0; n < 1024; ++n) {
+      data.emplace_back(static_cast<uint8_t>(n * 7));
+    }
+    for (const auto len : {size_t{255}, size_t{256}, size_t{257}, size_t{1024}}) {
+      const auto encoded = rexsapi::detail::base64Encode(data.data(), len);
+      CHECK(encoded.size() == (len + 2) / 3 * 4);
+      const auto decoded = rexsapi::detail::base64Decode(encoded);
+      CHECK(decoded == std::vector<uint8_t>(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(len)));
+    }
+  }
+
+  SUBCASE("Decoding with line breaks and without padding")
+  {
+    const std::vector<uint8_t> expected{'f', 'o', 'o', 'b', 'a', 'r'};
+    CHECK(rexsapi::detail::base64Decode("Zm9v\nYmFy") == expected);
+    CHECK(rexsapi::detail::base64Decode("Zm9vYmFy\n") == expected);
+    CHECK(rexsapi::detail::base64Decode("Zm9vYg") == std::vector<uint8_t>{'f', 'o', 'o', 'b'});
+    CHECK(rexsapi::detail::base64Decode("Zm9vYmE") == std::vector<uint8_t>{'f', 'o', 'o', 'b', 'a'});
+  }
+
+  SUBCASE("Decoding invalid data")
+  {
+    CHECK_THROWS_WITH((void)rexsapi::detail::base64Decode("Zm9v!mFy"), "cannot decode base64 string: invalid data");
+    CHECK_THROWS_WITH((void)rexsapi::detail::base64Decode("Zm9vYmF$"), "cannot decode base64 string: invalid data");
   }
 }
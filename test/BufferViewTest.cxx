@@ -0,0 +1,55 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <rexsapi/BufferView.hxx>
+
+#include <numeric>
+
+#include <doctest.h>
+
+TEST_CASE("Buffer view test")
+{
+  SUBCASE("Empty view")
+  {
+    const rexsapi::TBufferView view;
+    CHECK(view.empty());
+    CHECK(view.size() == 0);
+    CHECK(view.data() == nullptr);
+    CHECK(view.begin() == view.end());
+  }
+
+  SUBCASE("View of vector")
+  {
+    std::vector<uint8_t> buffer{1, 2, 3, 4};
+    const rexsapi::TBufferView view = buffer;
+    CHECK_FALSE(view.empty());
+    CHECK(view.size() == 4);
+    CHECK(view.data() == buffer.data());
+    CHECK(std::accumulate(view.begin(), view.end(), 0) == 10);
+
+    view.data()[0] = 5;
+    CHECK(buffer[0] == 5);
+  }
+
+  SUBCASE("View of memory")
+  {
+    uint8_t buffer[] = {1, 2, 3};
+    const rexsapi::TBufferView view{buffer + 1, 2};
+    CHECK(view.size() == 2);
+    CHECK(*view.begin() == 2);
+    CHECK(view.end() == buffer + 3);
+  }
+}
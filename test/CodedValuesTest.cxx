@@ -46,24 +46,55 @@ TEST_CASE("Coded values test")
     CHECK(encoded == value);
   }
 
+  SUBCASE("Decode widened")
+  {
+    const auto ints =
+      rexsapi::detail::TCodedValueArray<int32_t>::decode<int64_t>("AQAAAAIAAAADAAAABAAAAAUAAAAGAAAABwAAAAgAAAA=");
+    CHECK(ints == std::vector<int64_t>{1, 2, 3, 4, 5, 6, 7, 8});
+
+    const auto floats = rexsapi::detail::TCodedValueArray<float>::decode<double>("MveeQZ6hM0I=");
+    REQUIRE(floats.size() == 2);
+    CHECK(floats[0] == doctest::Approx(19.8707));
+    CHECK(floats[1] == doctest::Approx(44.9078));
+
+    const auto value = rexsapi::detail::TCodedValueArrayDecoder<
+      double, rexsapi::detail::Enum2type<rexsapi::detail::to_underlying(rexsapi::detail::TCodedValueType::Float32)>>::
+      decode("AADgQAAAAEEAABBB");
+    CHECK(value.getValue<rexsapi::TFloatArrayType>() == std::vector<double>{7.0, 8.0, 9.0});
+    CHECK(value.coded() == rexsapi::TCodeType::Optimized);
+
+    const auto [encoded, type] =
+      rexsapi::detail::encodeMatrix(rexsapi::TMatrix<int64_t>{{{1, 2, 3}, {4, 5, 6}}}, rexsapi::TCodeType::Default);
+    const auto matrix = rexsapi::detail::TCodedValueMatrix<int32_t>::decode<int64_t>(encoded, 3, 2);
+    CHECK(matrix == rexsapi::TMatrix<int64_t>{{{1, 2, 3}, {4, 5, 6}}});
+  }
+
+  SUBCASE("Decode incomplete element")
+  {
+    const uint8_t data[] = {1, 0, 0, 0, 2, 0};
+    const auto encoded = rexsapi::detail::base64Encode(data, sizeof(data));
+    CHECK(rexsapi::detail::TCodedValueArray<int32_t>::decode(encoded) == std::vector<int32_t>{1});
+    CHECK(rexsapi::detail::TCodedValueArray<double>::decode(encoded).empty());
+  }
+
   SUBCASE("float64 matrix")
   {
     rexsapi::TMatrix<double> matrix{{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}, {7.0, 8.0, 9.0}}};
     const auto encoded = rexsapi::detail::TCodedValueMatrix<double>::encode(matrix);
     const auto decoded = rexsapi::detail::TCodedValueMatrix<double>::decode(encoded, 3, 3);
-    REQUIRE(decoded.m_Values.size() == 3);
-    REQUIRE(decoded.m_Values[0].size() == 3);
-    CHECK(decoded.m_Values[0][0] == doctest::Approx{1.0});
-    CHECK(decoded.m_Values[0][1] == doctest::Approx{2.0});
-    CHECK(decoded.m_Values[0][2] == doctest::Approx{3.0});
-    REQUIRE(decoded.m_Values[1].size() == 3);
-    CHECK(decoded.m_Values[1][0] == doctest::Approx{4.0});
-    CHECK(decoded.m_Values[1][1] == doctest::Approx{5.0});
-    CHECK(decoded.m_Values[1][2] == doctest::Approx{6.0});
-    REQUIRE(decoded.m_Values[2].size() == 3);
-    CHECK(decoded.m_Values[2][0] == doctest::Approx{7.0});
-    CHECK(decoded.m_Values[2][1] == doctest::Approx{8.0});
-    CHECK(decoded.m_Values[2][2] == doctest::Approx{9.0});
+    REQUIRE(decoded.getRowCount() == 3);
+    REQUIRE(decoded.getRow(0).size() == 3);
+    CHECK(decoded(0, 0) == doctest::Approx{1.0});
+    CHECK(decoded(0, 1) == doctest::Approx{2.0});
+    CHECK(decoded(0, 2) == doctest::Approx{3.0});
+    REQUIRE(decoded.getRow(1).size() == 3);
+    CHECK(decoded(1, 0) == doctest::Approx{4.0});
+    CHECK(decoded(1, 1) == doctest::Approx{5.0});
+    CHECK(decoded(1, 2) == doctest::Approx{6.0});
+    REQUIRE(decoded.getRow(2).size() == 3);
+    CHECK(decoded(2, 0) == doctest::Approx{7.0});
+    CHECK(decoded(2, 1) == doctest::Approx{8.0});
+    CHECK(decoded(2, 2) == doctest::Approx{9.0});
     CHECK(encoded ==
           "AAAAAAAA8D8AAAAAAAAQQAAAAAAAABxAAAAAAAAAAEAAAAAAAAAUQAAAAAAAACBAAAAAAAAACEAAAAAAAAAYQAAAAAAAACJA");
   }
@@ -73,17 +104,17 @@ TEST_CASE("Coded values test")
     rexsapi::TMatrix<int64_t> matrix{{{1, 2, 3, 4}, {5, 6, 7, 8}}};
     const auto encoded = rexsapi::detail::TCodedValueMatrix<int64_t>::encode(matrix);
     const auto decoded = rexsapi::detail::TCodedValueMatrix<int64_t>::decode(encoded, 4, 2);
-    REQUIRE(decoded.m_Values.size() == 2);
-    REQUIRE(decoded.m_Values[0].size() == 4);
-    CHECK(decoded.m_Values[0][0] == 1);
-    CHECK(decoded.m_Values[0][1] == 2);
-    CHECK(decoded.m_Values[0][2] == 3);
-    CHECK(decoded.m_Values[0][3] == 4);
-    REQUIRE(decoded.m_Values[1].size() == 4);
-    CHECK(decoded.m_Values[1][0] == 5);
-    CHECK(decoded.m_Values[1][1] == 6);
-    CHECK(decoded.m_Values[1][2] == 7);
-    CHECK(decoded.m_Values[1][3] == 8);
+    REQUIRE(decoded.getRowCount() == 2);
+    REQUIRE(decoded.getRow(0).size() == 4);
+    CHECK(decoded(0, 0) == 1);
+    CHECK(decoded(0, 1) == 2);
+    CHECK(decoded(0, 2) == 3);
+    CHECK(decoded(0, 3) == 4);
+    REQUIRE(decoded.getRow(1).size() == 4);
+    CHECK(decoded(1, 0) == 5);
+    CHECK(decoded(1, 1) == 6);
+    CHECK(decoded(1, 2) == 7);
+    CHECK(decoded(1, 3) == 8);
     CHECK(encoded == "AQAAAAAAAAAFAAAAAAAAAAIAAAAAAAAABgAAAAAAAAADAAAAAAAAAAcAAAAAAAAABAAAAAAAAAAIAAAAAAAAAA==");
   }
 
@@ -20,6 +20,7 @@
 #include <iostream>
 #include <limits>
 #include <regex>
+#include <string_view>
 
 #include <doctest.h>
 
@@ -98,6 +99,65 @@ TEST_CASE("Conversion double test")
   }
 }
 
+TEST_CASE("Conversion without exceptions test")
+{
+  SUBCASE("Unsigned integer")
+  {
+    uint64_t value{0};
+    CHECK(rexsapi::tryConvertToUint64("4711", value) == std::errc{});
+    CHECK(value == 4711);
+    CHECK(rexsapi::tryConvertToUint64(" +42", value) == std::errc{});
+    CHECK(value == 42);
+    CHECK(rexsapi::tryConvertToUint64("a4711", value) == std::errc::invalid_argument);
+    CHECK(rexsapi::tryConvertToUint64("4711puschel", value) == std::errc::invalid_argument);
+    CHECK(rexsapi::tryConvertToUint64("-4711", value) == std::errc::invalid_argument);
+    CHECK(rexsapi::tryConvertToUint64("", value) == std::errc::invalid_argument);
+    CHECK(rexsapi::tryConvertToUint64(std::to_string(std::numeric_limits<uint64_t>::max()) + "1", value) ==
+          std::errc::result_out_of_range);
+    CHECK(value == 42);
+  }
+
+  SUBCASE("Integer")
+  {
+    int64_t value{0};
+    CHECK(rexsapi::tryConvertToInt64("-4711", value) == std::errc{});
+    CHECK(value == -4711);
+    CHECK(rexsapi::tryConvertToInt64("\t+4711", value) == std::errc{});
+    CHECK(value == 4711);
+    CHECK(rexsapi::tryConvertToInt64("+-4711", value) == std::errc::invalid_argument);
+    CHECK(rexsapi::tryConvertToInt64("47.11", value) == std::errc::invalid_argument);
+    CHECK(rexsapi::tryConvertToInt64("  ", value) == std::errc::invalid_argument);
+    CHECK(rexsapi::tryConvertToInt64(std::to_string(std::numeric_limits<int64_t>::min()) + "1", value) ==
+          std::errc::result_out_of_range);
+    CHECK(value == 4711);
+  }
+
+  SUBCASE("Double")
+  {
+    double value{0.0};
+    CHECK(rexsapi::tryConvertToDouble("47.11", value) == std::errc{});
+    CHECK(value == doctest::Approx(47.11));
+    CHECK(rexsapi::tryConvertToDouble(" -1.5e-3", value) == std::errc{});
+    CHECK(value == doctest::Approx(-0.0015));
+    CHECK(rexsapi::tryConvertToDouble("+2", value) == std::errc{});
+    CHECK(value == doctest::Approx(2.0));
+    CHECK(rexsapi::tryConvertToDouble("47,11", value) == std::errc::invalid_argument);
+    CHECK(rexsapi::tryConvertToDouble("a47.11", value) == std::errc::invalid_argument);
+    CHECK(rexsapi::tryConvertToDouble("1e", value) == std::errc::invalid_argument);
+    CHECK(rexsapi::tryConvertToDouble("1e999", value) == std::errc::result_out_of_range);
+    CHECK(value == doctest::Approx(2.0));
+  }
+
+  SUBCASE("String view")
+  {
+    const std::string_view s{"123456"};
+    int64_t value{0};
+    CHECK(rexsapi::tryConvertToInt64(s.substr(0, 3), value) == std::errc{});
+    CHECK(value == 123);
+    CHECK(rexsapi::convertToDouble(s.substr(3)) == doctest::Approx(456.0));
+  }
+}
+
 TEST_CASE("Time helper")
 {
   SUBCASE("ISO8601 date")
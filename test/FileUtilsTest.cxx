@@ -19,6 +19,8 @@
 #include <test/TemporaryDirectory.hxx>
 #include <test/TestHelper.hxx>
 
+#include <algorithm>
+
 #include <doctest.h>
 
 TEST_CASE("File utils test")
@@ -61,4 +63,62 @@ TEST_CASE("File utils test")
     CHECK_FALSE(result);
     CHECK(buffer.empty());
   }
+
+  SUBCASE("Map existing file")
+  {
+    const auto buffer = rexsapi::detail::loadFile(result, projectDir() / "models" / "rexs-file.json");
+    const rexsapi::detail::TMappedFile file{projectDir() / "models" / "rexs-file.json"};
+    CHECK(file.isMapped());
+    REQUIRE(file.size() == buffer.size());
+    CHECK(std::equal(buffer.begin(), buffer.end(), file.data()));
+  }
+
+  SUBCASE("Map file for loading")
+  {
+    auto file = rexsapi::detail::mapFile(result, projectDir() / "models" / "rexs-file.json");
+    CHECK(result);
+    REQUIRE(file);
+    CHECK(file->size() > 0);
+
+    // modifications are private to the mapping
+    const auto c = file->data()[0];
+    file->data()[0] = 'x';
+    file.reset();
+    const rexsapi::detail::TMappedFile reloaded{projectDir() / "models" / "rexs-file.json"};
+    CHECK(reloaded.data()[0] == c);
+  }
+
+  SUBCASE("Map non-existing file for loading")
+  {
+    auto file = rexsapi::detail::mapFile(result, tmpDir.getTempDirectoryPath() / "puschel.txt");
+    CHECK_FALSE(result);
+    CHECK_FALSE(file);
+  }
+
+  SUBCASE("Map empty file for loading")
+  {
+    auto path = tmpDir.getTempDirectoryPath() / "test.txt";
+    std::ofstream stream{path};
+    stream.close();
+
+    auto file = rexsapi::detail::mapFile(result, path);
+    CHECK_FALSE(result);
+    CHECK_FALSE(file);
+  }
+
+  SUBCASE("Map empty file")
+  {
+    auto path = tmpDir.getTempDirectoryPath() / "test.txt";
+    std::ofstream stream{path};
+    stream.close();
+
+    const rexsapi::detail::TMappedFile file{path};
+    CHECK(file.size() == 0);
+    CHECK_FALSE(file.isMapped());
+  }
+
+  SUBCASE("Map non-existing file")
+  {
+    CHECK_THROWS(rexsapi::detail::TMappedFile{tmpDir.getTempDirectoryPath() / "puschel.txt"});
+  }
 }
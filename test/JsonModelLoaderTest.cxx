@@ -20,6 +20,9 @@
 #include <test/TestModelHelper.hxx>
 #include <test/TestModelLoader.hxx>
 
+#include <fstream>
+#include <sstream>
+
 #include <doctest.h>
 
 namespace
@@ -218,6 +221,25 @@ namespace
 
     return loader.load(mode, result, registry);
   }
+
+  std::optional<rexsapi::TModel> loadModelStream(rexsapi::TResult& result, std::istream& stream,
+                                                 const rexsapi::database::TModelRegistry& registry,
+                                                 rexsapi::TMode mode = rexsapi::TMode::STRICT_MODE)
+  {
+    static const rexsapi::TFileJsonSchemaLoader schemaLoader{projectDir() / "models" / "rexs-file.json"};
+    static const rexsapi::TJsonSchemaValidator validator{schemaLoader};
+
+    const rexsapi::TJsonModelLoader loader{mode, validator};
+    return loader.load(result, registry, stream);
+  }
+
+  void checkSameResult(const rexsapi::TResult& result, const rexsapi::TResult& expected)
+  {
+    REQUIRE(result.getErrors().size() == expected.getErrors().size());
+    for (size_t n = 0; n < result.getErrors().size(); ++n) {
+      CHECK(result.getErrors()[n].getMessage() == expected.getErrors()[n].getMessage());
+    }
+  }
 }
 
 
@@ -257,6 +279,159 @@ TEST_CASE("Json model loader test")
     REQUIRE(model->getLoadSpectrum().hasAccumulation());
   }
 
+  SUBCASE("Load valid document from stream")
+  {
+    rexsapi::TResult bufferResult;
+    const auto expected = loadModelBuffer(bufferResult, MemModel, registry, rexsapi::TMode::RELAXED_MODE);
+    REQUIRE(expected);
+
+    std::istringstream stream{MemModel};
+    const auto model = loadModelStream(result, stream, registry, rexsapi::TMode::RELAXED_MODE);
+    REQUIRE(model);
+    CHECK_FALSE(result.isCritical());
+    checkSameResult(result, bufferResult);
+    CHECK(model->getInfo().getVersion() == rexsapi::TRexsVersion{1, 5});
+    REQUIRE(model->getComponents().size() == 4);
+    CHECK(model->getComponents()[0].getName() == "Transmission unit");
+    REQUIRE(model->getComponents()[0].getAttributes().size() == 8);
+    REQUIRE(model->getRelations().size() == 2);
+    REQUIRE(model->getLoadSpectrum().getLoadCases().size() == 1);
+    REQUIRE(model->getLoadSpectrum().getLoadCases()[0].getLoadComponents().size() == 2);
+    CHECK(model->getLoadSpectrum().getLoadCases()[0].getLoadComponents()[0].getAttributes().size() == 9);
+    REQUIRE(model->getLoadSpectrum().hasAccumulation());
+  }
+
+  SUBCASE("Load document with trailing version from stream")
+  {
+    rexsapi::TResult bufferResult;
+    const auto expected = loadModelBuffer(bufferResult, MemModel, registry, rexsapi::TMode::RELAXED_MODE);
+    REQUIRE(expected);
+
+    // keys are sorted, so the relations come after the components and the version comes last
+    std::istringstream stream{rexsapi::json::parse(MemModel).dump()};
+    const auto model = loadModelStream(result, stream, registry, rexsapi::TMode::RELAXED_MODE);
+    REQUIRE(model);
+    checkSameResult(result, bufferResult);
+    CHECK(model->getComponents().size() == expected->getComponents().size());
+    CHECK(model->getRelations().size() == expected->getRelations().size());
+    CHECK(model->getLoadSpectrum().getLoadCases().size() == expected->getLoadSpectrum().getLoadCases().size());
+  }
+
+  SUBCASE("Load document with trailing language from stream")
+  {
+    auto doc = rexsapi::ordered_json::parse(MemModel);
+    doc["model"]["applicationLanguage"] = "de";
+    rexsapi::TResult bufferResult;
+    const auto expected = loadModelBuffer(bufferResult, doc.dump(), registry, rexsapi::TMode::RELAXED_MODE);
+    REQUIRE(expected);
+
+    std::istringstream stream{doc.dump()};
+    const auto model = loadModelStream(result, stream, registry, rexsapi::TMode::RELAXED_MODE);
+    REQUIRE(model);
+    checkSameResult(result, bufferResult);
+    CHECK(model->getInfo().getApplicationLanguage() == "de");
+    CHECK(model->getComponents().size() == expected->getComponents().size());
+    REQUIRE(model->getLoadSpectrum().hasAccumulation());
+  }
+
+  SUBCASE("Load complex models from stream")
+  {
+    for (const auto* name : {"FVA-Industriegetriebe_2stufig_1-4.rexsj", "FVA_worm_stage_1-4.rexsj"}) {
+      const auto path = projectDir() / "test" / "example_models" / name;
+      rexsapi::TResult bufferResult;
+      const auto expected = loadModel(bufferResult, path, registry);
+      REQUIRE(expected);
+
+      result.reset();
+      std::ifstream stream{path, std::ios::binary};
+      const auto model = loadModelStream(result, stream, registry);
+      REQUIRE(model);
+      checkSameResult(result, bufferResult);
+      CHECK(model->getComponents().size() == expected->getComponents().size());
+      CHECK(model->getRelations().size() == expected->getRelations().size());
+      CHECK(model->getLoadSpectrum().getLoadCases().size() == expected->getLoadSpectrum().getLoadCases().size());
+    }
+  }
+
+  SUBCASE("Load invalid documents from stream")
+  {
+    std::istringstream missingComponents{R"({
+  "model":{
+    "applicationId":"Bearinx",
+    "applicationVersion":"12.0.8823",
+    "date":"2021-07-01T12:18:38+01:00",
+    "version":"1.4",
+    "relations":[
+    ]}
+  })"};
+    CHECK_FALSE(loadModelStream(result, missingComponents, registry, rexsapi::TMode::RELAXED_MODE));
+    CHECK(result.isCritical());
+
+    result.reset();
+    std::istringstream invalidComponent{R"({
+  "model":{
+    "applicationId":"Bearinx",
+    "applicationVersion":"12.0.8823",
+    "date":"2021-07-01T12:18:38+01:00",
+    "version":"1.4",
+    "relations":[],
+    "components":[{"id": 1, "type": "gear_unit"}]
+  }
+  })"};
+    CHECK_FALSE(loadModelStream(result, invalidComponent, registry, rexsapi::TMode::RELAXED_MODE));
+    CHECK(result.isCritical());
+
+    result.reset();
+    std::istringstream invalidAccumulation{R"({
+  "model":{
+    "applicationId":"Bearinx",
+    "applicationVersion":"12.0.8823",
+    "date":"2021-07-01T12:18:38+01:00",
+    "version":"1.4",
+    "applicationLanguage":"en",
+    "relations":[],
+    "components":[{"id": 1, "type": "gear_unit", "attributes": []}],
+    "load_spectrum":{
+      "id":1,
+      "load_cases":[],
+      "accumulation":{"components":[{"id": "1", "attributes": []}]}
+    }
+  }
+  })"};
+    CHECK_FALSE(loadModelStream(result, invalidAccumulation, registry, rexsapi::TMode::RELAXED_MODE));
+    CHECK(result.isCritical());
+
+    result.reset();
+    std::istringstream invalidArray{R"({
+  "model":{
+    "applicationId":"Bearinx",
+    "applicationVersion":"12.0.8823",
+    "date":"2021-07-01T12:18:38+01:00",
+    "version":"1.4",
+    "applicationLanguage":"en",
+    "relations":[],
+    "components":[{"id": 1, "type": "gear_unit", "attributes": [
+      {"id": "custom_array", "floating_point_array": [1.0, "2.0"]}
+    ]}]
+  }
+  })"};
+    CHECK_FALSE(loadModelStream(result, invalidArray, registry, rexsapi::TMode::RELAXED_MODE));
+    CHECK(result.isCritical());
+    REQUIRE_FALSE(result.getErrors().empty());
+    CHECK(result.getErrors()[0].getMessage() ==
+          "/model/components: /attributes/0/floating_point_array: expected number element");
+
+    result.reset();
+    std::istringstream broken{R"({
+  "model":{
+    "applicationId":"Bearinx",
+    "applicationVersion":"12.0.8823",
+    "date":"2021-07-01T12:18:38+01:00",
+  })"};
+    CHECK_FALSE(loadModelStream(result, broken, registry, rexsapi::TMode::RELAXED_MODE));
+    CHECK(result.isCritical());
+  }
+
   SUBCASE("Load complex model from file in strict mode")
   {
     const auto model =
@@ -532,5 +707,16 @@ TEST_CASE("Json model loader test")
     result.reset();
 
     CHECK_THROWS((void)loadModelBuffer(result, buffer, registry, rexsapi::TMode::STRICT_MODE));
+
+    // loading from a stream behaves the same and does not report the missing database model as a parse error
+    result.reset();
+    std::istringstream relaxedStream{buffer};
+    CHECK(loadModelStream(result, relaxedStream, registry, rexsapi::TMode::RELAXED_MODE));
+    CHECK_FALSE(result.isCritical());
+
+    result.reset();
+    std::istringstream strictStream{buffer};
+    CHECK_THROWS((void)loadModelStream(result, strictStream, registry, rexsapi::TMode::STRICT_MODE));
+    CHECK(result.getErrors().empty());
   }
 }
@@ -25,6 +25,8 @@
 #include <test/TestModel.hxx>
 #include <test/TestModelLoader.hxx>
 
+#include <sstream>
+
 #include <doctest.h>
 
 namespace
@@ -80,6 +82,17 @@ TEST_CASE("Json serialize new model")
     CHECK(roundtripModel.getLoadSpectrum().getAccumulation().getLoadComponents()[0].getLoadAttributes().size() == 2);
   }
 
+  SUBCASE("Serialize model to stream")
+  {
+    const auto model = createModel(dbModel);
+    rexsapi::TJsonStringSerializer stringSerializer;
+    modelSerializer.serialize(model, stringSerializer);
+
+    std::ostringstream stream;
+    modelSerializer.serialize(model, stream);
+    CHECK(stream.str() == stringSerializer.getModel());
+  }
+
   SUBCASE("Serialize model to file")
   {
     const auto registry = createModelRegistry();
@@ -114,6 +127,23 @@ TEST_CASE("Json serialize new model")
     REQUIRE(std::filesystem::exists(guard.getTempDirectoryPath() / "test_model.rexsj"));
   }
 
+  SUBCASE("Serialize model to compressed file with model saver")
+  {
+    TemporaryDirectory guard;
+    rexsapi::TResult result;
+    rexsapi::TModelSaver{}.store(result, createModel(dbModel), guard.getTempDirectoryPath() / "test_model",
+                                 rexsapi::TSaveType::COMPRESSED_JSON);
+    CHECK(result);
+    REQUIRE(std::filesystem::exists(guard.getTempDirectoryPath() / "test_model.rexsz"));
+
+    const rexsapi::TModelLoader loader{projectDir() / "models"};
+    const auto model =
+      loader.load(guard.getTempDirectoryPath() / "test_model.rexsz", result, rexsapi::TMode::STRICT_MODE);
+    CHECK(result);
+    REQUIRE(model);
+    CHECK(model->getComponents().size() == 7);
+  }
+
   SUBCASE("Serialize to non existent directory")
   {
     CHECK_THROWS(rexsapi::TJsonFileSerializer{std::filesystem::path{"puschel"} / "test_model.rexsj"});
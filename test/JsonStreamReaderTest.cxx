@@ -0,0 +1,136 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <rexsapi/JsonStreamReader.hxx>
+
+#include <sstream>
+
+#include <doctest.h>
+
+
+TEST_CASE("Json stream reader test")
+{
+  std::vector<std::pair<size_t, rexsapi::detail::TJsonRecord>> records;
+  std::vector<size_t> ends;
+  std::string version;
+  rexsapi::detail::TJsonStreamReader reader{
+    {"/model/components", "/model/load_spectrum/load_cases"},
+    [&](const rexsapi::detail::TJsonStreamReader& streamReader, size_t container,
+        rexsapi::detail::TJsonRecord& record) {
+      if (const auto* model = streamReader.findOpenValue("/model"); model != nullptr && model->contains("version")) {
+        version = (*model)["version"].get<std::string>();
+      }
+      records.emplace_back(container, std::move(record));
+      return records.size() < 10;
+    },
+    [&](const rexsapi::detail::TJsonStreamReader&, size_t container) {
+      ends.emplace_back(container);
+      return true;
+    }};
+
+  SUBCASE("Read records")
+  {
+    std::istringstream stream{R"({
+      "model": {
+        "version": "1.5",
+        "components": [
+          {"id": 1, "attributes": [{"id": "a", "floating_point_array": [1.0, 2.0, 3.0]}]},
+          {"id": 2, "attributes": []}
+        ],
+        "load_spectrum": {"id": 1, "load_cases": [{"id": 1, "components": []}]},
+        "other": [1, -2, true, null, "text"]
+      }
+    })"};
+
+    const auto doc = reader.read(stream);
+    REQUIRE(doc);
+    CHECK(*doc == rexsapi::json::parse(R"({
+      "model": {
+        "version": "1.5",
+        "components": [],
+        "load_spectrum": {"id": 1, "load_cases": []},
+        "other": [1, -2, true, null, "text"]
+      }
+    })"));
+    CHECK(version == "1.5");
+    REQUIRE(records.size() == 3);
+    CHECK(records[0].first == 0);
+    CHECK(records[0].second.m_Value["id"] == 1);
+    CHECK(records[0].second.m_Value["attributes"][0]["floating_point_array"].is_null());
+    CHECK(records[0].second.m_Errors.empty());
+    auto* array = records[0].second.findArray("/attributes/0");
+    REQUIRE(array != nullptr);
+    CHECK(array->decode({}).first.getValue<rexsapi::TFloatArrayType>() == std::vector<double>{1.0, 2.0, 3.0});
+    CHECK(records[1].first == 0);
+    CHECK(records[1].second.m_Value["id"] == 2);
+    CHECK(records[1].second.m_Arrays.empty());
+    CHECK(records[2].first == 1);
+    CHECK(records[2].second.m_Value["components"].is_array());
+    CHECK(ends == std::vector<size_t>{0, 1});
+  }
+
+  SUBCASE("Read array values")
+  {
+    std::istringstream stream{R"({
+      "model": {
+        "other": {"integer_array": [1, 2]},
+        "load_spectrum": {"id": 1, "load_cases": [{"id": 1, "components": [
+          {"id": 1, "attributes": [{"id": "a", "string_array": ["a"]}]},
+          {"id": 2, "attributes": [
+            {"id": "b", "integer_matrix": [[1, 2], [3, 4]]},
+            {"id": "c", "boolean_array": [true, 1]},
+            {"id": "d", "floating_point_array_coded": {"code": "float64", "value": ""}}
+          ]}
+        ]}]}
+      }
+    })"};
+
+    const auto doc = reader.read(stream);
+    REQUIRE(doc);
+    CHECK((*doc)["model"]["other"]["integer_array"] == rexsapi::json::parse("[1, 2]"));
+    REQUIRE(records.size() == 1);
+    const auto& record = records[0].second;
+    CHECK(record.m_Value["components"][1]["attributes"][1]["boolean_array"].is_null());
+    CHECK(record.m_Value["components"][1]["attributes"][2]["floating_point_array_coded"]["code"] == "float64");
+    REQUIRE(record.m_Arrays.size() == 2);
+    CHECK(record.m_Arrays[0].first == "/components/0/attributes/0");
+    CHECK(record.m_Arrays[0].second.getType() == rexsapi::TValueType::STRING_ARRAY);
+    CHECK(record.m_Arrays[1].first == "/components/1/attributes/0");
+    CHECK(record.m_Arrays[1].second.getType() == rexsapi::TValueType::INTEGER_MATRIX);
+    REQUIRE(record.m_Errors.size() == 1);
+    CHECK(record.m_Errors[0] == "/components/1/attributes/1/boolean_array: expected boolean element");
+  }
+
+  SUBCASE("Stop reading")
+  {
+    std::string document{R"({"model": {"components": [)"};
+    for (int n = 0; n < 20; ++n) {
+      document += n ? ",{}" : "{}";
+    }
+    document += "]}}";
+    std::istringstream stream{document};
+
+    CHECK_FALSE(reader.read(stream));
+    CHECK(records.size() == 10);
+    CHECK(ends.empty());
+  }
+
+  SUBCASE("Read broken document")
+  {
+    std::istringstream stream{R"({"model": {"components": [{"id": 1})"};
+    CHECK_THROWS_AS((void)reader.read(stream), rexsapi::TException);
+  }
+}
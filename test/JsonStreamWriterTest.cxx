@@ -0,0 +1,177 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <rexsapi/JsonModelSerializer.hxx>
+#include <rexsapi/JsonStreamWriter.hxx>
+
+#include <limits>
+#include <sstream>
+
+#include <doctest.h>
+
+
+namespace
+{
+  template<typename TWriter>
+  void writeDocument(TWriter& writer)
+  {
+    writer.startObject();
+    writer.key("model");
+    writer.startObject();
+    writer.key("applicationId");
+    writer.string("Puh \"der\" Bär\\\n\t\x01");
+    writer.key("version");
+    writer.number(15);
+    writer.key("components");
+    writer.startArray();
+    writer.startObject();
+    writer.key("id");
+    writer.number(uint64_t{1});
+    writer.key("attributes");
+    writer.startArray();
+    writer.endArray();
+    writer.key("floating_point");
+    writer.number(47.11);
+    writer.key("integer_value");
+    writer.number(-815);
+    writer.key("boolean");
+    writer.boolean(true);
+    writer.key("empty");
+    writer.startObject();
+    writer.endObject();
+    writer.key("array");
+    writer.startArray();
+    writer.number(1.0);
+    writer.number(2.5e-7);
+    writer.null();
+    writer.endArray();
+    writer.endObject();
+    writer.endArray();
+    writer.endObject();
+    writer.endObject();
+    writer.endDocument();
+  }
+}
+
+TEST_CASE("Json stream writer test")
+{
+  SUBCASE("Write document")
+  {
+    std::ostringstream stream;
+    rexsapi::detail::TJsonStreamWriter writer{stream};
+    writeDocument(writer);
+
+    CHECK(stream.str() == "{\n"
+                          "  \"model\": {\n"
+                          "    \"applicationId\": \"Puh \\\"der\\\" Bär\\\\\\n\\t\\u0001\",\n"
+                          "    \"version\": 15,\n"
+                          "    \"components\": [\n"
+                          "      {\n"
+                          "        \"id\": 1,\n"
+                          "        \"attributes\": [],\n"
+                          "        \"floating_point\": 47.11,\n"
+                          "        \"integer_value\": -815,\n"
+                          "        \"boolean\": true,\n"
+                          "        \"empty\": {},\n"
+                          "        \"array\": [\n"
+                          "          1.0,\n"
+                          "          2.5e-07,\n"
+                          "          null\n"
+                          "        ]\n"
+                          "      }\n"
+                          "    ]\n"
+                          "  }\n"
+                          "}");
+  }
+
+  SUBCASE("Same output as nlohmann")
+  {
+    for (int indent : {-1, 0, 2, 4}) {
+      rexsapi::ordered_json doc;
+      rexsapi::detail::TJsonDocumentWriter documentWriter{doc};
+      writeDocument(documentWriter);
+
+      std::ostringstream stream;
+      rexsapi::detail::TJsonStreamWriter writer{stream, indent, 16};
+      writeDocument(writer);
+
+      CHECK(stream.str() == doc.dump(indent));
+    }
+  }
+
+  SUBCASE("UTF-8 strings")
+  {
+    for (const auto* value : {"\xc3\xa4", "\xe2\x82\xac", "\xed\x9f\xbf", "\xf0\x9f\x98\x80", "\xf4\x8f\xbf\xbf"}) {
+      rexsapi::ordered_json doc;
+      rexsapi::detail::TJsonDocumentWriter documentWriter{doc};
+      documentWriter.string(value);
+
+      std::ostringstream stream;
+      rexsapi::detail::TJsonStreamWriter writer{stream};
+      writer.string(value);
+      writer.endDocument();
+
+      CHECK(stream.str() == doc.dump());
+    }
+
+    for (const auto* value : {"\xff", "a\x80", "\xc0\xaf", "\xe0\x80\xaf", "\xed\xa0\x80", "\xf4\x90\x80\x80", "\xc3",
+                              "\xe2\x82"}) {
+      rexsapi::ordered_json doc;
+      rexsapi::detail::TJsonDocumentWriter documentWriter{doc};
+      documentWriter.string(value);
+      CHECK_THROWS(doc.dump());
+
+      std::ostringstream stream;
+      rexsapi::detail::TJsonStreamWriter writer{stream};
+      CHECK_THROWS_AS(writer.string(value), rexsapi::TException);
+    }
+
+    std::ostringstream stream;
+    rexsapi::detail::TJsonStreamWriter writer{stream};
+    writer.startObject();
+    CHECK_THROWS_WITH(writer.key("ab\xe2\x28\xa1"), "invalid UTF-8 byte at index 3: 0x28");
+    CHECK_THROWS_WITH(writer.key("ab\xe2\x82"), "incomplete UTF-8 string; last byte: 0x82");
+  }
+
+  SUBCASE("Non finite numbers")
+  {
+    std::ostringstream stream;
+    rexsapi::detail::TJsonStreamWriter writer{stream, -1};
+    writer.startArray();
+    writer.number(std::numeric_limits<double>::quiet_NaN());
+    writer.number(std::numeric_limits<double>::infinity());
+    writer.endArray();
+    writer.endDocument();
+    CHECK(stream.str() == "[null,null]");
+  }
+
+  SUBCASE("Invalid calls")
+  {
+    std::ostringstream stream;
+    rexsapi::detail::TJsonStreamWriter writer{stream};
+    CHECK_THROWS_WITH(writer.key("model"), "cannot write key 'model' outside of an object");
+    CHECK_THROWS_WITH(writer.endObject(), "cannot close '}' without matching open");
+    writer.startObject();
+    CHECK_THROWS_WITH(writer.string("puh"), "cannot write object member without key");
+    CHECK_THROWS_WITH(writer.endArray(), "cannot close ']' without matching open");
+    writer.key("model");
+    CHECK_THROWS_WITH(writer.key("info"), "cannot write key 'info' outside of an object");
+    CHECK_THROWS_WITH(writer.endObject(), "cannot close '}' without matching open");
+    writer.startArray();
+    CHECK_THROWS_WITH(writer.key("info"), "cannot write key 'info' outside of an object");
+    CHECK_THROWS_WITH(writer.endDocument(), "cannot end document with open object or array");
+  }
+}
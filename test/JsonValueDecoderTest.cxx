@@ -26,6 +26,32 @@ namespace
   {
     return doc[rexsapi::json::json_pointer("/" + type)];
   }
+
+  void feed(rexsapi::detail::TJsonArrayValue& array, const rexsapi::json& node)
+  {
+    if (node.is_array()) {
+      array.startArray();
+      for (const auto& element : node) {
+        feed(array, element);
+      }
+      array.end();
+    } else if (node.is_object()) {
+      array.startObject();
+      for (const auto& [_, element] : node.items()) {
+        feed(array, element);
+      }
+      array.end();
+    } else {
+      array.add(rexsapi::json(node));
+    }
+  }
+
+  rexsapi::detail::TJsonArrayValue createArray(rexsapi::TValueType type, const std::string& value)
+  {
+    rexsapi::detail::TJsonArrayValue array{type};
+    feed(array, rexsapi::json::parse(value));
+    return array;
+  }
 }
 
 TEST_CASE("Json value decoder test")
@@ -228,8 +254,8 @@ TEST_CASE("Json value decoder test")
     const auto [value, result] =
       decoder.decode(rexsapi::TValueType::FLOATING_POINT_MATRIX, enumValue, getNode(doc, "float matrix"));
     CHECK(result == rexsapi::detail::TDecoderResult::SUCCESS);
-    CHECK(value.getValue<rexsapi::TMatrix<double>>().m_Values.size() == 3);
-    for (const auto& row : value.getValue<rexsapi::TMatrix<double>>().m_Values) {
+    CHECK(value.getValue<rexsapi::TMatrix<double>>().getRowCount() == 3);
+    for (const auto& row : value.getValue<rexsapi::TMatrix<double>>().getRows()) {
       CHECK(row.size() == 3);
     }
   }
@@ -239,8 +265,8 @@ TEST_CASE("Json value decoder test")
     const auto [value, result] =
       decoder.decode(rexsapi::TValueType::FLOATING_POINT_MATRIX, enumValue, getNode(doc, "coded float matrix"));
     CHECK(result == rexsapi::detail::TDecoderResult::SUCCESS);
-    CHECK(value.getValue<rexsapi::TMatrix<double>>().m_Values.size() == 3);
-    for (const auto& row : value.getValue<rexsapi::TMatrix<double>>().m_Values) {
+    CHECK(value.getValue<rexsapi::TMatrix<double>>().getRowCount() == 3);
+    for (const auto& row : value.getValue<rexsapi::TMatrix<double>>().getRows()) {
       CHECK(row.size() == 3);
     }
   }
@@ -250,8 +276,8 @@ TEST_CASE("Json value decoder test")
     const auto [value, result] =
       decoder.decode(rexsapi::TValueType::FLOATING_POINT_MATRIX, enumValue, getNode(doc, "coded float32 matrix"));
     CHECK(result == rexsapi::detail::TDecoderResult::SUCCESS);
-    CHECK(value.getValue<rexsapi::TMatrix<double>>().m_Values.size() == 3);
-    for (const auto& row : value.getValue<rexsapi::TMatrix<double>>().m_Values) {
+    CHECK(value.getValue<rexsapi::TMatrix<double>>().getRowCount() == 3);
+    for (const auto& row : value.getValue<rexsapi::TMatrix<double>>().getRows()) {
       CHECK(row.size() == 3);
     }
   }
@@ -261,8 +287,8 @@ TEST_CASE("Json value decoder test")
     const auto [value, result] =
       decoder.decode(rexsapi::TValueType::STRING_MATRIX, enumValue, getNode(doc, "string matrix"));
     CHECK(result == rexsapi::detail::TDecoderResult::SUCCESS);
-    CHECK(value.getValue<rexsapi::TMatrix<std::string>>().m_Values.size() == 3);
-    for (const auto& row : value.getValue<rexsapi::TMatrix<std::string>>().m_Values) {
+    CHECK(value.getValue<rexsapi::TMatrix<std::string>>().getRowCount() == 3);
+    for (const auto& row : value.getValue<rexsapi::TMatrix<std::string>>().getRows()) {
       CHECK(row.size() == 2);
     }
   }
@@ -425,3 +451,109 @@ TEST_CASE("Json value decoder error test")
         .second == rexsapi::detail::TDecoderResult::FAILURE);
   }
 }
+
+TEST_CASE("Json array value test")
+{
+  rexsapi::detail::TJsonValueDecoder decoder;
+  std::optional<rexsapi::database::TEnumValues> enumValue;
+
+  SUBCASE("Type from key")
+  {
+    CHECK(rexsapi::detail::TJsonArrayValue::typeFromKey("floating_point_array") ==
+          rexsapi::TValueType::FLOATING_POINT_ARRAY);
+    CHECK(rexsapi::detail::TJsonArrayValue::typeFromKey("array_of_integer_arrays") ==
+          rexsapi::TValueType::ARRAY_OF_INTEGER_ARRAYS);
+    CHECK_FALSE(rexsapi::detail::TJsonArrayValue::typeFromKey("floating_point_array_coded"));
+    CHECK_FALSE(rexsapi::detail::TJsonArrayValue::typeFromKey("floating_point"));
+    CHECK_THROWS_AS(rexsapi::detail::TJsonArrayValue{rexsapi::TValueType::INTEGER}, rexsapi::TException);
+  }
+
+  SUBCASE("Decode arrays")
+  {
+    auto array = createArray(rexsapi::TValueType::FLOATING_POINT_ARRAY, "[1.0, 2, 3.5]");
+    REQUIRE(array.isComplete());
+    auto [value, result] = decoder.decode(rexsapi::TValueType::FLOATING_POINT_ARRAY, enumValue, array);
+    CHECK(result == rexsapi::detail::TDecoderResult::SUCCESS);
+    CHECK(value.getValue<rexsapi::TFloatArrayType>() == std::vector<double>{1.0, 2.0, 3.5});
+
+    array = createArray(rexsapi::TValueType::INTEGER_ARRAY, "[1, 2, 3]");
+    std::tie(value, result) = decoder.decode(rexsapi::TValueType::INTEGER_ARRAY, enumValue, array);
+    CHECK(value.getValue<rexsapi::TIntArrayType>() == std::vector<int64_t>{1, 2, 3});
+
+    array = createArray(rexsapi::TValueType::BOOLEAN_ARRAY, "[true, false]");
+    std::tie(value, result) = decoder.decode(rexsapi::TValueType::BOOLEAN_ARRAY, enumValue, array);
+    CHECK(value.getValue<rexsapi::TBoolArrayType>() == std::vector<rexsapi::Bool>{true, false});
+
+    array = createArray(rexsapi::TValueType::STRING_ARRAY, "[]");
+    std::tie(value, result) = decoder.decode(rexsapi::TValueType::STRING_ARRAY, enumValue, array);
+    CHECK(result == rexsapi::detail::TDecoderResult::SUCCESS);
+    CHECK(value.getValue<rexsapi::TStringArrayType>().empty());
+  }
+
+  SUBCASE("Decode matrices")
+  {
+    auto array = createArray(rexsapi::TValueType::FLOATING_POINT_MATRIX, "[[1.1, 1.2], [2.1, 2.2], [3.1, 3.2]]");
+    auto [value, result] = decoder.decode(rexsapi::TValueType::FLOATING_POINT_MATRIX, enumValue, array);
+    CHECK(result == rexsapi::detail::TDecoderResult::SUCCESS);
+    const auto& matrix = value.getValue<rexsapi::TFloatMatrixType>();
+    CHECK(matrix.getRowCount() == 3);
+    CHECK(matrix.getColumnCount() == 2);
+    CHECK(matrix(2, 1) == doctest::Approx(3.2));
+
+    array = createArray(rexsapi::TValueType::STRING_MATRIX, R"([["a", "b"], ["c"]])");
+    CHECK(array.isComplete());
+    CHECK_FALSE(array.getError());
+    CHECK(decoder.decode(rexsapi::TValueType::STRING_MATRIX, enumValue, array).second ==
+          rexsapi::detail::TDecoderResult::FAILURE);
+
+    array = createArray(rexsapi::TValueType::ARRAY_OF_INTEGER_ARRAYS, "[[1, 1, 1], [2, 2], [], [3]]");
+    std::tie(value, result) = decoder.decode(rexsapi::TValueType::ARRAY_OF_INTEGER_ARRAYS, enumValue, array);
+    CHECK(result == rexsapi::detail::TDecoderResult::SUCCESS);
+    CHECK(value.getValue<rexsapi::TArrayOfIntArraysType>() ==
+          std::vector<std::vector<int64_t>>{{1, 1, 1}, {2, 2}, {}, {3}});
+  }
+
+  SUBCASE("Decode enum array")
+  {
+    auto array = createArray(rexsapi::TValueType::ENUM_ARRAY, R"(["a", "b"])");
+    CHECK(decoder.decode(rexsapi::TValueType::ENUM_ARRAY, enumValue, array).second ==
+          rexsapi::detail::TDecoderResult::FAILURE);
+
+    enumValue = rexsapi::database::TEnumValues{{rexsapi::database::TEnumValue{"a", "A"}}};
+    array = createArray(rexsapi::TValueType::ENUM_ARRAY, R"(["a", "a"])");
+    CHECK(decoder.decode(rexsapi::TValueType::ENUM_ARRAY, enumValue, array).second ==
+          rexsapi::detail::TDecoderResult::SUCCESS);
+    array = createArray(rexsapi::TValueType::ENUM_ARRAY, R"(["a", "b"])");
+    CHECK(decoder.decode(rexsapi::TValueType::ENUM_ARRAY, enumValue, array).second ==
+          rexsapi::detail::TDecoderResult::FAILURE);
+  }
+
+  SUBCASE("Wrong type")
+  {
+    auto array = createArray(rexsapi::TValueType::INTEGER_ARRAY, "[1, 2, 3]");
+    CHECK(decoder.decode(rexsapi::TValueType::FLOATING_POINT_ARRAY, enumValue, array).second ==
+          rexsapi::detail::TDecoderResult::WRONG_TYPE);
+  }
+
+  SUBCASE("Invalid elements")
+  {
+    const std::vector<std::tuple<rexsapi::TValueType, std::string, std::string>> invalid{
+      {rexsapi::TValueType::FLOATING_POINT_ARRAY, R"([1.0, "2.0"])", "expected number element"},
+      {rexsapi::TValueType::INTEGER_ARRAY, "[1, 2.5]", "expected integer element"},
+      {rexsapi::TValueType::BOOLEAN_ARRAY, "[true, 0]", "expected boolean element"},
+      {rexsapi::TValueType::STRING_ARRAY, R"(["a", null])", "expected string element"},
+      {rexsapi::TValueType::STRING_ARRAY, R"([["a"]])", "unexpected array element"},
+      {rexsapi::TValueType::INTEGER_ARRAY, R"([{"a": 1}])", "unexpected object element"},
+      {rexsapi::TValueType::INTEGER_MATRIX, "[1, 2]", "expected array element"},
+      {rexsapi::TValueType::INTEGER_MATRIX, "[[1], [[2]]]", "unexpected array element"},
+      {rexsapi::TValueType::ARRAY_OF_INTEGER_ARRAYS, "[[1], [true]]", "expected integer element"}};
+
+    for (const auto& [type, value, error] : invalid) {
+      auto array = createArray(type, value);
+      CHECK(array.isComplete());
+      REQUIRE(array.getError());
+      CHECK(*array.getError() == error);
+      CHECK(decoder.decode(type, enumValue, array).second == rexsapi::detail::TDecoderResult::FAILURE);
+    }
+  }
+}
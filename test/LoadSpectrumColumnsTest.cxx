@@ -0,0 +1,120 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <rexsapi/LoadSpectrumColumns.hxx>
+
+#include <test/TestModelLoader.hxx>
+
+#include <cmath>
+
+#include <doctest.h>
+
+TEST_CASE("Load spectrum columns test")
+{
+  const auto& dbModel = loadModel("1.4");
+
+  rexsapi::TComponents components;
+  const auto& gearCasingComponent = dbModel.findComponentById("gear_casing");
+  rexsapi::TAttributes attributes;
+  attributes.emplace_back(
+    rexsapi::TAttribute{gearCasingComponent.findAttributeById("temperature_lubricant"), rexsapi::TValue{73.2}});
+  components.emplace_back(rexsapi::TComponent{1, gearCasingComponent, "Gehäuse", std::move(attributes)});
+
+  const auto& lubricantComponent = dbModel.findComponentById("lubricant");
+  components.emplace_back(rexsapi::TComponent{2, lubricantComponent, "S2/220", rexsapi::TAttributes{}});
+
+  auto createLoadCase = [&](double temperature, std::optional<int64_t> cycles) {
+    rexsapi::TLoadComponents loadComponents;
+    rexsapi::TAttributes loadAttributes;
+    loadAttributes.emplace_back(rexsapi::TAttribute{
+      gearCasingComponent.findAttributeById("mean_operating_temperature"), rexsapi::TValue{temperature}});
+    loadAttributes.emplace_back(rexsapi::TAttribute{"custom_name", rexsapi::TUnit{""}, rexsapi::TValueType::STRING,
+                                                    rexsapi::TValue{"load case"}});
+    if (cycles) {
+      loadAttributes.emplace_back(rexsapi::TAttribute{"custom_cycles", rexsapi::TUnit{""}, rexsapi::TValueType::INTEGER,
+                                                      rexsapi::TValue{*cycles}});
+    }
+    loadComponents.emplace_back(rexsapi::TLoadComponent{components[0], std::move(loadAttributes)});
+
+    loadAttributes = rexsapi::TAttributes{};
+    loadAttributes.emplace_back(rexsapi::TAttribute{
+      lubricantComponent.findAttributeById("viscosity_at_100_degree_celsius"), rexsapi::TValue{temperature / 10.0}});
+    loadComponents.emplace_back(rexsapi::TLoadComponent{components[1], std::move(loadAttributes)});
+    return rexsapi::TLoadCase{std::move(loadComponents)};
+  };
+
+  SUBCASE("Create from load spectrum")
+  {
+    rexsapi::TLoadCases loadCases;
+    loadCases.emplace_back(createLoadCase(55.5, 1000));
+    loadCases.emplace_back(createLoadCase(60.5, std::nullopt));
+    loadCases.emplace_back(createLoadCase(65.5, 3000));
+    const rexsapi::TLoadSpectrum loadSpectrum{std::move(loadCases), std::nullopt};
+
+    const rexsapi::TLoadSpectrumColumns columns{loadSpectrum};
+    CHECK(columns.getLoadCaseCount() == 3);
+    CHECK(columns.getColumnCount() == 3);
+    CHECK_FALSE(columns.hasColumn(1, "custom_name"));
+    CHECK_FALSE(columns.hasColumn(1, "temperature_lubricant"));
+    CHECK_FALSE(columns.hasColumn(2, "mean_operating_temperature"));
+    CHECK_THROWS_WITH((void)columns.getColumn(3, "mean_operating_temperature"),
+                      "no load spectrum column for component id=3 attribute id=mean_operating_temperature");
+
+    REQUIRE(columns.hasColumn(1, "mean_operating_temperature"));
+    const auto& temperature = columns.getColumn(1, "mean_operating_temperature");
+    CHECK(temperature.getValueType() == rexsapi::TValueType::FLOATING_POINT);
+    REQUIRE(temperature.size() == 3);
+    CHECK(temperature.getValues<rexsapi::TFloatType>() == std::vector<double>{55.5, 60.5, 65.5});
+    CHECK_THROWS((void)temperature.getValues<rexsapi::TIntType>());
+
+    const auto& viscosity = columns.getColumn(2, "viscosity_at_100_degree_celsius");
+    CHECK(viscosity.getValues<rexsapi::TFloatType>()[2] == doctest::Approx(6.55));
+
+    const auto& cycles = columns.getColumn(1, "custom_cycles");
+    CHECK(cycles.getValueType() == rexsapi::TValueType::INTEGER);
+    CHECK(cycles.hasValue(0));
+    CHECK_FALSE(cycles.hasValue(1));
+    CHECK(cycles.hasValue(2));
+    CHECK(cycles.getValues<rexsapi::TIntType>() == std::vector<int64_t>{1000, 0, 3000});
+  }
+
+  SUBCASE("Missing floating point values")
+  {
+    rexsapi::TLoadCases loadCases;
+    loadCases.emplace_back(createLoadCase(55.5, std::nullopt));
+    loadCases.emplace_back(rexsapi::TLoadCase{rexsapi::TLoadComponents{}});
+    const rexsapi::TLoadSpectrumColumns columns{rexsapi::TLoadSpectrum{std::move(loadCases), std::nullopt}};
+
+    const auto& temperature = columns.getColumn(1, "mean_operating_temperature");
+    REQUIRE(temperature.size() == 2);
+    CHECK(temperature.hasValue(0));
+    CHECK_FALSE(temperature.hasValue(1));
+    CHECK(std::isnan(temperature.getValues<rexsapi::TFloatType>()[1]));
+  }
+
+  SUBCASE("Empty load spectrum")
+  {
+    const rexsapi::TLoadSpectrumColumns columns{rexsapi::TLoadSpectrum{rexsapi::TLoadCases{}, std::nullopt}};
+    CHECK(columns.getLoadCaseCount() == 0);
+    CHECK(columns.getColumnCount() == 0);
+  }
+
+  SUBCASE("Unsupported value type")
+  {
+    CHECK_THROWS_WITH(rexsapi::TLoadSpectrumColumn(rexsapi::TValueType::STRING, 1),
+                      "value type string not supported for load spectrum columns");
+  }
+}
@@ -70,6 +70,23 @@ TEST_CASE("Load spectrum test")
     CHECK(loadCase.getLoadComponents()[1].getComponent().getAttributes().size() == 2);
     CHECK(loadCase.getLoadComponents()[1].getLoadAttributes().size() == 1);
 
+    const auto& loadComponent = loadCase.getLoadComponents()[0];
+    CHECK(&loadComponent.getComponent().getAttributes() == &components[0].getAttributes());
+    const auto merged = loadComponent.getAttributes();
+    REQUIRE(merged.size() == 4);
+    CHECK(merged[0].getAttributeId() == "mass_of_component");
+    CHECK(merged[1].getAttributeId() == "mean_operating_temperature");
+    CHECK(merged[2].getAttributeId() == "temperature_lubricant");
+    CHECK(merged[3].getAttributeId() == "type_of_gear_casing_construction_vdi_2736_2014");
+    CHECK(&merged[1] == &loadComponent.getLoadAttributes()[1]);
+    CHECK(&merged[2] == &components[0].getAttributes()[0]);
+    std::vector<std::string> ids;
+    for (const auto& attribute : merged) {
+      ids.emplace_back(attribute.getAttributeId());
+    }
+    CHECK(ids == std::vector<std::string>{"mass_of_component", "mean_operating_temperature", "temperature_lubricant",
+                                          "type_of_gear_casing_construction_vdi_2736_2014"});
+
     rexsapi::TLoadComponents accumulationComponents;
     loadAttributes = rexsapi::TAttributes{};
     loadAttributes.emplace_back(
@@ -154,6 +154,30 @@ TEST_CASE("Component mapping test")
 
     CHECK_FALSE(mapping.getComponent(45, components));
   }
+
+  SUBCASE("Get id with components not in mapping order")
+  {
+    rexsapi::detail::ComponentMapping mapping;
+    auto component1Id = mapping.addComponent(42);
+    mapping.addComponent(43);
+    auto component3Id = mapping.addComponent(44);
+
+    rexsapi::TAttributes attributes;
+    rexsapi::TComponents components;
+    components.emplace_back(
+      rexsapi::TComponent{component3Id, dbModel.findComponentById("material"), "Component 3", attributes});
+    components.emplace_back(
+      rexsapi::TComponent{component1Id, dbModel.findComponentById("gear_unit"), "Component 1", attributes});
+
+    auto component = mapping.getComponent(42, components);
+    REQUIRE(component);
+    CHECK(component->getInternalId() == component1Id);
+    component = mapping.getComponent(44, components);
+    REQUIRE(component);
+    CHECK(component->getInternalId() == component3Id);
+
+    CHECK_FALSE(mapping.getComponent(43, components));
+  }
 }
 
 TEST_CASE("Component post processor test")
@@ -0,0 +1,96 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <rexsapi/ModelIndex.hxx>
+
+#include <test/TestModel.hxx>
+#include <test/TestModelLoader.hxx>
+
+#include <doctest.h>
+
+
+TEST_CASE("Model index test")
+{
+  const auto& dbModel = loadModel("1.4");
+  const auto model = createModel(dbModel);
+  const rexsapi::TModelIndex index{model};
+
+  SUBCASE("Components by id")
+  {
+    const auto* component = index.findComponentByInternalId(2);
+    REQUIRE(component != nullptr);
+    CHECK(component == &model.getComponents()[1]);
+    CHECK(component->getType() == "coupling");
+    CHECK(index.findComponentByInternalId(4711) == nullptr);
+    CHECK(index.findComponentByExternalId(2) == nullptr);
+  }
+
+  SUBCASE("Components by external id")
+  {
+    const auto& dbComponent = dbModel.findComponentById("gear_unit");
+    rexsapi::TComponents components;
+    components.emplace_back(rexsapi::TComponent{100, 1, dbComponent, "Getriebe 1", {}});
+    components.emplace_back(rexsapi::TComponent{200, 2, dbComponent, "Getriebe 2", {}});
+    const rexsapi::TModel externalModel{model.getInfo(), std::move(components), {},
+                                        rexsapi::TLoadSpectrum{{}, std::nullopt}};
+    const rexsapi::TModelIndex externalIndex{externalModel};
+
+    REQUIRE(externalIndex.findComponentByExternalId(200) != nullptr);
+    CHECK(externalIndex.findComponentByExternalId(200)->getName() == "Getriebe 2");
+    CHECK(externalIndex.findComponentByExternalId(2) == nullptr);
+    CHECK(externalIndex.findComponentByInternalId(2) == externalIndex.findComponentByExternalId(200));
+  }
+
+  SUBCASE("Components by type")
+  {
+    const auto& assemblies = index.findComponentsByType("assembly_group");
+    REQUIRE(assemblies.size() == 2);
+    CHECK(assemblies[0].get().getInternalId() == 6);
+    CHECK(assemblies[1].get().getInternalId() == 7);
+    CHECK(index.findComponentsByType("coupling").size() == 1);
+    CHECK(index.findComponentsByType("gear_casing").empty());
+  }
+
+  SUBCASE("Attributes by id")
+  {
+    const auto& stiffness = index.findAttributesById("reduced_static_stiffness_matrix");
+    REQUIRE(stiffness.size() == 2);
+    CHECK(stiffness[0].m_Component.get().getInternalId() == 6);
+    CHECK(&stiffness[0].m_Attribute.get() == &model.getComponents()[5].getAttributes()[2]);
+    CHECK(stiffness[1].m_Component.get().getInternalId() == 7);
+    CHECK(stiffness[1].m_Attribute.get().getValue().coded() == rexsapi::TCodeType::Optimized);
+
+    const auto& custom = index.findAttributesById("custom_boolean_matrix");
+    REQUIRE(custom.size() == 1);
+    CHECK(custom[0].m_Component.get().getInternalId() == 7);
+
+    CHECK(index.findAttributesById("gravitational_acceleration").empty());
+  }
+
+  SUBCASE("Relations by component")
+  {
+    const auto& relations = index.findRelationsByComponent(1);
+    REQUIRE(relations.size() == 1);
+    CHECK(relations[0].get().getType() == rexsapi::TRelationType::ASSEMBLY);
+    CHECK(&relations[0].get() == &model.getRelations()[0]);
+
+    CHECK(index.findRelationsByComponent(6, rexsapi::TRelationRole::WORKPIECE).size() == 1);
+    CHECK(index.findRelationsByComponent(6, rexsapi::TRelationRole::TOOL).empty());
+    CHECK(index.findRelationsByComponent(2, rexsapi::TRelationRole::PART).size() == 1);
+    CHECK(index.findRelationsByComponent(4711).empty());
+    CHECK(index.findRelationsByComponent(4711, rexsapi::TRelationRole::PART).empty());
+  }
+}
@@ -20,6 +20,9 @@
 #include <test/TestModelHelper.hxx>
 #include <test/TestModelLoader.hxx>
 
+#include <set>
+#include <thread>
+
 #include <doctest.h>
 
 
@@ -147,3 +150,107 @@ TEST_CASE("Model loader test")
     CHECK_FALSE(model);
   }
 }
+
+
+TEST_CASE("Model loader concurrency test")
+{
+  const rexsapi::TModelLoader loader{projectDir() / "models"};
+  const std::vector<std::filesystem::path> files{
+    projectDir() / "test" / "example_models" / "FVA-Industriegetriebe_2stufig_1-4.rexs",
+    projectDir() / "test" / "example_models" / "FVA-Industriegetriebe_2stufig_1-4.rexsj",
+    projectDir() / "test" / "example_models" / "example_json.rexs.zip",
+    projectDir() / "test" / "example_models" / "example_xml.rexs.zip"};
+
+  struct TOutcome {
+    bool m_Success{false};
+    size_t m_Components{0};
+    std::vector<std::string> m_Errors{};
+    std::vector<uint64_t> m_InternalIds{};
+  };
+
+  const auto loadModel = [&loader](const std::filesystem::path& path) {
+    TOutcome outcome;
+    rexsapi::TResult result;
+    const auto model = loader.load(path, result, rexsapi::TMode::STRICT_MODE);
+    outcome.m_Success = static_cast<bool>(result);
+    for (const auto& error : result.getErrors()) {
+      outcome.m_Errors.emplace_back(error.getMessage());
+    }
+    if (model) {
+      outcome.m_Components = model->getComponents().size();
+      for (const auto& component : model->getComponents()) {
+        outcome.m_InternalIds.emplace_back(component.getInternalId());
+      }
+    }
+    return outcome;
+  };
+
+  std::vector<TOutcome> expected;
+  for (const auto& file : files) {
+    expected.emplace_back(loadModel(file));
+    REQUIRE(expected.back().m_Components > 0);
+  }
+
+  SUBCASE("Load models concurrently")
+  {
+    const size_t threadCount = 8;
+    const size_t loadsPerThread = 4;
+    std::vector<std::vector<TOutcome>> outcomes(threadCount);
+    std::vector<std::thread> threads;
+    for (size_t n = 0; n < threadCount; ++n) {
+      threads.emplace_back([&, n] {
+        for (size_t i = 0; i < loadsPerThread; ++i) {
+          outcomes[n].emplace_back(loadModel(files[(n + i) % files.size()]));
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    std::set<uint64_t> internalIds;
+    for (const auto& outcome : expected) {
+      internalIds.insert(outcome.m_InternalIds.begin(), outcome.m_InternalIds.end());
+    }
+    size_t idCount = internalIds.size();
+    for (size_t n = 0; n < threadCount; ++n) {
+      REQUIRE(outcomes[n].size() == loadsPerThread);
+      for (size_t i = 0; i < loadsPerThread; ++i) {
+        const auto& outcome = outcomes[n][i];
+        const auto& reference = expected[(n + i) % files.size()];
+        CHECK(outcome.m_Success == reference.m_Success);
+        CHECK(outcome.m_Components == reference.m_Components);
+        CHECK(outcome.m_Errors == reference.m_Errors);
+        internalIds.insert(outcome.m_InternalIds.begin(), outcome.m_InternalIds.end());
+        idCount += outcome.m_InternalIds.size();
+      }
+    }
+    CHECK(internalIds.size() == idCount);
+  }
+
+  SUBCASE("Load all models")
+  {
+    std::vector<std::filesystem::path> paths;
+    for (size_t n = 0; n < 5; ++n) {
+      paths.insert(paths.end(), files.begin(), files.end());
+    }
+    paths.emplace_back(projectDir() / "test" / "example_models" / "non-existent-model.rexsj");
+
+    for (const auto threads : {size_t{0}, size_t{1}, size_t{3}}) {
+      const auto models = loader.loadAll(paths, rexsapi::TMode::STRICT_MODE, threads);
+      REQUIRE(models.size() == paths.size());
+      for (size_t n = 0; n < files.size() * 5; ++n) {
+        const auto& [model, result] = models[n];
+        const auto& reference = expected[n % files.size()];
+        REQUIRE(model);
+        CHECK(static_cast<bool>(result) == reference.m_Success);
+        CHECK(model->getComponents().size() == reference.m_Components);
+        CHECK(result.getErrors().size() == reference.m_Errors.size());
+      }
+      CHECK_FALSE(models.back().first);
+      CHECK(models.back().second.isCritical());
+    }
+
+    CHECK(loader.loadAll({}).empty());
+  }
+}
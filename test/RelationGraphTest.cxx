@@ -0,0 +1,151 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <rexsapi/RelationGraph.hxx>
+
+#include <test/TestModelLoader.hxx>
+
+#include <doctest.h>
+
+namespace
+{
+  std::vector<uint64_t> toIds(const std::vector<std::reference_wrapper<const rexsapi::TComponent>>& components)
+  {
+    std::vector<uint64_t> ids;
+    for (const auto& component : components) {
+      ids.emplace_back(component.get().getInternalId());
+    }
+    return ids;
+  }
+
+  rexsapi::TModel createGearModel(const rexsapi::database::TModel& dbModel)
+  {
+    rexsapi::TComponents components;
+    components.emplace_back(rexsapi::TComponent{1, dbModel.findComponentById("gear_unit"), "Getriebe", {}});
+    components.emplace_back(rexsapi::TComponent{2, dbModel.findComponentById("shaft"), "Welle 1", {}});
+    components.emplace_back(rexsapi::TComponent{3, dbModel.findComponentById("shaft"), "Welle 2", {}});
+    components.emplace_back(rexsapi::TComponent{4, dbModel.findComponentById("cylindrical_gear"), "Rad 1", {}});
+    components.emplace_back(rexsapi::TComponent{5, dbModel.findComponentById("cylindrical_gear"), "Rad 2", {}});
+    components.emplace_back(rexsapi::TComponent{6, dbModel.findComponentById("cylindrical_stage"), "Stufe", {}});
+    components.emplace_back(rexsapi::TComponent{7, dbModel.findComponentById("concept_bearing"), "Lager", {}});
+
+    auto createRelation = [&components](rexsapi::TRelationType type, rexsapi::TRelationRole role1, size_t component1,
+                                        rexsapi::TRelationRole role2, size_t component2) {
+      return rexsapi::TRelation{type, {},
+                                rexsapi::TRelationReferences{
+                                  rexsapi::TRelationReference{role1, "", components[component1 - 1]},
+                                  rexsapi::TRelationReference{role2, "", components[component2 - 1]}}};
+    };
+
+    rexsapi::TRelations relations;
+    relations.emplace_back(createRelation(rexsapi::TRelationType::ASSEMBLY, rexsapi::TRelationRole::ASSEMBLY, 1,
+                                          rexsapi::TRelationRole::PART, 2));
+    relations.emplace_back(createRelation(rexsapi::TRelationType::ASSEMBLY, rexsapi::TRelationRole::ASSEMBLY, 1,
+                                          rexsapi::TRelationRole::PART, 3));
+    relations.emplace_back(createRelation(rexsapi::TRelationType::ASSEMBLY, rexsapi::TRelationRole::ASSEMBLY, 2,
+                                          rexsapi::TRelationRole::PART, 4));
+    relations.emplace_back(createRelation(rexsapi::TRelationType::ASSEMBLY, rexsapi::TRelationRole::ASSEMBLY, 3,
+                                          rexsapi::TRelationRole::PART, 5));
+    relations.emplace_back(
+      rexsapi::TRelation{rexsapi::TRelationType::STAGE, {},
+                         rexsapi::TRelationReferences{
+                           rexsapi::TRelationReference{rexsapi::TRelationRole::STAGE, "", components[5]},
+                           rexsapi::TRelationReference{rexsapi::TRelationRole::GEAR_1, "", components[3]},
+                           rexsapi::TRelationReference{rexsapi::TRelationRole::GEAR_2, "", components[4]}}});
+    relations.emplace_back(createRelation(rexsapi::TRelationType::ASSEMBLY, rexsapi::TRelationRole::ASSEMBLY, 1,
+                                          rexsapi::TRelationRole::PART, 7));
+
+    rexsapi::TModelInfo info{"REXSApi Unit Test", "1.0", "2022-05-20T08:59:10+01:00", dbModel.getVersion(), "en"};
+    return rexsapi::TModel{info, std::move(components), std::move(relations),
+                           rexsapi::TLoadSpectrum{rexsapi::TLoadCases{}, std::nullopt}};
+  }
+}
+
+TEST_CASE("Relation graph test")
+{
+  const auto& dbModel = loadModel("1.4");
+  const auto model = createGearModel(dbModel);
+  const rexsapi::TRelationGraph graph{model};
+
+  SUBCASE("Graph")
+  {
+    CHECK(graph.getComponentCount() == 7);
+    CHECK(graph.getRelationCount() == 6);
+    CHECK(graph.hasComponent(6));
+    CHECK_FALSE(graph.hasComponent(8));
+    CHECK_THROWS_WITH((void)graph.getNeighbours(8), "component id=8 is not part of the model");
+  }
+
+  SUBCASE("Relations")
+  {
+    std::vector<const rexsapi::TRelation*> relations;
+    graph.visitRelations(1, {}, [&relations](const rexsapi::TRelation& relation, rexsapi::TRelationRole role) {
+      CHECK(role == rexsapi::TRelationRole::ASSEMBLY);
+      relations.emplace_back(&relation);
+    });
+    CHECK(relations ==
+          std::vector<const rexsapi::TRelation*>{&model.getRelations()[0], &model.getRelations()[1],
+                                                 &model.getRelations()[5]});
+
+    size_t count = 0;
+    graph.visitRelations(4, rexsapi::TRelationFilter{rexsapi::TRelationType::STAGE, {}, {}},
+                         [&count](const rexsapi::TRelation& relation, rexsapi::TRelationRole role) {
+                           CHECK(relation.getType() == rexsapi::TRelationType::STAGE);
+                           CHECK(role == rexsapi::TRelationRole::GEAR_1);
+                           ++count;
+                         });
+    CHECK(count == 1);
+
+    count = 0;
+    graph.visitRelations(4, rexsapi::TRelationFilter{{}, rexsapi::TRelationRole::ASSEMBLY, {}},
+                         [&count](const rexsapi::TRelation&, rexsapi::TRelationRole) {
+                           ++count;
+                         });
+    CHECK(count == 0);
+  }
+
+  SUBCASE("Neighbours")
+  {
+    CHECK(toIds(graph.getNeighbours(1)) == std::vector<uint64_t>{2, 3, 7});
+    CHECK(toIds(graph.getNeighbours(4)) == std::vector<uint64_t>{2, 6, 5});
+    CHECK(toIds(graph.getNeighbours(6, rexsapi::TRelationFilter{{}, {}, rexsapi::TRelationRole::GEAR_2})) ==
+          std::vector<uint64_t>{5});
+    CHECK(toIds(graph.getNeighbours(2, rexsapi::TRelationFilter{{}, rexsapi::TRelationRole::PART, {}})) ==
+          std::vector<uint64_t>{1});
+
+    std::vector<std::pair<uint64_t, rexsapi::TRelationRole>> neighbours;
+    graph.visitNeighbours(5, {},
+                          [&neighbours](const rexsapi::TComponent& neighbour, const rexsapi::TRelation&,
+                                        rexsapi::TRelationRole role) {
+                            neighbours.emplace_back(neighbour.getInternalId(), role);
+                          });
+    CHECK(neighbours == std::vector<std::pair<uint64_t, rexsapi::TRelationRole>>{
+                          {3, rexsapi::TRelationRole::ASSEMBLY},
+                          {6, rexsapi::TRelationRole::STAGE},
+                          {4, rexsapi::TRelationRole::GEAR_1}});
+  }
+
+  SUBCASE("Traversal")
+  {
+    CHECK(toIds(graph.breadthFirstSearch(1)) == std::vector<uint64_t>{1, 2, 3, 7, 4, 5, 6});
+    CHECK(toIds(graph.depthFirstSearch(1)) == std::vector<uint64_t>{1, 2, 4, 6, 5, 3, 7});
+
+    const rexsapi::TRelationFilter assemblies{rexsapi::TRelationType::ASSEMBLY, rexsapi::TRelationRole::ASSEMBLY, {}};
+    CHECK(toIds(graph.breadthFirstSearch(1, assemblies)) == std::vector<uint64_t>{1, 2, 3, 7, 4, 5});
+    CHECK(toIds(graph.depthFirstSearch(3, assemblies)) == std::vector<uint64_t>{3, 5});
+    CHECK(toIds(graph.breadthFirstSearch(7, assemblies)) == std::vector<uint64_t>{7});
+  }
+}
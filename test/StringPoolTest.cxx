@@ -0,0 +1,83 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <rexsapi/Attribute.hxx>
+#include <rexsapi/StringPool.hxx>
+
+#include <thread>
+
+#include <doctest.h>
+
+
+TEST_CASE("String pool test")
+{
+  SUBCASE("Intern strings")
+  {
+    const auto& s1 = rexsapi::detail::TStringPool::intern("gear_unit");
+    const auto& s2 = rexsapi::detail::TStringPool::intern(std::string{"gear_"} + "unit");
+    CHECK(s1 == "gear_unit");
+    CHECK(&s1 == &s2);
+    CHECK(&s1 != &rexsapi::detail::TStringPool::intern("gear_unit_"));
+    CHECK(rexsapi::detail::TStringPool::intern("").empty());
+    CHECK(&rexsapi::detail::TStringPool::intern("") == &rexsapi::detail::TStringPool::intern({}));
+  }
+
+  SUBCASE("Share strings between model elements")
+  {
+    const rexsapi::database::TUnit databaseUnit{2, "mm"};
+    const rexsapi::TUnit unit{databaseUnit};
+    CHECK(&rexsapi::TUnit{databaseUnit}.getName() == &unit.getName());
+
+    // custom strings are not interned, but still compare equal
+    const rexsapi::TUnit customUnit{"mm"};
+    CHECK(&customUnit.getName() != &unit.getName());
+    CHECK(customUnit == unit);
+    CHECK(customUnit != rexsapi::TUnit{"m"});
+
+    const rexsapi::TAttribute attribute1{"custom_load", customUnit, rexsapi::TValueType::FLOATING_POINT,
+                                         rexsapi::TValue{1.0}};
+    const rexsapi::TAttribute attribute2{"custom_load", rexsapi::TUnit{}, rexsapi::TValueType::FLOATING_POINT,
+                                         rexsapi::TValue{2.0}};
+    CHECK(&attribute1.getAttributeId() != &attribute2.getAttributeId());
+    CHECK(attribute1.getAttributeId() == attribute2.getAttributeId());
+    CHECK(&rexsapi::TAttribute{attribute1, rexsapi::TValue{3.0}}.getAttributeId() == &attribute1.getAttributeId());
+    CHECK(attribute1.getUnit() == unit);
+    CHECK(attribute2.getUnit().getName().empty());
+  }
+
+  SUBCASE("Intern concurrently")
+  {
+    std::vector<const std::string*> interned(4);
+    std::vector<std::thread> threads;
+    for (size_t n = 0; n < interned.size(); ++n) {
+      threads.emplace_back([&interned, n]() {
+        for (size_t i = 0; i < 1000; ++i) {
+          const auto& s = rexsapi::detail::TStringPool::intern(fmt::format("custom_concurrent_{}", i));
+          if (i == 42) {
+            interned[n] = &s;
+          }
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    for (const auto* s : interned) {
+      CHECK(s == interned[0]);
+      CHECK(*s == "custom_concurrent_42");
+    }
+  }
+}
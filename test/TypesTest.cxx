@@ -151,6 +151,54 @@ TEST_CASE("Bool test")
   }
 }
 
+TEST_CASE("Matrix test")
+{
+  SUBCASE("Create from rows")
+  {
+    const rexsapi::TMatrix<double> matrix{{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}}};
+    CHECK(matrix.validate());
+    CHECK(matrix.getRowCount() == 2);
+    CHECK(matrix.getColumnCount() == 3);
+    CHECK(matrix.size() == 6);
+    CHECK(matrix(1, 2) == doctest::Approx{6.0});
+    CHECK(matrix.getValues() == std::vector<double>{1.0, 2.0, 3.0, 4.0, 5.0, 6.0});
+    CHECK(matrix.data()[4] == doctest::Approx{5.0});
+    CHECK(matrix.getRows() == std::vector<std::vector<double>>{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}});
+    CHECK_THROWS_WITH((rexsapi::TMatrix<double>{{{1.0, 2.0}, {3.0}}}), "matrix rows have differing column counts");
+  }
+
+  SUBCASE("Create from buffer")
+  {
+    const rexsapi::TMatrix<int64_t> matrix{2, 2, {1, 2, 3, 4}};
+    CHECK(matrix == rexsapi::TMatrix<int64_t>{{{1, 2}, {3, 4}}});
+    CHECK_FALSE(matrix == rexsapi::TMatrix<int64_t>{1, 4, {1, 2, 3, 4}});
+    CHECK_THROWS_WITH((rexsapi::TMatrix<int64_t>{2, 2, {1, 2, 3}}),
+                      "matrix does not have the correct element count: 3 rows: 2 columns: 2");
+    CHECK(rexsapi::TMatrix<int64_t>{}.empty());
+  }
+
+  SUBCASE("Views")
+  {
+    const rexsapi::TMatrix<std::string> matrix{{{"a", "b", "c"}, {"d", "e", "f"}}};
+    const auto row = matrix.getRow(1);
+    CHECK(row.size() == 3);
+    CHECK(row[0] == "d");
+    CHECK(std::vector<std::string>{row.begin(), row.end()} == std::vector<std::string>{"d", "e", "f"});
+    const auto column = matrix.getColumn(2);
+    CHECK(column.size() == 2);
+    CHECK(std::vector<std::string>{column.begin(), column.end()} == std::vector<std::string>{"c", "f"});
+  }
+
+  SUBCASE("Convert")
+  {
+    const rexsapi::TMatrix<double> matrix{{{1.5, 2.5}, {3.5, 4.5}}};
+    const rexsapi::TMatrix<int32_t> converted{matrix};
+    CHECK(converted.getRowCount() == 2);
+    CHECK(converted.getColumnCount() == 2);
+    CHECK(converted(1, 0) == 3);
+  }
+}
+
 TEST_CASE("Datetime test")
 {
   const std::regex reg_expr(R"(^(\d{4})-(\d{2})-(\d{2})T(\d{2}):(\d{2}):(\d{2})[+-](\d{2}):(\d{2})$)");
@@ -128,10 +128,10 @@ TEST_CASE("Value test")
     rexsapi::TMatrix<double> matrix{{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}, {7.0, 8.0, 9.0}}};
     rexsapi::TValue val{matrix};
     CHECK_FALSE(val.isEmpty());
-    REQUIRE(val.getValue<rexsapi::TFloatMatrixType>().m_Values.size() == 3);
-    CHECK(val.getValue<rexsapi::TFloatMatrixType>().m_Values[0].size() == 3);
-    CHECK(val.getValue<rexsapi::TFloatMatrixType>().m_Values[1].size() == 3);
-    CHECK(val.getValue<rexsapi::TFloatMatrixType>().m_Values[2].size() == 3);
+    REQUIRE(val.getValue<rexsapi::TFloatMatrixType>().getRowCount() == 3);
+    CHECK(val.getValue<rexsapi::TFloatMatrixType>().getRow(0).size() == 3);
+    CHECK(val.getValue<rexsapi::TFloatMatrixType>().getRow(1).size() == 3);
+    CHECK(val.getValue<rexsapi::TFloatMatrixType>().getRow(2).size() == 3);
     CHECK(val.asString() == "[[1.0,2.0,3.0],[4.0,5.0,6.0],[7.0,8.0,9.0]]");
   }
 
@@ -140,10 +140,10 @@ TEST_CASE("Value test")
     rexsapi::TMatrix<std::string> matrix{{{"a", "b", "c"}, {"d", "e", "f"}, {"g", "h", "i"}}};
     rexsapi::TValue val{matrix};
     CHECK_FALSE(val.isEmpty());
-    REQUIRE(val.getValue<rexsapi::TStringMatrixType>().m_Values.size() == 3);
-    CHECK(val.getValue<rexsapi::TStringMatrixType>().m_Values[0].size() == 3);
-    CHECK(val.getValue<rexsapi::TStringMatrixType>().m_Values[1].size() == 3);
-    CHECK(val.getValue<rexsapi::TStringMatrixType>().m_Values[2].size() == 3);
+    REQUIRE(val.getValue<rexsapi::TStringMatrixType>().getRowCount() == 3);
+    CHECK(val.getValue<rexsapi::TStringMatrixType>().getRow(0).size() == 3);
+    CHECK(val.getValue<rexsapi::TStringMatrixType>().getRow(1).size() == 3);
+    CHECK(val.getValue<rexsapi::TStringMatrixType>().getRow(2).size() == 3);
     CHECK(val.asString() == "[[a,b,c],[d,e,f],[g,h,i]]");
   }
 
@@ -82,16 +82,16 @@ namespace
                                              return stream.str();
                                            },
                                            [](rexsapi::TFloatMatrixTag, const auto& m) -> std::string {
-                                             return "float matrix " + std::to_string(m.m_Values.size()) + " entries";
+                                             return "float matrix " + std::to_string(m.getRowCount()) + " entries";
                                            },
                                            [](rexsapi::TIntMatrixTag, const auto& m) -> std::string {
-                                             return "int matrix " + std::to_string(m.m_Values.size()) + " entries";
+                                             return "int matrix " + std::to_string(m.getRowCount()) + " entries";
                                            },
                                            [](rexsapi::TBoolMatrixTag, const auto& m) -> std::string {
-                                             return "bool matrix " + std::to_string(m.m_Values.size()) + " entries";
+                                             return "bool matrix " + std::to_string(m.getRowCount()) + " entries";
                                            },
                                            [](rexsapi::TStringMatrixTag, const auto& m) -> std::string {
-                                             return "string matrix " + std::to_string(m.m_Values.size()) + " entries";
+                                             return "string matrix " + std::to_string(m.getRowCount()) + " entries";
                                            },
                                            [](rexsapi::TArrayOfIntArraysTag, const auto& a) -> std::string {
                                              return "array of int arrays " + std::to_string(a.size()) + " entries";
@@ -214,5 +214,31 @@ namespace rexsapi
       CHECK_THROWS(::dispatch_empty(rexsapi::TValueType::STRING_MATRIX, rexsapi::TValue{}));
       CHECK_THROWS(::dispatch_empty(rexsapi::TValueType::ARRAY_OF_INTEGER_ARRAYS, rexsapi::TValue{}));
     }
+
+    SUBCASE("Visit value")
+    {
+      const auto visitor = rexsapi::detail::overload{[](rexsapi::TFloatTag, const auto& d) -> std::string {
+                                                       return "float " + rexsapi::format(d);
+                                                     },
+                                                     [](rexsapi::TIntArrayTag, const auto& a) -> std::string {
+                                                       return "int array " + std::to_string(a.size()) + " entries";
+                                                     },
+                                                     [](auto, const auto&) -> std::string {
+                                                       return "other";
+                                                     }};
+      CHECK(rexsapi::visitValue(rexsapi::TValueType::FLOATING_POINT, rexsapi::TValue{47.11}, visitor) == "float 47.11");
+      CHECK(rexsapi::visitValue(rexsapi::TValueType::INTEGER_ARRAY, rexsapi::TValue{rexsapi::TIntArrayType{1, 2, 3}},
+                                visitor) == "int array 3 entries");
+      CHECK(rexsapi::visitValue(rexsapi::TValueType::STRING, rexsapi::TValue{"puschel"}, visitor) == "other");
+      CHECK_THROWS_WITH(rexsapi::visitValue(rexsapi::TValueType::INTEGER, rexsapi::TValue{47.11}, visitor),
+                        "wrong value 47.11 for type integer");
+
+      size_t count{0};
+      rexsapi::visitValue(rexsapi::TValueType::STRING_ARRAY, rexsapi::TValue{rexsapi::TStringArrayType{"a", "b"}},
+                          [&count](auto, const auto&) {
+                            ++count;
+                          });
+      CHECK(count == 1);
+    }
   }
 }
@@ -20,6 +20,9 @@
 #include <test/TestModelHelper.hxx>
 #include <test/TestModelLoader.hxx>
 
+#include <fstream>
+#include <sstream>
+
 #include <doctest.h>
 
 
@@ -176,6 +179,166 @@ TEST_CASE("XML model loader test")
     REQUIRE(model->getLoadSpectrum().hasAccumulation());
   }
 
+  SUBCASE("Load model from stream")
+  {
+    const rexsapi::TXMLModelLoader loader{rexsapi::TMode::STRICT_MODE, validator};
+    std::istringstream stream{MemModel};
+    const auto model = loader.load(result, registry, stream);
+    CHECK_FALSE(result);
+    REQUIRE(result.getErrors().size() == 1);
+    CHECK(result.getErrors()[0].getMessage() ==
+          "Load: duplicate attribute found for attribute id=u_coordinate_on_shaft of component id=3");
+    REQUIRE(model);
+    CHECK(model->getInfo().getApplicationId() == "REXSApi Unit Test");
+    REQUIRE(model->getInfo().getApplicationLanguage().has_value());
+    CHECK(*model->getInfo().getApplicationLanguage() == "de");
+    CHECK(model->getInfo().getVersion() == rexsapi::TRexsVersion{1, 5});
+    REQUIRE(model->getComponents().size() == 3);
+    REQUIRE(model->getRelations().size() == 2);
+    REQUIRE(model->getRelations()[0].getReferences().size() == 2);
+    CHECK(model->getRelations()[0].getReferences()[0].getComponent().getType() == "gear_unit");
+    REQUIRE(model->getRelations()[0].getReferences()[0].getComponent().getAttributes().size() == 16);
+    REQUIRE(model->getLoadSpectrum().getLoadCases().size() == 2);
+    REQUIRE(model->getLoadSpectrum().getLoadCases()[0].getLoadComponents().size() == 2);
+    CHECK(model->getLoadSpectrum().getLoadCases()[0].getLoadComponents()[0].getAttributes().size() == 4);
+    CHECK(model->getLoadSpectrum().getLoadCases()[0].getLoadComponents()[1].getAttributes().size() == 8);
+    REQUIRE(model->getLoadSpectrum().hasAccumulation());
+  }
+
+  SUBCASE("Load complex model from stream")
+  {
+    const auto path = projectDir() / "test" / "example_models" / "FVA-Industriegetriebe_2stufig_1-4.rexs";
+    rexsapi::TResult bufferResult;
+    const auto expected = loadModel(bufferResult, path, registry);
+    REQUIRE(expected);
+
+    const rexsapi::TXMLModelLoader loader{rexsapi::TMode::STRICT_MODE, validator};
+    std::ifstream stream{path, std::ios::binary};
+    const auto model = loader.load(result, registry, stream);
+    REQUIRE(model);
+    CHECK_FALSE(result.isCritical());
+    REQUIRE(result.getErrors().size() == bufferResult.getErrors().size());
+    for (size_t n = 0; n < result.getErrors().size(); ++n) {
+      CHECK(result.getErrors()[n].getMessage() == bufferResult.getErrors()[n].getMessage());
+    }
+    CHECK(model->getComponents().size() == expected->getComponents().size());
+    CHECK(model->getRelations().size() == expected->getRelations().size());
+    CHECK(model->getLoadSpectrum().getLoadCases().size() == expected->getLoadSpectrum().getLoadCases().size());
+  }
+
+  SUBCASE("Load invalid documents from stream")
+  {
+    const rexsapi::TXMLModelLoader loader{rexsapi::TMode::RELAXED_MODE, validator};
+
+    std::istringstream invalidComponent{R"(
+      <model applicationId="REXSApi Unit Test" applicationVersion="1.0" date="2022-05-05T10:35:00+02:00" version="1.4">
+        <components>
+          <component id="1" type="gear_unit"/>
+          <component id="2"/>
+        </components>
+      </model>
+    )"};
+    CHECK_FALSE(loader.load(result, registry, invalidComponent));
+    CHECK(result.isCritical());
+    REQUIRE(result.getErrors().size() == 1);
+    CHECK(result.getErrors()[0].getMessage() == "[/model/components/component/] missing required attribute 'type'");
+
+    result.reset();
+    std::istringstream duplicateComponents{R"(
+      <model applicationId="REXSApi Unit Test" applicationVersion="1.0" date="2022-05-05T10:35:00+02:00" version="1.4">
+        <components>
+        </components>
+        <components>
+        </components>
+      </model>
+    )"};
+    CHECK_FALSE(loader.load(result, registry, duplicateComponents));
+    CHECK(result.isCritical());
+
+    result.reset();
+    std::istringstream malformed{R"(
+      <model applicationId="REXSApi Unit Test" applicationVersion="1.0" date="2022-05-05T10:35:00+02:00" version="1.4">
+        <components>
+      </model>
+    )"};
+    CHECK_FALSE(loader.load(result, registry, malformed));
+    CHECK(result.isCritical());
+  }
+
+  SUBCASE("Load generated model with many components")
+  {
+    const uint64_t count = 2000;
+    std::string components;
+    std::string relations;
+    std::string loadCaseComponents;
+    for (uint64_t id = 2; id <= count + 1; ++id) {
+      components += fmt::format(R"(<component id="{}" name="Gehäuse {}" type="gear_casing">
+                                     <attribute id="temperature_lubricant" unit="C">{}</attribute>
+                                   </component>)",
+                                id, id, id);
+      relations += fmt::format(R"(<relation id="{}" type="assembly">
+                                    <ref hint="gear_unit" id="1" role="assembly"/>
+                                    <ref hint="gear_casing" id="{}" role="part"/>
+                                  </relation>)",
+                               id, id);
+      loadCaseComponents += fmt::format(R"(<component id="{}" type="gear_casing">
+                                             <attribute id="temperature_lubricant" unit="C">{}</attribute>
+                                           </component>)",
+                                        id, id + 1);
+    }
+    const auto buffer = fmt::format(R"(<?xml version="1.0" encoding="UTF-8" standalone="no"?>
+      <model applicationId="REXSApi Unit Test" applicationVersion="1.0" date="2022-05-05T10:35:00+02:00" version="1.5" applicationLanguage="en">
+        <relations>{}</relations>
+        <components>
+          <component id="1" name="Getriebeeinheit" type="gear_unit"/>
+          {}
+        </components>
+        <load_spectrum id="1">
+          <load_case id="1">{}</load_case>
+        </load_spectrum>
+      </model>)",
+                                    relations, components, loadCaseComponents);
+
+    rexsapi::detail::TBufferModelLoader<rexsapi::TXSDSchemaValidator, rexsapi::TXMLModelLoader> loader{validator,
+                                                                                                       buffer};
+    const auto model = loader.load(rexsapi::TMode::STRICT_MODE, result, registry);
+    CHECK(result);
+    REQUIRE(model);
+    REQUIRE(model->getComponents().size() == count + 1);
+    REQUIRE(model->getRelations().size() == count);
+    for (uint64_t n = 1; n <= count; ++n) {
+      const auto& component = model->getComponents()[n];
+      CHECK(component.getExternalId() == n + 1);
+      REQUIRE(component.getAttributes().size() == 1);
+      CHECK(component.getAttributes()[0].getValue<rexsapi::TFloatType>() ==
+            doctest::Approx(static_cast<double>(n + 1)));
+      CHECK(model->getRelations()[n - 1].getReferences()[1].getComponent().getExternalId() == n + 1);
+    }
+    REQUIRE(model->getLoadSpectrum().getLoadCases().size() == 1);
+    const auto& loadComponents = model->getLoadSpectrum().getLoadCases()[0].getLoadComponents();
+    REQUIRE(loadComponents.size() == count);
+    CHECK(loadComponents[10].getComponent().getExternalId() == 12);
+    REQUIRE(loadComponents[10].getLoadAttributes().size() == 1);
+    CHECK(loadComponents[10].getLoadAttributes()[0].getValue<rexsapi::TFloatType>() == doctest::Approx(13.0));
+
+    // the relations precede the components and are kept until the components have been read
+    const rexsapi::TXMLModelLoader streamLoader{rexsapi::TMode::STRICT_MODE, validator};
+    std::istringstream stream{buffer};
+    const auto streamModel = streamLoader.load(result, registry, stream);
+    CHECK(result);
+    REQUIRE(streamModel);
+    REQUIRE(streamModel->getRelations().size() == count);
+    for (uint64_t n = 1; n <= count; ++n) {
+      const auto& references = streamModel->getRelations()[n - 1].getReferences();
+      REQUIRE(references.size() == 2);
+      CHECK(references[0].getRole() == rexsapi::TRelationRole::ASSEMBLY);
+      CHECK(references[0].getHint() == "gear_unit");
+      CHECK(references[0].getComponent().getExternalId() == 1);
+      CHECK(references[1].getComponent().getExternalId() == n + 1);
+    }
+    CHECK(streamModel->getLoadSpectrum().getLoadCases()[0].getLoadComponents().size() == count);
+  }
+
   SUBCASE("Load simple model from file")
   {
     const auto model =
@@ -498,5 +661,17 @@ TEST_CASE("XML model loader test")
     rexsapi::detail::TBufferModelLoader<rexsapi::TXSDSchemaValidator, rexsapi::TXMLModelLoader> loader{validator,
                                                                                                        buffer};
     CHECK_THROWS((void)loader.load(rexsapi::TMode::STRICT_MODE, result, registry));
+
+    // loading from a stream behaves the same and does not report the missing database model as a parse error
+    result.reset();
+    std::istringstream relaxedStream{buffer};
+    CHECK(rexsapi::TXMLModelLoader{rexsapi::TMode::RELAXED_MODE, validator}.load(result, registry, relaxedStream));
+    CHECK(result);
+
+    result.reset();
+    std::istringstream strictStream{buffer};
+    const rexsapi::TXMLModelLoader strictLoader{rexsapi::TMode::STRICT_MODE, validator};
+    CHECK_THROWS((void)strictLoader.load(result, registry, strictStream));
+    CHECK(result.getErrors().empty());
   }
 }
@@ -25,6 +25,9 @@
 #include <test/TestModel.hxx>
 #include <test/TestModelLoader.hxx>
 
+#include <fstream>
+#include <sstream>
+
 #include <doctest.h>
 
 namespace
@@ -90,6 +93,20 @@ TEST_CASE("XML model file serializer test")
     CHECK(roundtripModel.getComponents().size() == model.getComponents().size());
     CHECK(roundtripModel.getRelations().size() == model.getRelations().size());
   }
+
+  SUBCASE("Serialize loaded model to stream")
+  {
+    TemporaryDirectory tmpDir;
+    rexsapi::TXMLFileSerializer xmlSerializer{tmpDir.getTempDirectoryPath() / "FVA_worm_stage_1-4.rexs"};
+    rexsapi::XMLModelSerializer{}.serialize(model, xmlSerializer);
+
+    std::ifstream file{tmpDir.getTempDirectoryPath() / "FVA_worm_stage_1-4.rexs", std::ios::binary};
+    const std::string expected{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+
+    std::ostringstream stream;
+    rexsapi::XMLModelSerializer{}.serialize(model, stream);
+    CHECK(stream.str() == expected);
+  }
 }
 
 TEST_CASE("XML serialize new model")
@@ -120,6 +137,15 @@ TEST_CASE("XML serialize new model")
     CHECK(roundtripModel.getLoadSpectrum().getAccumulation().getLoadComponents()[0].getLoadAttributes().size() == 2);
   }
 
+  SUBCASE("Serialize model to stream")
+  {
+    const auto model = createModel(dbModel);
+    modelSerializer.serialize(model, stringSerializer);
+    std::ostringstream stream;
+    modelSerializer.serialize(model, stream);
+    CHECK(stream.str() == stringSerializer.getModel());
+  }
+
   SUBCASE("Serialze model to file with model saver")
   {
     TemporaryDirectory guard;
@@ -129,4 +155,21 @@ TEST_CASE("XML serialize new model")
     CHECK(result);
     REQUIRE(std::filesystem::exists(guard.getTempDirectoryPath() / "test_model.rexs"));
   }
+
+  SUBCASE("Serialize model to compressed file with model saver")
+  {
+    TemporaryDirectory guard;
+    rexsapi::TResult result;
+    rexsapi::TModelSaver{}.store(result, createModel(dbModel), guard.getTempDirectoryPath() / "test_model",
+                                 rexsapi::TSaveType::COMPRESSED_XML);
+    CHECK(result);
+    REQUIRE(std::filesystem::exists(guard.getTempDirectoryPath() / "test_model.rexsz"));
+
+    const rexsapi::TModelLoader loader{projectDir() / "models"};
+    const auto model =
+      loader.load(guard.getTempDirectoryPath() / "test_model.rexsz", result, rexsapi::TMode::STRICT_MODE);
+    CHECK(result);
+    REQUIRE(model);
+    CHECK(model->getComponents().size() == 7);
+  }
 }
@@ -0,0 +1,146 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <rexsapi/XMLStreamReader.hxx>
+
+#include <sstream>
+
+#include <doctest.h>
+
+
+namespace
+{
+  void readAll(const std::string& document)
+  {
+    std::istringstream stream{document};
+    rexsapi::detail::TXMLStreamReader reader{stream};
+    while (reader.next() != rexsapi::detail::TXMLEvent::END_DOCUMENT) {
+    }
+  }
+}
+
+TEST_CASE("XML stream reader test")
+{
+  SUBCASE("Read events")
+  {
+    std::istringstream stream{R"(
+      <?xml version="1.0" encoding="UTF-8" standalone="no"?>
+      <!-- a comment -->
+      <model version="1.5" date='2022-05-05'>
+        <components>
+          <component id="1"/>
+          <component id="2">
+            <attribute id="name">Puh &amp; Ferkel</attribute>
+          </component>
+        </components>
+      </model>
+    )"};
+    rexsapi::detail::TXMLStreamReader reader{stream};
+
+    REQUIRE(reader.next() == rexsapi::detail::TXMLEvent::START_ELEMENT);
+    CHECK(reader.getName() == "model");
+    REQUIRE(reader.getAttributes().size() == 2);
+    CHECK(reader.getAttributes()[0].first == "version");
+    CHECK(reader.getAttributes()[0].second == "1.5");
+    CHECK(reader.getAttributes()[1].first == "date");
+    CHECK(reader.getAttributes()[1].second == "2022-05-05");
+    REQUIRE(reader.next() == rexsapi::detail::TXMLEvent::START_ELEMENT);
+    CHECK(reader.getName() == "components");
+    REQUIRE(reader.next() == rexsapi::detail::TXMLEvent::START_ELEMENT);
+    CHECK(reader.getName() == "component");
+    REQUIRE(reader.next() == rexsapi::detail::TXMLEvent::END_ELEMENT);
+    CHECK(reader.getName() == "component");
+    REQUIRE(reader.next() == rexsapi::detail::TXMLEvent::START_ELEMENT);
+    REQUIRE(reader.next() == rexsapi::detail::TXMLEvent::START_ELEMENT);
+    CHECK(reader.getName() == "attribute");
+    REQUIRE(reader.next() == rexsapi::detail::TXMLEvent::TEXT);
+    CHECK(reader.getText() == "Puh & Ferkel");
+    REQUIRE(reader.next() == rexsapi::detail::TXMLEvent::END_ELEMENT);
+    CHECK(reader.getName() == "attribute");
+    REQUIRE(reader.next() == rexsapi::detail::TXMLEvent::END_ELEMENT);
+    CHECK(reader.getName() == "component");
+    REQUIRE(reader.next() == rexsapi::detail::TXMLEvent::END_ELEMENT);
+    CHECK(reader.getName() == "components");
+    REQUIRE(reader.next() == rexsapi::detail::TXMLEvent::END_ELEMENT);
+    CHECK(reader.getName() == "model");
+    CHECK(reader.next() == rexsapi::detail::TXMLEvent::END_DOCUMENT);
+    CHECK(reader.next() == rexsapi::detail::TXMLEvent::END_DOCUMENT);
+  }
+
+  SUBCASE("Read references and cdata")
+  {
+    std::istringstream stream{"\xEF\xBB\xBF<a b=\"&lt;&#65;&#x42;\t&gt;\">&quot;&apos;&#228;&unknown;"
+                              "<![CDATA[<c>&amp;</c>]]></a>"};
+    rexsapi::detail::TXMLStreamReader reader{stream};
+
+    REQUIRE(reader.next() == rexsapi::detail::TXMLEvent::START_ELEMENT);
+    REQUIRE(reader.getAttributes().size() == 1);
+    CHECK(reader.getAttributes()[0].second == "<AB >");
+    REQUIRE(reader.next() == rexsapi::detail::TXMLEvent::TEXT);
+    CHECK(reader.getText() == "\"'\xC3\xA4&unknown;");
+    REQUIRE(reader.next() == rexsapi::detail::TXMLEvent::TEXT);
+    CHECK(reader.getText() == "<c>&amp;</c>");
+    CHECK(reader.next() == rexsapi::detail::TXMLEvent::END_ELEMENT);
+    CHECK(reader.next() == rexsapi::detail::TXMLEvent::END_DOCUMENT);
+  }
+
+  SUBCASE("Read element")
+  {
+    std::istringstream stream{R"(
+      <components>
+        <component id="1" type="gear_unit">
+          <attribute id="u_axis_vector" unit="mm"><array><c>1.0</c><c>0.0</c><c>0.0</c></array></attribute>
+        </component>
+        <component id="2" type="gear_casing"/>
+      </components>
+    )"};
+    rexsapi::detail::TXMLStreamReader reader{stream};
+    pugi::xml_document doc;
+
+    REQUIRE(reader.next() == rexsapi::detail::TXMLEvent::START_ELEMENT);
+    REQUIRE(reader.next() == rexsapi::detail::TXMLEvent::START_ELEMENT);
+    const auto component = reader.readElement(doc);
+    CHECK(std::string{component.name()} == "component");
+    CHECK(std::string{component.attribute("type").value()} == "gear_unit");
+    CHECK(doc.select_nodes("component/attribute/array/c").size() == 3);
+    CHECK(std::string{doc.select_node("component/attribute/array/c").node().child_value()} == "1.0");
+
+    REQUIRE(reader.next() == rexsapi::detail::TXMLEvent::START_ELEMENT);
+    const auto empty = reader.readElement(doc);
+    CHECK(std::string{empty.attribute("id").value()} == "2");
+    CHECK(empty.first_child().empty());
+    REQUIRE(reader.next() == rexsapi::detail::TXMLEvent::END_ELEMENT);
+    CHECK(reader.getName() == "components");
+    CHECK(reader.next() == rexsapi::detail::TXMLEvent::END_DOCUMENT);
+  }
+
+  SUBCASE("Read malformed documents")
+  {
+    CHECK_THROWS_WITH((readAll("<a><b></a>")), "malformed xml document at offset 10: unexpected end of element 'a'");
+    CHECK_THROWS_WITH((readAll("<a>")), "malformed xml document at offset 3: element 'a' is not closed");
+    CHECK_THROWS_WITH((readAll("<a b=1/>")),
+                      "malformed xml document at offset 6: value of attribute 'b' is not quoted");
+    CHECK_THROWS_WITH((readAll("text")), "malformed xml document at offset 4: text outside of root element");
+    CHECK_THROWS_AS((readAll("<a>&puh</a>")), rexsapi::TException);
+    CHECK_THROWS_WITH((readAll("<a>&#0;</a>")),
+                      "malformed xml document at offset 7: malformed character reference '&#0;'");
+    for (const auto* document : {"<a>&#x;</a>", "<a>&#xD800;</a>", "<a>&#57343;</a>", "<a>&#x110000;</a>",
+                                 "<a>&#4294967296;</a>", "<a>&#x-1;</a>", "<a>&#12a;</a>"}) {
+      CHECK_THROWS_AS((readAll(document)), rexsapi::TException);
+    }
+    CHECK_THROWS_AS((readAll("<a><!-- comment</a>")), rexsapi::TException);
+  }
+}
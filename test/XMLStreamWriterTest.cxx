@@ -0,0 +1,118 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <rexsapi/XMLModelSerializer.hxx>
+#include <rexsapi/XMLStreamWriter.hxx>
+
+#include <sstream>
+
+#include <doctest.h>
+
+
+namespace
+{
+  template<typename TWriter>
+  void writeDocument(TWriter& writer)
+  {
+    writer.startDocument();
+    writer.startElement("model");
+    writer.attribute("applicationId", "Puh & \"Ferkel\" <'I-Aah'>");
+    writer.attribute("date", std::string{"tab\tnew line\n"});
+    writer.startElement("components");
+    writer.startElement("component");
+    writer.attribute("id", "1");
+    writer.endElement();
+    writer.startElement("component");
+    writer.attribute("id", "2");
+    writer.startElement("attribute");
+    writer.text("a < b && c > \"d\"\ttab\x01");
+    writer.endElement();
+    writer.startElement("attribute");
+    writer.text("");
+    writer.endElement();
+    writer.startElement("attribute");
+    writer.startElement("array");
+    writer.startElement("c");
+    writer.text("1.0");
+    writer.endElement();
+    writer.startElement("c");
+    writer.text("Ünïcödé");
+    writer.endElement();
+    writer.endElement();
+    writer.endElement();
+    writer.endElement();
+    writer.endElement();
+    writer.endElement();
+    writer.endDocument();
+  }
+}
+
+TEST_CASE("XML stream writer test")
+{
+  SUBCASE("Write document")
+  {
+    std::ostringstream stream;
+    rexsapi::detail::TXMLStreamWriter writer{stream};
+    writeDocument(writer);
+
+    CHECK(stream.str() == "\xef\xbb\xbf<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>\n"
+                          "<model applicationId=\"Puh &amp; &quot;Ferkel&quot; &lt;'I-Aah'>\" "
+                          "date=\"tab&#09;new line&#10;\">\n"
+                          "  <components>\n"
+                          "    <component id=\"1\" />\n"
+                          "    <component id=\"2\">\n"
+                          "      <attribute>a &lt; b &amp;&amp; c &gt; \"d\"\ttab&#01;</attribute>\n"
+                          "      <attribute></attribute>\n"
+                          "      <attribute>\n"
+                          "        <array>\n"
+                          "          <c>1.0</c>\n"
+                          "          <c>Ünïcödé</c>\n"
+                          "        </array>\n"
+                          "      </attribute>\n"
+                          "    </component>\n"
+                          "  </components>\n"
+                          "</model>\n");
+  }
+
+  SUBCASE("Same output as pugixml")
+  {
+    pugi::xml_document doc;
+    rexsapi::detail::TXMLDocumentWriter documentWriter{doc};
+    writeDocument(documentWriter);
+    std::ostringstream expected;
+    doc.save(expected, "  ", pugi::format_indent | pugi::format_write_bom, pugi::encoding_utf8);
+
+    std::ostringstream stream;
+    rexsapi::detail::TXMLStreamWriter writer{stream, 16};
+    writeDocument(writer);
+
+    CHECK(stream.str() == expected.str());
+  }
+
+  SUBCASE("Invalid calls")
+  {
+    std::ostringstream stream;
+    rexsapi::detail::TXMLStreamWriter writer{stream};
+    writer.startDocument();
+    CHECK_THROWS_WITH(writer.text("puh"), "cannot write text without open element");
+    CHECK_THROWS_WITH(writer.endElement(), "cannot write end tag without open element");
+    writer.startElement("model");
+    writer.startElement("components");
+    writer.endElement();
+    CHECK_THROWS_WITH(writer.attribute("id", "1"), "cannot write attribute 'id' without open start tag");
+    CHECK_THROWS_WITH(writer.endDocument(), "cannot end document with open element 'model'");
+  }
+}
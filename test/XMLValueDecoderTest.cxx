@@ -263,8 +263,8 @@ TEST_CASE("XML value decoder test")
     const auto [value, result] =
       decoder.decode(rexsapi::TValueType::FLOATING_POINT_MATRIX, enumValue, getNode(doc, "float matrix"));
     CHECK(result == rexsapi::detail::TDecoderResult::SUCCESS);
-    CHECK(value.getValue<rexsapi::TMatrix<double>>().m_Values.size() == 3);
-    for (const auto& row : value.getValue<rexsapi::TMatrix<double>>().m_Values) {
+    CHECK(value.getValue<rexsapi::TMatrix<double>>().getRowCount() == 3);
+    for (const auto& row : value.getValue<rexsapi::TMatrix<double>>().getRows()) {
       CHECK(row.size() == 3);
     }
   }
@@ -274,8 +274,8 @@ TEST_CASE("XML value decoder test")
     const auto [value, result] =
       decoder.decode(rexsapi::TValueType::FLOATING_POINT_MATRIX, enumValue, getNode(doc, "coded float matrix"));
     CHECK(result == rexsapi::detail::TDecoderResult::SUCCESS);
-    CHECK(value.getValue<rexsapi::TMatrix<double>>().m_Values.size() == 3);
-    for (const auto& row : value.getValue<rexsapi::TMatrix<double>>().m_Values) {
+    CHECK(value.getValue<rexsapi::TMatrix<double>>().getRowCount() == 3);
+    for (const auto& row : value.getValue<rexsapi::TMatrix<double>>().getRows()) {
       CHECK(row.size() == 3);
     }
   }
@@ -476,7 +476,7 @@ TEST_CASE("XML unknown value decoder test")
     const auto [value, type] = decoder.decodeUnknown(node);
     CHECK(type == rexsapi::TValueType::STRING_MATRIX);
     auto val = value.getValue<rexsapi::TStringMatrixType>();
-    CHECK(val.m_Values.size() == 2);
+    CHECK(val.getRowCount() == 2);
     CHECK(val.validate());
   }
 
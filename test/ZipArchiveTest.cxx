@@ -16,8 +16,11 @@
 
 #include <rexsapi/ZipArchive.hxx>
 
+#include <test/TemporaryDirectory.hxx>
 #include <test/TestHelper.hxx>
 
+#include <iterator>
+
 #include <doctest.h>
 
 TEST_CASE("Zip archive test")
@@ -44,4 +47,77 @@ TEST_CASE("Zip archive test")
     CHECK_THROWS(
       rexsapi::detail::ZipArchive{projectDir() / "test" / "example_models" / "does_not_exist.rexsz", extensionChecker});
   }
+
+  SUBCASE("Write zip")
+  {
+    TemporaryDirectory guard;
+    const auto path = guard.getTempDirectoryPath() / "model.rexsz";
+    std::string content;
+    for (int n = 0; n < 1000; ++n) {
+      content += fmt::format("{{\"id\": {}}}\n", n);
+    }
+    {
+      rexsapi::detail::ZipArchiveWriter writer{path, MZ_BEST_COMPRESSION, 64};
+      writer.startFile("readme.txt") << "Puh der Bär";
+      writer.startFile("model.rexsj") << content;
+      writer.finish();
+    }
+    CHECK(std::filesystem::file_size(path) < content.size());
+
+    rexsapi::detail::ZipArchive archive{path, extensionChecker};
+    const auto [value, type] = archive.load();
+    CHECK(type == rexsapi::TFileType::JSON);
+    CHECK(std::string{value.begin(), value.end()} == content);
+  }
+
+  SUBCASE("Stream zip")
+  {
+    TemporaryDirectory guard;
+    const auto path = guard.getTempDirectoryPath() / "model.rexsz";
+    std::string content;
+    for (int n = 0; n < 1000; ++n) {
+      content += fmt::format("<component id=\"{}\"/>\n", n);
+    }
+    {
+      rexsapi::detail::ZipArchiveWriter writer{path};
+      writer.startFile("model.rexs") << content;
+      writer.finish();
+    }
+
+    rexsapi::detail::ZipArchive archive{path, extensionChecker};
+    CHECK(archive.getFileType() == rexsapi::TFileType::XML);
+    auto& stream = archive.open(100);
+    std::string line;
+    std::getline(stream, line);
+    CHECK(line == "<component id=\"0\"/>");
+    std::string streamed{std::istreambuf_iterator<char>{archive.open(100)}, std::istreambuf_iterator<char>{}};
+    CHECK(streamed == content);
+  }
+
+  SUBCASE("Write uncompressed zip")
+  {
+    TemporaryDirectory guard;
+    const auto path = guard.getTempDirectoryPath() / "model.rexsz";
+    {
+      rexsapi::detail::ZipArchiveWriter writer{path, MZ_NO_COMPRESSION};
+      writer.startFile("model.rexs");
+      writer.finish();
+    }
+    rexsapi::detail::ZipArchive archive{path, extensionChecker};
+    const auto [value, type] = archive.load();
+    CHECK(type == rexsapi::TFileType::XML);
+    CHECK(value.empty());
+  }
+
+  SUBCASE("Write zip with invalid compression level")
+  {
+    TemporaryDirectory guard;
+    CHECK_THROWS(rexsapi::detail::ZipArchiveWriter{guard.getTempDirectoryPath() / "model.rexsz", 11});
+    CHECK_THROWS(rexsapi::detail::ZipArchiveWriter{guard.getTempDirectoryPath() / "model.rexsz", -1});
+  }
+
+  SUBCASE("Write zip to non-existing directory")
+  {
+    CHECK_THROWS(rexsapi::detail::ZipArchiveWriter{std::filesystem::path{"puschel"} / "model.rexsz"});
+  }
 }
@@ -53,4 +53,19 @@ TEST_CASE("Component test")
                       "component id=cylindrical_gear does not contain attribute id=not-available-attribute");
     CHECK_FALSE(component.hasAttribute("not-available-attribute"));
   }
+
+  SUBCASE("Find attributes in moved component")
+  {
+    std::vector<std::reference_wrapper<const rexsapi::database::TAttribute>> attributes;
+    attributes.emplace_back(std::ref(attribute1));
+    attributes.emplace_back(std::ref(attribute2));
+
+    rexsapi::database::TComponent component{"cylindrical_gear", "Cylindrical gear", std::move(attributes)};
+    const rexsapi::database::TComponent moved{std::move(component)};
+
+    REQUIRE(moved.hasAttribute("chamfer_angle_worm_wheel"));
+    CHECK(&moved.findAttributeById("chamfer_angle_worm_wheel") == &attribute1);
+    CHECK(&moved.findAttributeById("arithmetic_average_roughness_root") == &attribute2);
+    CHECK(moved.getAttributes().size() == 2);
+  }
 }
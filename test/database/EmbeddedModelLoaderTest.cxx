@@ -0,0 +1,69 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <rexsapi/database/EmbeddedModelLoader.hxx>
+
+#include <test/TestModelLoader.hxx>
+
+#include <doctest.h>
+
+
+TEST_CASE("Embedded model loader test")
+{
+  const rexsapi::database::TEmbeddedModelLoader loader;
+
+#ifdef REXSAPI_EMBEDDED_MODELS
+  SUBCASE("Load embedded models")
+  {
+    const auto [registry, result] = rexsapi::database::TModelRegistry::createModelRegistry(loader);
+    REQUIRE(result);
+
+    for (const auto& embedded : rexsapi::database::detail::EmbeddedModels) {
+      const rexsapi::TRexsVersion version{embedded.m_Major, embedded.m_Minor, embedded.m_Patch};
+      const auto& model = registry.getModel(version, embedded.m_Language);
+      CHECK(model.getVersion() == version);
+      CHECK(model.getLanguage() == embedded.m_Language);
+      if (model.getLanguage() == "en") {
+        const auto& expected = loadModel(version.asString());
+        CHECK(model.getComponents().size() == expected.getComponents().size());
+        CHECK(model.getAttributes().size() == expected.getAttributes().size());
+        CHECK(model.getUnits().size() == expected.getUnits().size());
+      }
+    }
+  }
+
+  SUBCASE("Index embedded models")
+  {
+    const auto [registry, result] = rexsapi::database::TModelRegistry::createLazyModelRegistry(loader);
+    REQUIRE(result);
+    const auto& embedded = rexsapi::database::detail::EmbeddedModels.front();
+    const rexsapi::TRexsVersion version{embedded.m_Major, embedded.m_Minor, embedded.m_Patch};
+    CHECK(registry.getModel(version, embedded.m_Language).getVersion() == version);
+  }
+#else
+  SUBCASE("No embedded models")
+  {
+    size_t count = 0;
+    const auto result = loader.load([&count](rexsapi::database::TModel&&) {
+      ++count;
+    });
+    CHECK_FALSE(result);
+    REQUIRE(result.getErrors().size() == 1);
+    CHECK(result.getErrors()[0].getMessage() == "No embedded database models found");
+    CHECK(count == 0);
+  }
+#endif
+}
@@ -49,6 +49,33 @@ TEST_CASE("File resource loader test")
     });
   }
 
+  SUBCASE("Index existing resources")
+  {
+    rexsapi::database::TFileResourceLoader loader{projectDir() / "models"};
+
+    std::vector<rexsapi::database::TFileResourceLoader::TResourceFactory> factories;
+    auto result = loader.index([&factories](const rexsapi::TResult&, std::istream& stream, auto factory) {
+      std::string start(5, ' ');
+      stream.read(start.data(), static_cast<std::streamsize>(start.size()));
+      CHECK(start == "<?xml");
+      factories.emplace_back(std::move(factory));
+    });
+
+    CHECK(result);
+    REQUIRE(factories.size() == 18);
+    rexsapi::TResult loadResult;
+    checkBuffer(factories.front()(loadResult));
+    CHECK(loadResult);
+  }
+
+  SUBCASE("Index not existing path")
+  {
+    rexsapi::database::TFileResourceLoader loader{projectDir() / "non-existing-models"};
+    CHECK_THROWS(loader.index([](const rexsapi::TResult&, std::istream&, auto) {
+      // nothing to do
+    }));
+  }
+
   SUBCASE("Load not existing path")
   {
     rexsapi::database::TFileResourceLoader loader{projectDir() / "non-existing-models"};
@@ -0,0 +1,140 @@
+/*
+ * Copyright Schaeffler Technologies AG & Co. KG (info.de@schaeffler.com)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <rexsapi/database/ModelCache.hxx>
+
+#include <test/TemporaryDirectory.hxx>
+#include <test/TestModelLoader.hxx>
+
+#include <doctest.h>
+
+
+namespace
+{
+  void checkSameModel(const rexsapi::database::TModel& lhs, const rexsapi::database::TModel& rhs)
+  {
+    CHECK(lhs.getVersion() == rhs.getVersion());
+    CHECK(lhs.getLanguage() == rhs.getLanguage());
+    CHECK(lhs.getDate() == rhs.getDate());
+    CHECK(lhs.isReleased() == rhs.isReleased());
+    CHECK(lhs.getUnits().size() == rhs.getUnits().size());
+    CHECK(lhs.getValueTypes().size() == rhs.getValueTypes().size());
+    REQUIRE(lhs.getAttributes().size() == rhs.getAttributes().size());
+    REQUIRE(lhs.getComponents().size() == rhs.getComponents().size());
+
+    for (const auto& [id, attribute] : lhs.getAttributes()) {
+      const auto& other = rhs.findAttributeById(id);
+      CHECK(attribute.getName() == other.getName());
+      CHECK(attribute.getValueType() == other.getValueType());
+      CHECK(attribute.getUnit() == other.getUnit());
+      CHECK(attribute.getSymbol() == other.getSymbol());
+      REQUIRE(attribute.getInterval().has_value() == other.getInterval().has_value());
+      if (attribute.getInterval()) {
+        const auto& interval = *attribute.getInterval();
+        const auto& otherInterval = *other.getInterval();
+        CHECK(interval.getMin().isSet() == otherInterval.getMin().isSet());
+        CHECK(interval.getMin().getType() == otherInterval.getMin().getType());
+        CHECK(interval.getMin().getLimit() == doctest::Approx(otherInterval.getMin().getLimit()));
+        CHECK(interval.getMax().isSet() == otherInterval.getMax().isSet());
+        CHECK(interval.getMax().getType() == otherInterval.getMax().getType());
+        CHECK(interval.getMax().getLimit() == doctest::Approx(otherInterval.getMax().getLimit()));
+      }
+      REQUIRE(attribute.getEnums().has_value() == other.getEnums().has_value());
+      if (attribute.getEnums()) {
+        CHECK(attribute.getEnums()->getValues().size() == other.getEnums()->getValues().size());
+      }
+    }
+
+    for (const auto& [id, component] : lhs.getComponents()) {
+      const auto& other = rhs.findComponentById(id);
+      CHECK(component.getName() == other.getName());
+      const auto attributes = component.getAttributes();
+      const auto otherAttributes = other.getAttributes();
+      REQUIRE(attributes.size() == otherAttributes.size());
+      for (size_t n = 0; n < attributes.size(); ++n) {
+        CHECK(attributes[n].get().getAttributeId() == otherAttributes[n].get().getAttributeId());
+      }
+    }
+  }
+}
+
+TEST_CASE("Model cache test")
+{
+  TemporaryDirectory guard{};
+  const rexsapi::database::TModelCache cache{guard.getTempDirectoryPath() / "cache"};
+  const std::vector<uint8_t> source{'<', 'r', 'e', 'x', 's', '/', '>'};
+  const auto checksum = rexsapi::database::TModelCache::checksum(source);
+
+  SUBCASE("Store and load model")
+  {
+    const auto& model = loadModel("1.4");
+    CHECK_FALSE(cache.load(checksum));
+    cache.store(checksum, model);
+
+    const auto cached = cache.load(checksum);
+    REQUIRE(cached);
+    checkSameModel(model, *cached);
+    CHECK(cached->findComponentById("side_plate").getAttributes().size() ==
+          model.findComponentById("side_plate").getAttributes().size());
+  }
+
+  SUBCASE("Load model for other source")
+  {
+    cache.store(checksum, loadModel("1.4"));
+    const std::vector<uint8_t> other{'<', 'r', 'e', 'x', 's', 'j', '/', '>'};
+    CHECK_FALSE(cache.load(rexsapi::database::TModelCache::checksum(other)));
+  }
+
+  SUBCASE("Serialize broken model")
+  {
+    auto buffer = rexsapi::database::detail::serializeModel(checksum, loadModel("1.4"));
+    CHECK_NOTHROW((void)rexsapi::database::detail::deserializeModel(checksum, buffer.data(), buffer.size()));
+    CHECK_THROWS_WITH((void)rexsapi::database::detail::deserializeModel(checksum + 1, buffer.data(), buffer.size()),
+                      "database model cache does not belong to the database model");
+
+    auto corrupt = buffer;
+    corrupt[corrupt.size() / 2] ^= 0xFF;
+    CHECK_THROWS_WITH((void)rexsapi::database::detail::deserializeModel(checksum, corrupt.data(), corrupt.size()),
+                      "database model cache is corrupt");
+
+    auto truncated = buffer;
+    truncated.resize(10);
+    CHECK_THROWS_WITH((void)rexsapi::database::detail::deserializeModel(checksum, truncated.data(), truncated.size()),
+                      "not a database model cache");
+  }
+
+  SUBCASE("Use cache with lazy registry")
+  {
+    const rexsapi::TFileXsdSchemaLoader schemaLoader{projectDir() / "models" / "rexs-schema.xsd"};
+    const rexsapi::database::TFileResourceLoader resourceLoader{projectDir() / "models"};
+    const rexsapi::database::TXmlModelLoader modelLoader{resourceLoader, schemaLoader, cache};
+    {
+      const auto [registry, result] = rexsapi::database::TModelRegistry::createLazyModelRegistry(modelLoader);
+      REQUIRE(result);
+      (void)registry.getModel(rexsapi::TRexsVersion{"1.4"}, "en");
+    }
+    size_t files = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(guard.getTempDirectoryPath() / "cache")) {
+      CHECK(entry.path().extension() == ".rexscache");
+      ++files;
+    }
+    CHECK(files == 1);
+
+    const auto [registry, result] = rexsapi::database::TModelRegistry::createLazyModelRegistry(modelLoader);
+    REQUIRE(result);
+    checkSameModel(registry.getModel(rexsapi::TRexsVersion{"1.4"}, "en"), loadModel("1.4"));
+  }
+}
@@ -16,8 +16,12 @@
 
 #include <rexsapi/Rexsapi.hxx>
 
+#include <test/TemporaryDirectory.hxx>
 #include <test/TestHelper.hxx>
 
+#include <fstream>
+#include <thread>
+
 #include <doctest.h>
 
 TEST_CASE("Test rexs model registry")
@@ -79,3 +83,88 @@ TEST_CASE("Test rexs model registry")
     CHECK(model.getLanguage() == "en");
   }
 }
+
+
+TEST_CASE("Test lazy rexs model registry")
+{
+  const rexsapi::TFileXsdSchemaLoader schemaLoader{projectDir() / "models" / "rexs-schema.xsd"};
+
+  SUBCASE("Get existing models")
+  {
+    const rexsapi::database::TFileResourceLoader resourceLoader{projectDir() / "models"};
+    const rexsapi::database::TXmlModelLoader modelLoader{resourceLoader, schemaLoader};
+    const auto [registry, success] = rexsapi::database::TModelRegistry::createLazyModelRegistry(modelLoader);
+    REQUIRE(success);
+
+    const auto& model = registry.getModel(rexsapi::TRexsVersion{"1.4"}, "de");
+    CHECK(model.getVersion() == rexsapi::TRexsVersion{"1.4"});
+    CHECK(model.getLanguage() == "de");
+    CHECK(model.findComponentById("side_plate").getName() == "Wange");
+    CHECK(&registry.getModel(rexsapi::TRexsVersion{"1.4"}, "de") == &model);
+
+    CHECK_THROWS_WITH((void)registry.getModel(rexsapi::TRexsVersion{"1.4"}, "es"),
+                      "cannot find a database model for version '1.4' and locale 'es'");
+
+    const auto& latest = registry.getModel(rexsapi::TRexsVersion{"1.99"}, "es", false);
+    CHECK(latest.getVersion() == rexsapi::TRexsVersion{"2.0.0"});
+    CHECK(latest.getLanguage() == "en");
+  }
+
+  SUBCASE("Get models concurrently")
+  {
+    const rexsapi::database::TFileResourceLoader resourceLoader{projectDir() / "models"};
+    const rexsapi::database::TXmlModelLoader modelLoader{resourceLoader, schemaLoader};
+    const auto [registry, success] = rexsapi::database::TModelRegistry::createLazyModelRegistry(modelLoader);
+    REQUIRE(success);
+
+    std::vector<const rexsapi::database::TModel*> models(8);
+    std::vector<std::thread> threads;
+    for (size_t n = 0; n < models.size(); ++n) {
+      threads.emplace_back([&registry = registry, &models, n] {
+        models[n] = &registry.getModel(rexsapi::TRexsVersion{"1.5"}, "en");
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    CHECK(std::all_of(models.begin(), models.end(), [&models](const auto* model) {
+      return model == models.front();
+    }));
+  }
+
+  SUBCASE("Get broken model")
+  {
+    TemporaryDirectory guard{};
+    {
+      std::ofstream file{guard.getTempDirectoryPath() / "rexs_schema_1.4_en.xml"};
+      file << R"(<?xml version="1.0" encoding="UTF-8"?><rexsSchema version="1.4" language="en"><units>)";
+    }
+    {
+      std::ofstream file{guard.getTempDirectoryPath() / "rexs_schema_1.5_en.xml"};
+      file << "<rexsSchema>";
+    }
+    std::filesystem::copy_file(projectDir() / "models" / "rexs_schema_1.3_en.xml",
+                               guard.getTempDirectoryPath() / "rexs_schema_1.3_en.xml");
+    const rexsapi::database::TFileResourceLoader resourceLoader{guard.getTempDirectoryPath()};
+    const rexsapi::database::TXmlModelLoader modelLoader{resourceLoader, schemaLoader};
+    const auto [registry, success] = rexsapi::database::TModelRegistry::createLazyModelRegistry(modelLoader);
+    CHECK_FALSE(success);
+    REQUIRE(success.getErrors().size() == 1);
+    CHECK(success.getErrors()[0].getMessage() == "database model header has no version or language");
+
+    CHECK_THROWS_AS((void)registry.getModel(rexsapi::TRexsVersion{"1.4"}, "en"), rexsapi::TException);
+    CHECK_THROWS_AS((void)registry.getModel(rexsapi::TRexsVersion{"1.4"}, "en"), rexsapi::TException);
+    CHECK_THROWS_WITH((void)registry.getModel(rexsapi::TRexsVersion{"1.5"}, "en"),
+                      "cannot find a database model for version '1.5' and locale 'en'");
+
+    // non-strict retrieval skips the broken model like a missing one
+    rexsapi::TResult result;
+    const auto& model = registry.getModel(result, rexsapi::TRexsVersion{"1.4"}, "en", false);
+    CHECK(model.getVersion() == rexsapi::TRexsVersion{"1.3"});
+    CHECK(&registry.getModel(rexsapi::TRexsVersion{"1.5"}, "en", false) == &model);
+    REQUIRE(result.getErrors().size() == 1);
+    CHECK(result.getErrors()[0].isWarning());
+    CHECK(result.getErrors()[0].getMessage().rfind("database model for version '1.4' and locale 'en' cannot be", 0) ==
+          0);
+  }
+}
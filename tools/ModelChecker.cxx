@@ -24,8 +24,10 @@
 struct Options {
   rexsapi::TMode mode{rexsapi::TMode::STRICT_MODE};
   std::filesystem::path modelDatabasePath;
+  std::filesystem::path cachePath;
   std::vector<std::filesystem::path> models;
   bool showWarnings{false};
+  size_t jobs{1};
   rexsapi::TCustomExtensionMappings customExtentionMappings;
 };
 
@@ -57,9 +59,11 @@ static std::optional<Options> getOptions(int argc, char** argv)
     ->excludes(strictFlag);
   app.add_flag("-w,--warnings", options.showWarnings, "Show all warnings");
   app.add_flag("-r", recurse, "Recurse into sub-directories");
+  app.add_option("-j,--jobs", options.jobs, "Number of models to check in parallel. 0 uses all available cores.");
   app.add_option("-d,--database", options.modelDatabasePath, "The model database path")
     ->check(CLI::ExistingDirectory)
     ->required();
+  app.add_option("-c,--cache", options.cachePath, "Directory for caching the model database in a binary format");
   app.add_option(
     "-m", customExtensionMappings,
     "Custom extension for rexs files. E.g. .rexs.in:xml will use the extension .res.in to import xml files.");
@@ -93,37 +97,51 @@ int main(int argc, char** argv)
       return EXIT_FAILURE;
     }
 
-    const rexsapi::TModelLoader loader{options->modelDatabasePath, options->customExtentionMappings};
+    const auto loader =
+      options->cachePath.empty()
+        ? rexsapi::TModelLoader{options->modelDatabasePath, options->customExtentionMappings}
+        : rexsapi::TModelLoader{options->modelDatabasePath, rexsapi::database::TModelCache{options->cachePath},
+                                options->customExtentionMappings};
 
+    // load the models in batches to limit the number of models in memory at the same time
+    const size_t jobs = options->jobs ? options->jobs : std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    const size_t batchSize = jobs * 16;
     bool start{true};
-    for (const auto& modelFile : options->models) {
-      if (start) {
-        start = false;
-      } else {
-        std::cout << std::endl;
-      }
-      rexsapi::TResult result;
-      const auto model = loader.load(modelFile, result, options->mode);
-
-      std::cout << "File " << modelFile;
-      if (!result) {
-        std::cout << std::endl << fmt::format("  Found {} issues", result.getErrors().size()) << std::endl;
-      } else {
-        std::cout << " processed";
-        if (result.hasIssues() && options->showWarnings) {
-          std::cout << fmt::format(", but has the following {} warnings", result.getErrors().size());
-        } else if (result.hasIssues() && !options->showWarnings) {
-          std::cout << fmt::format(" with {} warnings", result.getErrors().size());
+    for (size_t offset = 0; offset < options->models.size(); offset += batchSize) {
+      const auto first = options->models.begin() + static_cast<std::ptrdiff_t>(offset);
+      const std::vector<std::filesystem::path> batch{
+        first, first + static_cast<std::ptrdiff_t>(std::min(batchSize, options->models.size() - offset))};
+      const auto models = loader.loadAll(batch, options->mode, jobs);
+
+      for (size_t n = 0; n < batch.size(); ++n) {
+        const auto& modelFile = batch[n];
+        const auto& result = models[n].second;
+        if (start) {
+          start = false;
         } else {
-          std::cout << " successfully";
+          std::cout << std::endl;
         }
-        std::cout << std::endl;
-      }
-      for (const auto& error : result.getErrors()) {
-        if (error.isWarning() && !options->showWarnings) {
-          continue;
+
+        std::cout << "File " << modelFile;
+        if (!result) {
+          std::cout << std::endl << fmt::format("  Found {} issues", result.getErrors().size()) << std::endl;
+        } else {
+          std::cout << " processed";
+          if (result.hasIssues() && options->showWarnings) {
+            std::cout << fmt::format(", but has the following {} warnings", result.getErrors().size());
+          } else if (result.hasIssues() && !options->showWarnings) {
+            std::cout << fmt::format(" with {} warnings", result.getErrors().size());
+          } else {
+            std::cout << " successfully";
+          }
+          std::cout << std::endl;
+        }
+        for (const auto& error : result.getErrors()) {
+          if (error.isWarning() && !options->showWarnings) {
+            continue;
+          }
+          std::cout << "  " << error.getMessage() << std::endl;
         }
-        std::cout << "  " << error.getMessage() << std::endl;
       }
     }
   } catch (const std::exception& ex) {